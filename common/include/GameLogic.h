@@ -119,6 +119,8 @@ namespace Blokus {
             void skipTurn();
             void setTurnOrder(const std::vector<PlayerColor>& turnOrder);
             void setCurrentPlayerIndex(int index);
+            // 저장된 진행 상태로 복원 (서버 재시작 시 게임 이어하기용)
+            void restoreTurnState(const std::vector<PlayerColor>& turnOrder, int currentPlayerIndex, int turnNumber);
 
             // 상태 확인
             GameState getGameState() const { return m_gameState; }
@@ -777,6 +777,14 @@ namespace Blokus
             }
         }
 
+        void GameStateManager::restoreTurnState(const std::vector<PlayerColor> &turnOrder, int currentPlayerIndex, int turnNumber)
+        {
+            startNewGame(turnOrder);
+            setCurrentPlayerIndex(currentPlayerIndex);
+            m_turnNumber = std::max(1, turnNumber);
+            m_gameLogic.setCurrentPlayer(m_playerOrder[m_currentPlayerIndex]);
+        }
+
         PlayerColor GameStateManager::getNextPlayer() const
         {
             if (m_playerOrder.empty())
@@ -63,6 +63,8 @@ if [ "$DEPLOY_SERVER" = true ]; then
     echo "🎮 Deploying Game Server with image tag: $IMAGE_TAG..."
     GAME_SERVER_IMAGE="ghcr.io/zzzz955/blokus-online/blokus-game-server:$IMAGE_TAG" \
     docker-compose pull blokus-server
+    # SIGTERM 드레인 종료: 진행 중인 게임을 logs/room_migration.dat로 넘기고 새 컨테이너가 이어서 진행
+    docker-compose stop -t ${DRAIN_TIMEOUT:-30} blokus-server
     docker-compose up -d blokus-server
     echo " Game Server deployed"
 fi
@@ -0,0 +1,369 @@
+// ========================================
+// 네트워크 백엔드 비교 벤치마크 (epoll vs io_uring)
+// - GameServer/Session과 같은 방식(줄바꿈 구분 텍스트, 8KB 읽기 버퍼, 세션당 쓰기 1개)으로
+//   루프백 에코 서버와 다수의 클라이언트를 한 프로세스에서 실행
+// - 같은 소스를 epoll 빌드(io_backend_bench_epoll)와 io_uring 빌드(io_backend_bench_uring)로 만들어 비교
+// - 시스템 콜 수 비교: strace -c -f ./io_backend_bench_epoll ... 처럼 실행
+// ========================================
+#include <boost/asio.hpp>
+#include <sys/resource.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+    using boost::asio::ip::tcp;
+    using Clock = std::chrono::steady_clock;
+
+    constexpr size_t kReadBufferSize = 8192;
+
+    struct Options {
+        int connections = 1000;
+        int serverThreads = 4;
+        int clientThreads = 2;
+        int seconds = 10;
+        int pipeline = 1;
+        int payload = 64;
+    };
+
+    const char* backendName() {
+#if defined(BLOKUS_IO_URING) && defined(BOOST_ASIO_DISABLE_EPOLL)
+        return "io_uring";
+#else
+        return "epoll";
+#endif
+    }
+
+    // ========================================
+    // 서버 측 세션 (Session::startRead/doWrite와 같은 구조)
+    // ========================================
+    class EchoSession : public std::enable_shared_from_this<EchoSession> {
+    public:
+        EchoSession(tcp::socket socket, char* readBuffer
+#ifdef BLOKUS_IO_URING
+            , std::optional<boost::asio::mutable_registered_buffer> registered
+#endif
+        )
+            : socket_(std::move(socket))
+            , readBuffer_(readBuffer)
+#ifdef BLOKUS_IO_URING
+            , registered_(registered)
+#endif
+        {
+        }
+
+        void start() { startRead(); }
+
+    private:
+        void startRead() {
+            auto self = shared_from_this();
+            auto handler = [this, self](const boost::system::error_code& error, size_t bytes) {
+                if (error) {
+                    return;
+                }
+                pending_.append(readBuffer_, bytes);
+
+                size_t pos = 0;
+                while ((pos = pending_.find('\n')) != std::string::npos) {
+                    std::string reply = "PONG" + pending_.substr(4, pos - 4 + 1);
+                    pending_.erase(0, pos + 1);
+                    send(std::move(reply));
+                }
+                startRead();
+            };
+
+#ifdef BLOKUS_IO_URING
+            if (registered_) {
+                socket_.async_read_some(*registered_, std::move(handler));
+                return;
+            }
+#endif
+            socket_.async_read_some(boost::asio::buffer(readBuffer_, kReadBufferSize), std::move(handler));
+        }
+
+        void send(std::string message) {
+            std::lock_guard<std::mutex> lock(sendMutex_);
+            outgoing_.push_back(std::move(message));
+            if (!writing_) {
+                writing_ = true;
+                doWrite();
+            }
+        }
+
+        void doWrite() {
+            auto self = shared_from_this();
+            boost::asio::async_write(socket_, boost::asio::buffer(outgoing_.front()),
+                [this, self](const boost::system::error_code& error, size_t) {
+                    std::lock_guard<std::mutex> lock(sendMutex_);
+                    outgoing_.pop_front();
+                    if (error || outgoing_.empty()) {
+                        writing_ = false;
+                        return;
+                    }
+                    doWrite();
+                });
+        }
+
+        tcp::socket socket_;
+        char* readBuffer_;
+#ifdef BLOKUS_IO_URING
+        std::optional<boost::asio::mutable_registered_buffer> registered_;
+#endif
+        std::string pending_;
+        std::mutex sendMutex_;
+        std::deque<std::string> outgoing_;
+        bool writing_ = false;
+    };
+
+    // ========================================
+    // 클라이언트 (파이프라인 깊이만큼 요청을 유지하며 RTT 측정)
+    // ========================================
+    class Client : public std::enable_shared_from_this<Client> {
+    public:
+        Client(boost::asio::io_context& io, const Options& options, std::atomic<bool>& running)
+            : socket_(io)
+            , options_(options)
+            , running_(running)
+        {
+            payload_.assign(static_cast<size_t>(std::max(0, options.payload)), 'x');
+        }
+
+        void start(const tcp::endpoint& endpoint) {
+            auto self = shared_from_this();
+            socket_.async_connect(endpoint, [this, self](const boost::system::error_code& error) {
+                if (error) {
+                    return;
+                }
+                socket_.set_option(tcp::no_delay(true));
+                for (int i = 0; i < options_.pipeline; ++i) {
+                    sendPing();
+                }
+                startRead();
+            });
+        }
+
+        const std::vector<uint32_t>& samples() const { return rttMicros_; }
+        uint64_t completed() const { return completed_; }
+
+    private:
+        void sendPing() {
+            sentAt_.push_back(Clock::now());
+            auto message = std::make_shared<std::string>("PING:" + std::to_string(seq_++) + ":" + payload_ + "\n");
+            auto self = shared_from_this();
+            boost::asio::async_write(socket_, boost::asio::buffer(*message),
+                [self, message](const boost::system::error_code&, size_t) {});
+        }
+
+        void startRead() {
+            auto self = shared_from_this();
+            socket_.async_read_some(boost::asio::buffer(readBuffer_),
+                [this, self](const boost::system::error_code& error, size_t bytes) {
+                    if (error) {
+                        return;
+                    }
+                    pending_.append(readBuffer_, bytes);
+
+                    size_t pos = 0;
+                    while ((pos = pending_.find('\n')) != std::string::npos) {
+                        pending_.erase(0, pos + 1);
+                        if (!sentAt_.empty()) {
+                            auto rtt = std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - sentAt_.front());
+                            sentAt_.pop_front();
+                            rttMicros_.push_back(static_cast<uint32_t>(rtt.count()));
+                        }
+                        ++completed_;
+                        if (running_.load(std::memory_order_relaxed)) {
+                            sendPing();
+                        }
+                    }
+
+                    if (running_.load(std::memory_order_relaxed) || !sentAt_.empty()) {
+                        startRead();
+                    }
+                    else {
+                        boost::system::error_code ec;
+                        socket_.close(ec);
+                    }
+                });
+        }
+
+        tcp::socket socket_;
+        const Options& options_;
+        std::atomic<bool>& running_;
+        std::string payload_;
+        char readBuffer_[kReadBufferSize];
+        std::string pending_;
+        std::deque<Clock::time_point> sentAt_;
+        std::vector<uint32_t> rttMicros_;
+        uint64_t completed_ = 0;
+        uint64_t seq_ = 0;
+    };
+
+    void raiseFileLimit() {
+        rlimit limit{};
+        if (getrlimit(RLIMIT_NOFILE, &limit) == 0 && limit.rlim_cur < limit.rlim_max) {
+            limit.rlim_cur = limit.rlim_max;
+            setrlimit(RLIMIT_NOFILE, &limit);
+        }
+    }
+
+    Options parseOptions(int argc, char* argv[]) {
+        Options options;
+        for (int i = 1; i + 1 < argc; i += 2) {
+            std::string key = argv[i];
+            int value = std::atoi(argv[i + 1]);
+            if (key == "--connections") options.connections = value;
+            else if (key == "--server-threads") options.serverThreads = value;
+            else if (key == "--client-threads") options.clientThreads = value;
+            else if (key == "--seconds") options.seconds = value;
+            else if (key == "--pipeline") options.pipeline = value;
+            else if (key == "--payload") options.payload = value;
+            else std::fprintf(stderr, "알 수 없는 옵션: %s\n", key.c_str());
+        }
+        options.connections = std::max(1, options.connections);
+        options.serverThreads = std::max(1, options.serverThreads);
+        options.clientThreads = std::max(1, options.clientThreads);
+        options.seconds = std::max(1, options.seconds);
+        options.pipeline = std::max(1, options.pipeline);
+        return options;
+    }
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    Options options = parseOptions(argc, argv);
+    raiseFileLimit();
+
+    // 서버: 세션당 8KB 읽기 버퍼를 하나의 슬랩에서 할당 (io_uring 빌드에서는 커널에 등록)
+    boost::asio::io_context serverIo;
+    tcp::acceptor acceptor(serverIo, tcp::endpoint(boost::asio::ip::address_v4::loopback(), 0));
+    acceptor.listen(boost::asio::socket_base::max_listen_connections);
+    const tcp::endpoint endpoint = acceptor.local_endpoint();
+
+    std::vector<char> slab(static_cast<size_t>(options.connections) * kReadBufferSize);
+#ifdef BLOKUS_IO_URING
+    std::optional<boost::asio::buffer_registration<std::vector<boost::asio::mutable_buffer>>> registration;
+    try {
+        std::vector<boost::asio::mutable_buffer> buffers;
+        for (int i = 0; i < options.connections; ++i) {
+            buffers.push_back(boost::asio::buffer(slab.data() + i * kReadBufferSize, kReadBufferSize));
+        }
+        registration.emplace(boost::asio::register_buffers(serverIo, buffers));
+    }
+    catch (const std::exception& e) {
+        std::fprintf(stderr, "버퍼 등록 실패, 일반 버퍼 사용: %s\n", e.what());
+    }
+#endif
+
+    std::atomic<int> accepted{ 0 };
+    std::function<void()> acceptNext = [&]() {
+        acceptor.async_accept([&](const boost::system::error_code& error, tcp::socket socket) {
+            if (error) {
+                return;
+            }
+            int index = accepted.fetch_add(1);
+            if (index < options.connections) {
+                socket.set_option(tcp::no_delay(true));
+                auto session = std::make_shared<EchoSession>(std::move(socket), slab.data() + index * kReadBufferSize
+#ifdef BLOKUS_IO_URING
+                    , registration ? std::optional<boost::asio::mutable_registered_buffer>((*registration)[index]) : std::nullopt
+#endif
+                );
+                session->start();
+            }
+            acceptNext();
+        });
+    };
+    acceptNext();
+
+    auto serverGuard = boost::asio::make_work_guard(serverIo);
+    std::vector<std::thread> serverThreads;
+    for (int i = 0; i < options.serverThreads; ++i) {
+        serverThreads.emplace_back([&serverIo]() { serverIo.run(); });
+    }
+
+    // 클라이언트: 별도 io_context에서 실행 (서버 스레드와 CPU 경쟁은 그대로 남음)
+    boost::asio::io_context clientIo;
+    std::atomic<bool> running{ true };
+    std::vector<std::shared_ptr<Client>> clients;
+    clients.reserve(options.connections);
+    for (int i = 0; i < options.connections; ++i) {
+        clients.push_back(std::make_shared<Client>(clientIo, options, running));
+        clients.back()->start(endpoint);
+    }
+
+    rusage usageBefore{};
+    getrusage(RUSAGE_SELF, &usageBefore);
+    auto started = Clock::now();
+
+    std::vector<std::thread> clientThreads;
+    for (int i = 0; i < options.clientThreads; ++i) {
+        clientThreads.emplace_back([&clientIo]() { clientIo.run(); });
+    }
+
+    std::this_thread::sleep_for(std::chrono::seconds(options.seconds));
+    running.store(false);
+    for (auto& thread : clientThreads) {
+        thread.join();
+    }
+    double elapsed = std::chrono::duration<double>(Clock::now() - started).count();
+
+    rusage usageAfter{};
+    getrusage(RUSAGE_SELF, &usageAfter);
+
+    serverGuard.reset();
+    serverIo.stop();
+    for (auto& thread : serverThreads) {
+        thread.join();
+    }
+
+    // 결과 집계
+    uint64_t total = 0;
+    std::vector<uint32_t> samples;
+    for (const auto& client : clients) {
+        total += client->completed();
+        samples.insert(samples.end(), client->samples().begin(), client->samples().end());
+    }
+    std::sort(samples.begin(), samples.end());
+    auto percentile = [&samples](double p) -> uint32_t {
+        if (samples.empty()) {
+            return 0;
+        }
+        size_t index = std::min(samples.size() - 1, static_cast<size_t>(p * static_cast<double>(samples.size())));
+        return samples[index];
+    };
+
+    auto cpuSeconds = [](const rusage& usage) {
+        return usage.ru_utime.tv_sec + usage.ru_stime.tv_sec + (usage.ru_utime.tv_usec + usage.ru_stime.tv_usec) / 1e6;
+    };
+
+    std::printf("backend=%s registered_buffers=%s connections=%d pipeline=%d payload=%d seconds=%.1f\n",
+        backendName(),
+#ifdef BLOKUS_IO_URING
+        registration ? "yes" : "no",
+#else
+        "no",
+#endif
+        options.connections, options.pipeline, options.payload, elapsed);
+    std::printf("messages=%llu throughput=%.0f msg/s\n",
+        static_cast<unsigned long long>(total), static_cast<double>(total) / elapsed);
+    std::printf("rtt_us p50=%u p99=%u p999=%u max=%u\n",
+        percentile(0.50), percentile(0.99), percentile(0.999), samples.empty() ? 0 : samples.back());
+    std::printf("cpu_s=%.2f cpu_us_per_msg=%.2f ctx_switches=%ld\n",
+        cpuSeconds(usageAfter) - cpuSeconds(usageBefore),
+        total > 0 ? (cpuSeconds(usageAfter) - cpuSeconds(usageBefore)) * 1e6 / static_cast<double>(total) : 0.0,
+        (usageAfter.ru_nvcsw + usageAfter.ru_nivcsw) - (usageBefore.ru_nvcsw + usageBefore.ru_nivcsw));
+    return 0;
+}
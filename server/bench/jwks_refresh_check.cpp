@@ -0,0 +1,213 @@
+// ========================================
+// JWKS 새로고침 / 검증 토큰 캐시 검사
+// - 로컬 JWKS 대역(JwksStandIn)을 JwtVerifier::setJwksFetcher로 주입해 실제 인증 서버 없이 실행
+// - 검증 토큰 캐시 적중: 같은 토큰 재검증 시 서명 검증 없이 캐시에서 반환
+// - 키 교체: 게시 키가 A -> B로 바뀌면 모르는 kid 토큰이 요청 새로고침으로 검증되고, A 토큰은 캐시에서도 제거
+// - 새로고침 실패: 페치 실패 / 빈 키 목록이면 기존 키를 유지하고 계속 검증
+// 실패한 항목이 있으면 종료 코드 1
+// ========================================
+#include "JwtVerifier.h"
+#include <spdlog/spdlog.h>
+#include <jwt-cpp/jwt.h>
+#include <nlohmann/json.hpp>
+#include <openssl/bn.h>
+#include <openssl/evp.h>
+#include <openssl/opensslv.h>
+#include <openssl/pem.h>
+#include <openssl/rsa.h>
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+#include <openssl/core_names.h>
+#endif
+#include <chrono>
+#include <cstdio>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+
+    using namespace Blokus::Server;
+
+    const std::string kJwksUrl = "http://127.0.0.1:9/.well-known/jwks.json";
+    const std::string kIssuer = "https://auth.local.test";
+    const std::string kAudience = "blokus-game-server";
+
+    struct TestKey {
+        std::string kid;
+        std::string privatePem;
+        std::string n;  // base64url
+        std::string e;  // base64url
+    };
+
+    // 인증 서버의 JWKS 엔드포인트 대역 (게시 내용 / 실패 여부를 검사 중에 바꿀 수 있음)
+    class JwksStandIn {
+    public:
+        void publish(std::string body) {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_body = std::move(body);
+        }
+
+        void fail() {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_body.reset();
+        }
+
+        JwksFetcher fetcher() {
+            return [this](const std::string& url) -> std::optional<std::string> {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                ++m_fetchCount;
+                m_lastUrl = url;
+                return m_body;
+            };
+        }
+
+        size_t fetchCount() const {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            return m_fetchCount;
+        }
+
+        std::string lastUrl() const {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            return m_lastUrl;
+        }
+
+    private:
+        mutable std::mutex m_mutex;
+        std::optional<std::string> m_body;
+        size_t m_fetchCount = 0;
+        std::string m_lastUrl;
+    };
+
+    std::string bignumToBase64Url(const BIGNUM* bn) {
+        std::string bytes(static_cast<size_t>(BN_num_bytes(bn)), '\0');
+        BN_bn2bin(bn, reinterpret_cast<unsigned char*>(&bytes[0]));
+        return jwt::base::trim<jwt::alphabet::base64url>(jwt::base::encode<jwt::alphabet::base64url>(bytes));
+    }
+
+    TestKey generateKey(const std::string& kid) {
+        EVP_PKEY* pkey = nullptr;
+        EVP_PKEY_CTX* ctx = EVP_PKEY_CTX_new_id(EVP_PKEY_RSA, nullptr);
+        if (!ctx || EVP_PKEY_keygen_init(ctx) <= 0 ||
+            EVP_PKEY_CTX_set_rsa_keygen_bits(ctx, 2048) <= 0 || EVP_PKEY_keygen(ctx, &pkey) <= 0) {
+            EVP_PKEY_CTX_free(ctx);
+            throw std::runtime_error("RSA 키 생성 실패");
+        }
+        EVP_PKEY_CTX_free(ctx);
+
+        TestKey key;
+        key.kid = kid;
+
+        BIO* bio = BIO_new(BIO_s_mem());
+        PEM_write_bio_PrivateKey(bio, pkey, nullptr, nullptr, 0, nullptr, nullptr);
+        char* data = nullptr;
+        long length = BIO_get_mem_data(bio, &data);
+        key.privatePem.assign(data, static_cast<size_t>(length));
+        BIO_free(bio);
+
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+        BIGNUM* n = nullptr;
+        BIGNUM* e = nullptr;
+        EVP_PKEY_get_bn_param(pkey, OSSL_PKEY_PARAM_RSA_N, &n);
+        EVP_PKEY_get_bn_param(pkey, OSSL_PKEY_PARAM_RSA_E, &e);
+        key.n = bignumToBase64Url(n);
+        key.e = bignumToBase64Url(e);
+        BN_free(n);
+        BN_free(e);
+#else
+        const BIGNUM* n = nullptr;
+        const BIGNUM* e = nullptr;
+        RSA_get0_key(EVP_PKEY_get0_RSA(pkey), &n, &e, nullptr);
+        key.n = bignumToBase64Url(n);
+        key.e = bignumToBase64Url(e);
+#endif
+        EVP_PKEY_free(pkey);
+        return key;
+    }
+
+    std::string makeJwks(const std::vector<const TestKey*>& keys) {
+        nlohmann::json jwks;
+        jwks["keys"] = nlohmann::json::array();
+        for (const TestKey* key : keys) {
+            jwks["keys"].push_back({
+                {"kid", key->kid}, {"kty", "RSA"}, {"use", "sig"},
+                {"alg", "RS256"}, {"n", key->n}, {"e", key->e}
+            });
+        }
+        return jwks.dump();
+    }
+
+    std::string signToken(const TestKey& key, const std::string& subject) {
+        auto now = std::chrono::system_clock::now();
+        return jwt::create()
+            .set_type("JWT")
+            .set_key_id(key.kid)
+            .set_issuer(kIssuer)
+            .set_audience(kAudience)
+            .set_subject(subject)
+            .set_issued_at(now)
+            .set_expires_at(now + std::chrono::minutes(10))
+            .sign(jwt::algorithm::rs256("", key.privatePem, "", ""));
+    }
+
+    int g_failures = 0;
+
+    void check(bool condition, const char* description) {
+        std::printf("[%s] %s\n", condition ? "PASS" : "FAIL", description);
+        if (!condition) {
+            ++g_failures;
+        }
+    }
+
+} // namespace
+
+int main() {
+    spdlog::set_level(spdlog::level::warn);
+
+    const TestKey keyA = generateKey("key-a");
+    const TestKey keyB = generateKey("key-b");
+
+    JwksStandIn standIn;
+    standIn.publish(makeJwks({ &keyA }));
+
+    JwtVerifier verifier(kJwksUrl, kIssuer, { kAudience });
+    verifier.setJwksFetcher(standIn.fetcher());
+    verifier.setRefreshInterval(std::chrono::hours(1)); // 주기 새로고침은 검사 중에 끼어들지 않도록
+
+    check(verifier.initialize(), "초기 JWKS 로드");
+    check(standIn.lastUrl() == kJwksUrl, "설정된 JWKS URL로 페치");
+    check(verifier.getCachedKeyCount() == 1, "초기 키 1개 캐시");
+
+    // 1) 검증 토큰 캐시 적중
+    const std::string tokenA = signToken(keyA, "user-a");
+    check(verifier.verifyToken(tokenA).success, "kid=key-a 토큰 검증");
+    uint64_t hitsBefore = verifier.getTokenCacheHits();
+    auto cached = verifier.verifyToken(tokenA);
+    check(cached.success && cached.claims && cached.claims->sub == "user-a", "재검증 시 캐시된 클레임 반환");
+    check(verifier.getTokenCacheHits() == hitsBefore + 1, "재검증은 캐시 적중으로 처리");
+
+    // 2) 키 교체 (A 폐기, B 게시)
+    standIn.publish(makeJwks({ &keyB }));
+    size_t fetchesBefore = standIn.fetchCount();
+    auto rotated = verifier.verifyToken(signToken(keyB, "user-b"));
+    check(rotated.success && rotated.claims && rotated.claims->kid == "key-b", "모르는 kid=key-b 토큰이 요청 새로고침으로 검증");
+    check(standIn.fetchCount() == fetchesBefore + 1, "요청 새로고침은 한 번만 페치");
+    check(verifier.getCachedKeyCount() == 1, "폐기된 key-a는 키 캐시에서 제거");
+    check(!verifier.verifyToken(tokenA).success, "key-a로 검증됐던 토큰은 토큰 캐시에서도 제거");
+
+    // 3) 새로고침 실패 시 기존 키 유지
+    standIn.fail();
+    check(!verifier.refreshJwksCache(), "페치 실패 시 새로고침 실패 보고");
+    check(verifier.getCachedKeyCount() == 1, "페치 실패 후 기존 키 유지");
+    check(verifier.verifyToken(signToken(keyB, "user-b2")).success, "페치 실패 후 기존 키로 새 토큰 검증");
+
+    standIn.publish("{\"keys\":[]}");
+    check(!verifier.refreshJwksCache(), "빈 키 목록은 새로고침 실패로 처리");
+    check(verifier.verifyToken(signToken(keyB, "user-b3")).success, "빈 키 목록 후 기존 키로 새 토큰 검증");
+
+    verifier.shutdown();
+
+    std::printf("\n%s (%d failed)\n", g_failures == 0 ? "OK" : "FAILED", g_failures);
+    return g_failures == 0 ? 0 : 1;
+}
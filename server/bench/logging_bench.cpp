@@ -0,0 +1,168 @@
+// ========================================
+// 핫 패스 로깅 비용 벤치마크
+// - MessageHandler::handleMessage + GameRoom::broadcastMessageLocked 한 번에 해당하는 로그 호출 4개를
+//   메시지 파싱(':' 분할)과 함께 여러 스레드에서 반복 실행하고 초당 처리 메시지 수를 비교
+// - none: 로그 호출 없음 (기준값)
+// - runtime-filtered: spdlog::debug 호출 + 런타임 레벨 info (기존 릴리스 동작, 인자는 계속 평가됨)
+// - compile-elided: SPDLOG_DEBUG 매크로 + SPDLOG_ACTIVE_LEVEL=INFO (인자 평가까지 제거)
+// - sync-debug / async-debug: 디버그 로그를 파일로 실제 출력 (동기 로거 vs 비동기 로거)
+// - rate-limited-warn: 메시지마다 경고를 남기되 BLOKUS_LOG_RATE_LIMITED로 1초에 1건만 출력
+// ========================================
+#define SPDLOG_ACTIVE_LEVEL SPDLOG_LEVEL_INFO
+
+#include "Logging.h"
+#include <spdlog/async.h>
+#include <spdlog/sinks/basic_file_sink.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+    using Clock = std::chrono::steady_clock;
+
+    struct Options {
+        int threads = 4;
+        int messages = 200000;          // 스레드당
+        std::string file = "logging_bench.log";
+        int queueSize = 8192;
+    };
+
+    const std::string kMessage = "game:move:12:5:7:1:0:session_0123456789abcdef:payload_padding_to_look_like_a_real_frame";
+
+    size_t parseMessage(const std::string& message, std::vector<std::string>& parts) {
+        parts.clear();
+        size_t start = 0;
+        for (size_t pos = message.find(':'); pos != std::string::npos; pos = message.find(':', start)) {
+            parts.emplace_back(message, start, pos - start);
+            start = pos + 1;
+        }
+        parts.emplace_back(message, start);
+        return parts.size();
+    }
+
+    // 기존 핫 패스와 같은 모양의 로그 4개 (수신 / 파싱 결과 / 브로드캐스트 시작 / 완료)
+    void handleWithRuntimeFilter(int session, const std::string& message, std::vector<std::string>& parts) {
+        spdlog::debug("📨 메시지 수신 ({}): {}, 현재 상태: {}", session,
+            message.length() > 100 ? message.substr(0, 100) + "..." : message, 3);
+        size_t count = parseMessage(message, parts);
+        spdlog::debug("파싱 결과: {} ({})", parts[0], count);
+        spdlog::debug("브로드캐스트 시작: 방 {}, 메시지: '{}', 플레이어 수: {}", 7,
+            message.substr(0, 50) + (message.length() > 50 ? "..." : ""), 4);
+        spdlog::debug("브로드캐스트 완료: {}/{} 플레이어에게 전송", 4, 4);
+    }
+
+    void handleWithCompileElision(int session, const std::string& message, std::vector<std::string>& parts) {
+        SPDLOG_DEBUG("📨 메시지 수신 ({}): {}, 현재 상태: {}", session,
+            message.length() > 100 ? message.substr(0, 100) + "..." : message, 3);
+        size_t count = parseMessage(message, parts);
+        SPDLOG_DEBUG("파싱 결과: {} ({})", parts[0], count);
+        SPDLOG_DEBUG("브로드캐스트 시작: 방 {}, 메시지: '{}', 플레이어 수: {}", 7,
+            message.substr(0, 50) + (message.length() > 50 ? "..." : ""), 4);
+        SPDLOG_DEBUG("브로드캐스트 완료: {}/{} 플레이어에게 전송", 4, 4);
+        (void)session;
+        (void)count;
+    }
+
+    void handleWithRateLimitedWarn(int session, const std::string& message, std::vector<std::string>& parts) {
+        parseMessage(message, parts);
+        BLOKUS_LOG_RATE_LIMITED(spdlog::level::warn, 1000, "알 수 없는 메시지 타입: {} (세션 {})", parts[0], session);
+    }
+
+    void handleWithoutLogging(int /*session*/, const std::string& message, std::vector<std::string>& parts) {
+        parseMessage(message, parts);
+    }
+
+    using Handler = void (*)(int, const std::string&, std::vector<std::string>&);
+
+    std::shared_ptr<spdlog::logger> makeLogger(const Options& options, bool async, spdlog::level::level_enum level) {
+        auto sink = std::make_shared<spdlog::sinks::basic_file_sink_mt>(options.file, true);
+        std::shared_ptr<spdlog::logger> logger;
+        if (async) {
+            logger = std::make_shared<spdlog::async_logger>("bench", sink, spdlog::thread_pool(),
+                spdlog::async_overflow_policy::overrun_oldest);
+        }
+        else {
+            logger = std::make_shared<spdlog::logger>("bench", sink);
+        }
+        logger->set_pattern("[%Y-%m-%d %H:%M:%S] [%l] [%t] %v");
+        logger->set_level(level);
+        return logger;
+    }
+
+    void runCase(const char* name, Handler handler, const Options& options) {
+        std::atomic<bool> go{ false };
+        std::vector<std::thread> threads;
+        for (int t = 0; t < options.threads; ++t) {
+            threads.emplace_back([&, t]() {
+                std::vector<std::string> parts;
+                parts.reserve(16);
+                while (!go.load(std::memory_order_acquire)) {
+                    std::this_thread::yield();
+                }
+                for (int i = 0; i < options.messages; ++i) {
+                    handler(t, kMessage, parts);
+                }
+            });
+        }
+
+        auto start = Clock::now();
+        go.store(true, std::memory_order_release);
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+        double total = static_cast<double>(options.threads) * options.messages;
+
+        size_t dropped = spdlog::thread_pool() ? spdlog::thread_pool()->overrun_counter() : 0;
+        std::printf("%-20s %10.3f s %14.0f msg/s %12.1f ns/msg   dropped=%zu\n",
+            name, seconds, total / seconds, seconds * 1e9 / total * options.threads, dropped);
+    }
+
+    Options parseOptions(int argc, char* argv[]) {
+        Options options;
+        for (int i = 1; i + 1 < argc; i += 2) {
+            std::string key = argv[i];
+            std::string value = argv[i + 1];
+            if (key == "--threads") options.threads = std::atoi(value.c_str());
+            else if (key == "--messages") options.messages = std::atoi(value.c_str());
+            else if (key == "--file") options.file = value;
+            else if (key == "--queue-size") options.queueSize = std::atoi(value.c_str());
+            else std::fprintf(stderr, "알 수 없는 옵션: %s\n", key.c_str());
+        }
+        options.threads = std::max(1, options.threads);
+        options.messages = std::max(1, options.messages);
+        options.queueSize = std::max(64, options.queueSize);
+        return options;
+    }
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    Options options = parseOptions(argc, argv);
+    std::printf("threads=%d messages/thread=%d file=%s\n\n", options.threads, options.messages, options.file.c_str());
+
+    spdlog::set_default_logger(makeLogger(options, false, spdlog::level::info));
+    runCase("none", handleWithoutLogging, options);
+    runCase("runtime-filtered", handleWithRuntimeFilter, options);
+    runCase("compile-elided", handleWithCompileElision, options);
+    runCase("rate-limited-warn", handleWithRateLimitedWarn, options);
+
+    spdlog::set_default_logger(makeLogger(options, false, spdlog::level::debug));
+    runCase("sync-debug", handleWithRuntimeFilter, options);
+
+    // 비동기: 호출 스레드 비용만 측정 (출력 스레드가 따라가지 못하면 오래된 로그부터 버림)
+    spdlog::init_thread_pool(static_cast<size_t>(options.queueSize), 1);
+    spdlog::set_default_logger(makeLogger(options, true, spdlog::level::debug));
+    runCase("async-debug", handleWithRuntimeFilter, options);
+
+    spdlog::shutdown();
+    std::remove(options.file.c_str());
+    return 0;
+}
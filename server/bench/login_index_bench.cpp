@@ -0,0 +1,194 @@
+// ========================================
+// 중복 로그인 색인 경합 벤치마크
+// - sharded: ActiveLoginIndex (사용자 ID 샤드 / IP 샤드별 락)
+// - global-mutex: 교체 전 방식 (사용자/IP 컨테이너 전체를 뮤텍스 하나로 보호)
+// - 스레드마다 로그인 상태 --live개를 유지하며 가장 오래된 로그인 해제 후 새 로그인 claim 반복
+//   (사용자 ID는 스레드별로 겹치지 않고, IP는 --ips개를 모든 스레드가 공유 - NAT 환경처럼 IP 샤드 경합 포함)
+// - 스레드 수를 바꿔 가며 초당 claim 수 비교
+// ========================================
+#include "ActiveLoginIndex.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+
+    using Blokus::Server::ActiveLoginIndex;
+    using Clock = std::chrono::steady_clock;
+
+    struct Options {
+        std::vector<int> threads{ 1, 2, 4, 8, 16 };
+        int operations = 200000;       // 스레드당 claim 횟수
+        int live = 256;                // 스레드당 유지하는 로그인 수
+        int ips = 256;                 // 공유 IP 수
+        int shards = 16;               // ActiveLoginIndex 샤드 수
+        size_t maxUsersPerIp = 0;      // 0: IP 상한 없음 (claim 실패 없이 처리량만 비교)
+    };
+
+    // 교체 전 방식: 사용자 ID -> IP, IP -> 로그인 수를 전역 뮤텍스 하나로 보호
+    class GlobalMutexIndex {
+    public:
+        bool claim(const std::string& userId, const std::string& ip, size_t maxUsersPerIp) {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (m_users.count(userId) > 0) {
+                return false;
+            }
+            size_t& count = m_ipCounts[ip];
+            if (maxUsersPerIp > 0 && count >= maxUsersPerIp) {
+                return false;
+            }
+            ++count;
+            m_users.emplace(userId, ip);
+            return true;
+        }
+
+        bool release(const std::string& userId, const std::string& ip) {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            auto it = m_users.find(userId);
+            if (it == m_users.end() || it->second != ip) {
+                return false;
+            }
+            m_users.erase(it);
+            auto countIt = m_ipCounts.find(ip);
+            if (countIt != m_ipCounts.end() && --countIt->second == 0) {
+                m_ipCounts.erase(countIt);
+            }
+            return true;
+        }
+
+    private:
+        std::mutex m_mutex;
+        std::unordered_map<std::string, std::string> m_users;
+        std::unordered_map<std::string, size_t> m_ipCounts;
+    };
+
+    bool claimed(ActiveLoginIndex::ClaimResult result) { return result == ActiveLoginIndex::ClaimResult::Claimed; }
+    bool claimed(bool result) { return result; }
+
+    template<typename Index>
+    double runCase(Index& index, int threadCount, const Options& options,
+                   const std::vector<std::vector<std::string>>& userIds, const std::vector<std::string>& ips) {
+        std::atomic<int> ready{ 0 };
+        std::atomic<bool> go{ false };
+        std::atomic<uint64_t> rejected{ 0 };
+
+        std::vector<std::thread> workers;
+        for (int t = 0; t < threadCount; ++t) {
+            workers.emplace_back([&, t]() {
+                const auto& users = userIds[static_cast<size_t>(t)];
+                const size_t live = static_cast<size_t>(options.live);
+                uint64_t localRejected = 0;
+
+                ++ready;
+                while (!go.load(std::memory_order_acquire)) {
+                    std::this_thread::yield();
+                }
+
+                for (int i = 0; i < options.operations; ++i) {
+                    size_t slot = static_cast<size_t>(i) % users.size();
+                    const std::string& ip = ips[(slot * 7 + static_cast<size_t>(t)) % ips.size()];
+                    if (static_cast<size_t>(i) >= live) {
+                        size_t oldSlot = static_cast<size_t>(i - options.live) % users.size();
+                        index.release(users[oldSlot], ips[(oldSlot * 7 + static_cast<size_t>(t)) % ips.size()]);
+                    }
+                    if (!claimed(index.claim(users[slot], ip, options.maxUsersPerIp))) {
+                        ++localRejected;
+                    }
+                }
+                rejected += localRejected;
+            });
+        }
+
+        while (ready.load() < threadCount) {
+            std::this_thread::yield();
+        }
+        auto start = Clock::now();
+        go.store(true, std::memory_order_release);
+        for (auto& worker : workers) {
+            worker.join();
+        }
+        double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+        if (rejected.load() > 0) {
+            std::fprintf(stderr, "  거절된 claim: %llu\n", static_cast<unsigned long long>(rejected.load()));
+        }
+        return static_cast<double>(threadCount) * options.operations / seconds;
+    }
+
+    std::vector<int> parseThreadList(const std::string& value) {
+        std::vector<int> threads;
+        size_t start = 0;
+        while (start <= value.size()) {
+            size_t comma = value.find(',', start);
+            std::string item = value.substr(start, comma == std::string::npos ? std::string::npos : comma - start);
+            if (!item.empty()) {
+                threads.push_back(std::max(1, std::atoi(item.c_str())));
+            }
+            if (comma == std::string::npos) {
+                break;
+            }
+            start = comma + 1;
+        }
+        return threads.empty() ? std::vector<int>{ 1 } : threads;
+    }
+
+    Options parseOptions(int argc, char* argv[]) {
+        Options options;
+        for (int i = 1; i + 1 < argc; i += 2) {
+            std::string key = argv[i];
+            std::string value = argv[i + 1];
+            if (key == "--threads") options.threads = parseThreadList(value);
+            else if (key == "--operations") options.operations = std::atoi(value.c_str());
+            else if (key == "--live") options.live = std::atoi(value.c_str());
+            else if (key == "--ips") options.ips = std::atoi(value.c_str());
+            else if (key == "--shards") options.shards = std::atoi(value.c_str());
+            else if (key == "--max-users-per-ip") options.maxUsersPerIp = static_cast<size_t>(std::max(0, std::atoi(value.c_str())));
+            else std::fprintf(stderr, "알 수 없는 옵션: %s\n", key.c_str());
+        }
+        options.operations = std::max(1, options.operations);
+        options.live = std::max(1, options.live);
+        options.ips = std::max(1, options.ips);
+        options.shards = std::max(1, options.shards);
+        return options;
+    }
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    Options options = parseOptions(argc, argv);
+    const int maxThreads = *std::max_element(options.threads.begin(), options.threads.end());
+    std::printf("operations/thread=%d live/thread=%d ips=%d shards=%d max-users-per-ip=%zu hw-threads=%u\n\n",
+        options.operations, options.live, options.ips, options.shards, options.maxUsersPerIp,
+        std::thread::hardware_concurrency());
+
+    // 문자열은 미리 만들어 두고 색인 연산만 측정 (사용자 ID는 스레드마다 live * 2개를 순환)
+    std::vector<std::vector<std::string>> userIds(static_cast<size_t>(maxThreads));
+    for (int t = 0; t < maxThreads; ++t) {
+        for (int i = 0; i < options.live * 2; ++i) {
+            userIds[static_cast<size_t>(t)].push_back("user_" + std::to_string(t) + "_" + std::to_string(i));
+        }
+    }
+    std::vector<std::string> ips;
+    for (int i = 0; i < options.ips; ++i) {
+        ips.push_back("10.0." + std::to_string(i / 256) + "." + std::to_string(i % 256));
+    }
+
+    std::printf("%8s %18s %18s %8s\n", "threads", "global-mutex/s", "sharded/s", "ratio");
+    for (int threadCount : options.threads) {
+        GlobalMutexIndex global;
+        double globalRate = runCase(global, threadCount, options, userIds, ips);
+
+        ActiveLoginIndex sharded(static_cast<size_t>(options.shards));
+        double shardedRate = runCase(sharded, threadCount, options, userIds, ips);
+
+        std::printf("%8d %18.0f %18.0f %7.2fx\n", threadCount, globalRate, shardedRate, shardedRate / globalRate);
+    }
+    return 0;
+}
@@ -0,0 +1,307 @@
+// ========================================
+// 세션 / 읽기 버퍼 풀 벤치마크 (풀 도입 전후 비교)
+// - embedded: 풀 도입 전 방식 (make_shared, 8KB 읽기 버퍼를 세션 객체에 내장)
+// - pooled: Session::create와 같은 방식 (BlockPool + allocate_shared, 읽기 버퍼는 별도 BlockPool 슬랩)
+// - alloc: 스레드마다 살아 있는 세션 --live개를 유지하며 생성/해제 반복 (처리량, 힙 할당 수, 생성 지연)
+// - accept: 루프백 접속을 반복하며 accept 핸들러에서 세션 생성 + 첫 읽기 시작까지의 지연 측정
+// - 힙 할당 수는 전역 operator new를 가로채 집계 (측정 구간의 할당만)
+// ========================================
+#include "BlockPool.h"
+#include <boost/asio.hpp>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <new>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+    std::atomic<uint64_t> g_heapAllocations{ 0 };
+
+} // namespace
+
+// ========================================
+// 힙 할당 집계 (전역 operator new/delete 교체)
+// ========================================
+void* operator new(size_t size) {
+    g_heapAllocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* p = std::malloc(size ? size : 1)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new(size_t size, std::align_val_t align) {
+    g_heapAllocations.fetch_add(1, std::memory_order_relaxed);
+    size_t alignment = std::max(static_cast<size_t>(align), sizeof(void*));
+    size_t rounded = (std::max<size_t>(size, 1) + alignment - 1) / alignment * alignment;
+    if (void* p = std::aligned_alloc(alignment, rounded)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new[](size_t size) { return operator new(size); }
+void* operator new[](size_t size, std::align_val_t align) { return operator new(size, align); }
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, size_t) noexcept { std::free(p); }
+void operator delete(void* p, std::align_val_t) noexcept { std::free(p); }
+void operator delete(void* p, size_t, std::align_val_t) noexcept { std::free(p); }
+void operator delete[](void* p) noexcept { std::free(p); }
+void operator delete[](void* p, size_t) noexcept { std::free(p); }
+void operator delete[](void* p, std::align_val_t) noexcept { std::free(p); }
+void operator delete[](void* p, size_t, std::align_val_t) noexcept { std::free(p); }
+
+namespace {
+
+    using Blokus::Server::BlockPool;
+    using Blokus::Server::BlockPoolAllocator;
+    using boost::asio::ip::tcp;
+    using Clock = std::chrono::steady_clock;
+
+    constexpr size_t kReadBufferSize = 8192;   // Session::MAX_MESSAGE_LENGTH
+    constexpr size_t kSessionSize = 960;       // x86-64 Linux 릴리스 빌드의 sizeof(Session) (읽기 버퍼 제외)
+    constexpr size_t kSessionStateSize = kSessionSize - sizeof(tcp::socket) - sizeof(char*);
+
+    struct Options {
+        int threads = 1;
+        int iterations = 200000;       // alloc: 스레드당 생성/해제 횟수
+        int live = 1000;               // alloc/accept: 동시에 살아 있는 세션 수
+        int connections = 20000;       // accept: 루프백 접속 횟수
+        int poolSize = 1024;           // SESSION_POOL_SIZE
+    };
+
+    // 풀 도입 전: 읽기 버퍼가 세션 객체에 내장 (make_shared 한 번에 ~9KB)
+    struct EmbeddedSession {
+        explicit EmbeddedSession(tcp::socket s) : socket(std::move(s)) { state[0] = 1; }
+        char* readBuffer() { return buffer; }
+
+        tcp::socket socket;
+        char state[kSessionStateSize];
+        char buffer[kReadBufferSize];
+    };
+
+    // 풀 도입 후: 세션 블록은 세션 풀, 읽기 버퍼는 슬랩 풀에서
+    struct PooledSession {
+        PooledSession(tcp::socket s, BlockPool& slabPool)
+            : socket(std::move(s))
+            , buffer(static_cast<char*>(slabPool.allocate(kReadBufferSize)))
+            , slabs(&slabPool)
+        {
+            state[0] = 1;
+        }
+        ~PooledSession() { slabs->deallocate(buffer, kReadBufferSize); }
+        char* readBuffer() { return buffer; }
+
+        tcp::socket socket;
+        char state[kSessionStateSize - sizeof(BlockPool*)];
+        char* buffer;
+        BlockPool* slabs;
+    };
+
+    struct Pools {
+        explicit Pools(int poolSize)
+            : sessions(sizeof(PooledSession) + 128, static_cast<size_t>(poolSize))
+            , slabs(kReadBufferSize, static_cast<size_t>(poolSize)) {}
+
+        BlockPool sessions;
+        BlockPool slabs;
+    };
+
+    std::shared_ptr<EmbeddedSession> createEmbedded(tcp::socket socket, Pools&) {
+        return std::make_shared<EmbeddedSession>(std::move(socket));
+    }
+
+    std::shared_ptr<PooledSession> createPooled(tcp::socket socket, Pools& pools) {
+        return std::allocate_shared<PooledSession>(BlockPoolAllocator<PooledSession>(pools.sessions), std::move(socket), pools.slabs);
+    }
+
+    struct LatencySummary {
+        double p50 = 0;
+        double p99 = 0;
+        double p999 = 0;
+    };
+
+    LatencySummary summarize(std::vector<uint32_t>& samples) {
+        LatencySummary summary;
+        if (samples.empty()) {
+            return summary;
+        }
+        std::sort(samples.begin(), samples.end());
+        auto at = [&](double q) { return static_cast<double>(samples[static_cast<size_t>(q * (samples.size() - 1))]); };
+        summary.p50 = at(0.50);
+        summary.p99 = at(0.99);
+        summary.p999 = at(0.999);
+        return summary;
+    }
+
+    // ========================================
+    // alloc: 세션 생성/해제 반복
+    // ========================================
+    template<typename Create>
+    void runAllocCase(const char* name, Create create, const Options& options) {
+        Pools pools(options.poolSize);
+        boost::asio::io_context io;
+        std::vector<std::vector<uint32_t>> samples(static_cast<size_t>(options.threads));
+        for (auto& s : samples) {
+            s.reserve(static_cast<size_t>(options.iterations));
+        }
+
+        // 워밍업: 풀과 malloc 캐시가 안정된 상태에서 측정
+        {
+            std::deque<decltype(create(tcp::socket(io), pools))> warm;
+            for (int i = 0; i < options.live * 2; ++i) {
+                warm.push_back(create(tcp::socket(io), pools));
+                if (static_cast<int>(warm.size()) > options.live) {
+                    warm.pop_front();
+                }
+            }
+        }
+
+        uint64_t allocationsBefore = g_heapAllocations.load();
+        auto start = Clock::now();
+
+        std::vector<std::thread> workers;
+        for (int t = 0; t < options.threads; ++t) {
+            workers.emplace_back([&, t]() {
+                std::vector<decltype(create(tcp::socket(io), pools))> window(static_cast<size_t>(options.live));
+                auto& latencies = samples[static_cast<size_t>(t)];
+                for (int i = 0; i < options.iterations; ++i) {
+                    auto& slot = window[static_cast<size_t>(i % options.live)];
+                    auto begin = Clock::now();
+                    slot.reset();   // 오래된 세션 해제 후 새 세션 생성 (재접속 폭주와 같은 패턴)
+                    slot = create(tcp::socket(io), pools);
+                    slot->readBuffer()[0] = 'P';
+                    latencies.push_back(static_cast<uint32_t>(
+                        std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - begin).count()));
+                }
+            });
+        }
+        for (auto& worker : workers) {
+            worker.join();
+        }
+
+        double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+        uint64_t allocations = g_heapAllocations.load() - allocationsBefore;
+        double total = static_cast<double>(options.threads) * options.iterations;
+
+        std::vector<uint32_t> merged;
+        for (auto& s : samples) {
+            merged.insert(merged.end(), s.begin(), s.end());
+        }
+        LatencySummary latency = summarize(merged);
+        std::printf("alloc  %-9s %12.0f sessions/s   heap allocs/session %.3f   p50 %6.0f ns  p99 %7.0f ns  p99.9 %7.0f ns\n",
+            name, total / seconds, static_cast<double>(allocations) / total, latency.p50, latency.p99, latency.p999);
+    }
+
+    // ========================================
+    // accept: 루프백 접속 반복, 핸들러에서 세션 생성 + 첫 읽기 시작
+    // ========================================
+    template<typename Create>
+    void runAcceptCase(const char* name, Create create, const Options& options) {
+        Pools pools(options.poolSize);
+        boost::asio::io_context io;
+        tcp::acceptor acceptor(io, tcp::endpoint(boost::asio::ip::address_v4::loopback(), 0));
+        acceptor.listen(boost::asio::socket_base::max_listen_connections);
+        const tcp::endpoint endpoint = acceptor.local_endpoint();
+
+        std::vector<uint32_t> latencies;
+        latencies.reserve(static_cast<size_t>(options.connections));
+        std::atomic<uint64_t> allocationsInHandlers{ 0 };
+        int accepted = 0;
+
+        std::function<void()> acceptNext = [&]() {
+            acceptor.async_accept([&](const boost::system::error_code& error, tcp::socket socket) {
+                if (error) {
+                    return;
+                }
+                auto begin = Clock::now();
+                uint64_t allocationsBefore = g_heapAllocations.load(std::memory_order_relaxed);
+
+                auto session = create(std::move(socket), pools);
+                auto* raw = session.get();
+                raw->socket.async_read_some(boost::asio::buffer(raw->readBuffer(), kReadBufferSize),
+                    [session](const boost::system::error_code&, size_t) {});
+
+                allocationsInHandlers += g_heapAllocations.load(std::memory_order_relaxed) - allocationsBefore;
+                latencies.push_back(static_cast<uint32_t>(
+                    std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - begin).count()));
+
+                if (++accepted < options.connections) {
+                    acceptNext();
+                }
+            });
+        };
+        acceptNext();
+
+        auto start = Clock::now();
+        std::thread client([&]() {
+            boost::asio::io_context clientIo;
+            std::deque<tcp::socket> open;
+            for (int i = 0; i < options.connections; ++i) {
+                tcp::socket socket(clientIo);
+                boost::system::error_code error;
+                socket.connect(endpoint, error);
+                if (error) {
+                    std::fprintf(stderr, "접속 실패: %s\n", error.message().c_str());
+                    break;
+                }
+                open.push_back(std::move(socket));
+                if (static_cast<int>(open.size()) > options.live) {
+                    open.pop_front();   // 닫힌 세션은 서버에서 읽기 완료(EOF)로 해제
+                }
+            }
+        });
+
+        io.run();
+        client.join();
+        double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+        LatencySummary latency = summarize(latencies);
+        double count = std::max(1.0, static_cast<double>(latencies.size()));
+        std::printf("accept %-9s %12.0f conns/s      heap allocs/accept  %.3f   p50 %6.0f ns  p99 %7.0f ns  p99.9 %7.0f ns\n",
+            name, latencies.size() / seconds, static_cast<double>(allocationsInHandlers.load()) / count,
+            latency.p50, latency.p99, latency.p999);
+    }
+
+    Options parseOptions(int argc, char* argv[]) {
+        Options options;
+        for (int i = 1; i + 1 < argc; i += 2) {
+            std::string key = argv[i];
+            std::string value = argv[i + 1];
+            if (key == "--threads") options.threads = std::atoi(value.c_str());
+            else if (key == "--iterations") options.iterations = std::atoi(value.c_str());
+            else if (key == "--live") options.live = std::atoi(value.c_str());
+            else if (key == "--connections") options.connections = std::atoi(value.c_str());
+            else if (key == "--pool-size") options.poolSize = std::atoi(value.c_str());
+            else std::fprintf(stderr, "알 수 없는 옵션: %s\n", key.c_str());
+        }
+        options.threads = std::max(1, options.threads);
+        options.iterations = std::max(1, options.iterations);
+        options.live = std::max(1, options.live);
+        options.connections = std::max(1, options.connections);
+        options.poolSize = std::max(1, options.poolSize);
+        return options;
+    }
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    Options options = parseOptions(argc, argv);
+    std::printf("threads=%d iterations/thread=%d live=%d connections=%d pool-size=%d session=%zuB read-buffer=%zuB\n\n",
+        options.threads, options.iterations, options.live, options.connections, options.poolSize,
+        kSessionSize, kReadBufferSize);
+
+    runAllocCase("embedded", createEmbedded, options);
+    runAllocCase("pooled", createPooled, options);
+    runAcceptCase("embedded", createEmbedded, options);
+    runAcceptCase("pooled", createPooled, options);
+    return 0;
+}
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Blokus {
+    namespace Server {
+
+        // ========================================
+        // ActiveLoginIndex 클래스
+        // 중복 로그인 차단용 로그인 사용자 색인 (사용자 ID -> IP, IP -> 로그인 사용자 수)
+        // - claim()이 검사와 등록을 한 번에 수행 (검사 후 등록 사이의 경합 구간 없음)
+        // - 사용자 ID 샤드 / IP 샤드로 나눠 샤드 락만 사용 (전역 락 없음)
+        //   연산마다 락 2개를 잡으므로 경합이 없을 때는 전역 뮤텍스보다 약간 느림 (bench/login_index_bench)
+        // - 한 IP에 여러 사용자 허용 (NAT/학교망), 상한은 claim 인자로 지정
+        // ========================================
+        class ActiveLoginIndex {
+        public:
+            enum class ClaimResult {
+                Claimed,
+                SameUserSameIp,     // 이미 같은 IP에서 로그인된 사용자
+                SameUserDiffIp,     // 이미 다른 IP에서 로그인된 사용자
+                IpLimitReached      // 이 IP의 로그인 사용자 수가 상한
+            };
+
+            explicit ActiveLoginIndex(size_t shardCount = 16);
+
+            // maxUsersPerIp == 0이면 IP 상한 없음
+            ClaimResult claim(const std::string& userId, const std::string& ip, size_t maxUsersPerIp);
+            // 같은 IP로 등록된 경우에만 해제 (이미 다른 연결이 다시 등록한 사용자는 건드리지 않음)
+            bool release(const std::string& userId, const std::string& ip);
+
+            // 조회 (claim 전 미리보기용, 결과는 즉시 바뀔 수 있음)
+            ClaimResult peek(const std::string& userId, const std::string& ip, size_t maxUsersPerIp) const;
+            bool containsUser(const std::string& userId) const;
+            size_t getUserCountForIp(const std::string& ip) const;
+
+            // 모니터링용 (전체 샤드 순회)
+            std::vector<std::string> getUserIds() const;
+            std::vector<std::string> getIps() const;
+            size_t size() const { return m_size.load(); }
+
+        private:
+            struct UserShard {
+                mutable std::mutex mutex;
+                std::unordered_map<std::string, std::string> users;    // 사용자 ID -> IP
+            };
+
+            struct IpShard {
+                mutable std::mutex mutex;
+                std::unordered_map<std::string, size_t> counts;         // IP -> 로그인 사용자 수
+            };
+
+            UserShard& userShardFor(const std::string& userId) const;
+            IpShard& ipShardFor(const std::string& ip) const;
+
+            bool reserveIp(const std::string& ip, size_t maxUsersPerIp);
+            void releaseIp(const std::string& ip);
+
+        private:
+            std::vector<std::unique_ptr<UserShard>> m_userShards;
+            std::vector<std::unique_ptr<IpShard>> m_ipShards;
+            std::atomic<size_t> m_size{ 0 };
+        };
+
+    } // namespace Server
+} // namespace Blokus
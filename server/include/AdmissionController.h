@@ -0,0 +1,58 @@
+#pragma once
+
+#include "TokenBucket.h"
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace Blokus {
+    namespace Server {
+
+        // ========================================
+        // AdmissionController 클래스
+        // 리스너에서 새 연결을 받기 전 입장 제어 (세션 시작/메시지 처리 전에 거부)
+        // - IP별 연결 속도 토큰 버킷 (재접속 폭주 / 연결 남용 차단)
+        // - 아직 로그인하지 않은 세션 수 상한 (미인증 세션은 로그인 또는 종료 시 슬롯 반환)
+        // ========================================
+        class AdmissionController {
+        public:
+            struct Options {
+                int ipConnectPerMinute = 60;
+                int ipConnectBurst = 20;
+                size_t maxUnauthenticated = 256;
+                bool limitIpRate = true;            // 개발 모드(다중 봇 부하 테스트)에서는 끔
+            };
+
+            enum class Decision {
+                Admitted,
+                IpRateLimited,
+                TooManyUnauthenticated
+            };
+
+            explicit AdmissionController(const Options& options);
+
+            AdmissionController(const AdmissionController&) = delete;
+            AdmissionController& operator=(const AdmissionController&) = delete;
+
+            // Admitted면 미인증 슬롯 1개를 점유 (releaseUnauthenticated로 반환)
+            Decision admit(const std::string& ip);
+            void releaseUnauthenticated();
+
+            size_t getUnauthenticatedCount() const { return m_unauthenticated.load(std::memory_order_relaxed); }
+
+            // 다시 가득 찬 IP 버킷 정리 (하트비트에서 호출)
+            size_t pruneIdleBuckets();
+
+        private:
+            const Options m_options;
+            const double m_ratePerSecond;
+            const double m_burst;
+
+            std::unordered_map<std::string, TokenBucket> m_ipBuckets;
+            std::mutex m_mutex;
+            std::atomic<size_t> m_unauthenticated{ 0 };
+        };
+
+    } // namespace Server
+} // namespace Blokus
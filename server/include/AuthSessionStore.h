@@ -0,0 +1,83 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <queue>
+#include <memory>
+#include <mutex>
+#include <atomic>
+#include <chrono>
+#include <optional>
+#include <unordered_map>
+
+namespace Blokus {
+    namespace Server {
+
+        struct SessionInfo {
+            std::string userId;
+            std::string username;
+            std::chrono::system_clock::time_point expiresAt;
+            bool isValid;
+
+            SessionInfo() : isValid(false) {}
+        };
+
+        // ========================================
+        // AuthSessionStore 클래스
+        // 인증 세션 토큰 저장소
+        // - 토큰 해시 기준 샤딩: 조회/갱신은 해당 샤드 락만 사용
+        // - 샤드별 만료 최소 힙: 만료 정리는 만료된 항목 수에 비례 (전체 순회 없음)
+        // - 갱신/삭제 시 힙 항목은 세대 번호로 지연 무효화
+        // ========================================
+        class AuthSessionStore {
+        public:
+            explicit AuthSessionStore(size_t shardCount = 16);
+
+            // 등록/조회
+            void insert(const std::string& token, const SessionInfo& info);
+            std::optional<SessionInfo> find(const std::string& token);  // 만료된 세션은 제거 후 nullopt
+            bool refresh(const std::string& token, std::chrono::system_clock::time_point expiresAt);
+            bool erase(const std::string& token);
+
+            // 전체 순회가 필요한 작업 (드물게 호출)
+            size_t eraseByUserId(const std::string& userId);
+            bool containsUsername(const std::string& username) const;
+            void clear();
+
+            // 만료 세션 정리 (샤드 락은 maxBatch개 단위로만 잡음)
+            size_t purgeExpired(std::chrono::system_clock::time_point now, size_t maxBatch = 256);
+
+            size_t size() const { return m_size.load(); }
+
+        private:
+            struct Entry {
+                SessionInfo info;
+                uint64_t generation = 0;
+            };
+
+            struct ExpiryItem {
+                std::chrono::system_clock::time_point expiresAt;
+                std::string token;
+                uint64_t generation;
+
+                bool operator>(const ExpiryItem& other) const { return expiresAt > other.expiresAt; }
+            };
+
+            struct Shard {
+                mutable std::mutex mutex;
+                std::unordered_map<std::string, Entry> sessions;
+                std::priority_queue<ExpiryItem, std::vector<ExpiryItem>, std::greater<ExpiryItem>> expiryHeap;
+                uint64_t nextGeneration = 0;
+            };
+
+            Shard& shardFor(const std::string& token);
+            void scheduleLocked(Shard& shard, const std::string& token, Entry& entry);
+            void compactLocked(Shard& shard);
+
+        private:
+            std::vector<std::unique_ptr<Shard>> m_shards;
+            std::atomic<size_t> m_size{ 0 };
+        };
+
+    } // namespace Server
+} // namespace Blokus
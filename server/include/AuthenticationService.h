@@ -2,6 +2,7 @@
 
 #include "ServerTypes.h"
 #include "JwtVerifier.h"
+#include "AuthSessionStore.h"
 #include <string>
 #include <memory>
 #include <future>
@@ -42,15 +43,6 @@ namespace Blokus {
             }
         };
 
-        struct SessionInfo {
-            std::string userId;
-            std::string username;
-            std::chrono::system_clock::time_point expiresAt;
-            bool isValid;
-
-            SessionInfo() : isValid(false) {}
-        };
-
         // ========================================
         // 인증 서비스 관련 클래스
         // ========================================
@@ -123,7 +115,7 @@ namespace Blokus {
             // 세션 생성 및 제거
             bool storeSession(const std::string& token, const std::string& userId, const std::string& username);
             bool removeSession(const std::string& token);
-            std::optional<SessionInfo> getSessionInfo(const std::string& token) const;
+            std::optional<SessionInfo> getSessionInfo(const std::string& token);
 
             // 이름/이메일 검증용
             std::string normalizeUsername(const std::string& username) const;
@@ -133,9 +125,8 @@ namespace Blokus {
             std::shared_ptr<DatabaseManager> m_dbManager;
             std::unique_ptr<JwtVerifier> m_jwtVerifier;
 
-            // 세션 뮤텍스
-            mutable std::mutex m_sessionsMutex;
-            std::unordered_map<std::string, SessionInfo> m_activeSessions;
+            // 활성 세션 저장소 (샤딩 + 만료 힙)
+            AuthSessionStore m_sessionStore;
 
             // 세션 관리용
             std::chrono::hours m_sessionDuration{ 24 };
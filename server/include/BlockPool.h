@@ -0,0 +1,173 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+
+namespace Blokus {
+    namespace Server {
+
+        // ========================================
+        // BlockPool 클래스
+        // 고정 크기 메모리 블록 재사용 풀 (세션처럼 접속/해제가 잦은 큰 객체용)
+        // - 반환된 블록은 무잠금 유한 MPMC 링(Vyukov)에 보관, 다음 할당에서 재사용
+        // - 링이 가득 차면 해제, 비어 있으면 새로 할당 (풀 크기는 보관 상한일 뿐 할당 상한이 아님)
+        // - blockSize보다 큰 요청은 풀을 거치지 않음
+        // - 어느 스레드에서 할당/반환해도 됨
+        // ========================================
+        class BlockPool {
+        public:
+            static constexpr size_t BLOCK_ALIGN = alignof(std::max_align_t) > 64 ? alignof(std::max_align_t) : 64;
+
+            BlockPool(size_t blockSize, size_t capacity)
+                : m_blockSize(blockSize)
+            {
+                // 링 크기는 2의 거듭제곱 (인덱스 마스크)
+                size_t size = 2;
+                while (size < capacity) {
+                    size <<= 1;
+                }
+                m_mask = size - 1;
+                m_cells = std::make_unique<Cell[]>(size);
+                for (size_t i = 0; i < size; ++i) {
+                    m_cells[i].sequence.store(i, std::memory_order_relaxed);
+                }
+            }
+
+            ~BlockPool() {
+                while (void* block = pop()) {
+                    ::operator delete(block, std::align_val_t(BLOCK_ALIGN));
+                }
+            }
+
+            BlockPool(const BlockPool&) = delete;
+            BlockPool& operator=(const BlockPool&) = delete;
+
+            void* allocate(size_t bytes) {
+                if (bytes > m_blockSize) {
+                    return ::operator new(bytes, std::align_val_t(BLOCK_ALIGN));
+                }
+                if (void* block = pop()) {
+                    m_reused.fetch_add(1, std::memory_order_relaxed);
+                    return block;
+                }
+                m_allocated.fetch_add(1, std::memory_order_relaxed);
+                return ::operator new(m_blockSize, std::align_val_t(BLOCK_ALIGN));
+            }
+
+            void deallocate(void* block, size_t bytes) noexcept {
+                if (bytes > m_blockSize || !push(block)) {
+                    ::operator delete(block, std::align_val_t(BLOCK_ALIGN));
+                }
+            }
+
+            // 상태 확인 (메트릭용, 근사값)
+            size_t blockSize() const { return m_blockSize; }
+            size_t capacity() const { return m_mask + 1; }
+            size_t cached() const {
+                size_t enqueued = m_enqueuePos.load(std::memory_order_relaxed);
+                size_t dequeued = m_dequeuePos.load(std::memory_order_relaxed);
+                return enqueued > dequeued ? enqueued - dequeued : 0;
+            }
+            uint64_t reusedCount() const { return m_reused.load(std::memory_order_relaxed); }
+            uint64_t allocatedCount() const { return m_allocated.load(std::memory_order_relaxed); }
+
+        private:
+            struct Cell {
+                std::atomic<size_t> sequence{ 0 };
+                void* block = nullptr;
+            };
+
+            bool push(void* block) noexcept {
+                size_t pos = m_enqueuePos.load(std::memory_order_relaxed);
+                for (;;) {
+                    Cell& cell = m_cells[pos & m_mask];
+                    size_t sequence = cell.sequence.load(std::memory_order_acquire);
+                    intptr_t diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos);
+                    if (diff == 0) {
+                        if (m_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                            cell.block = block;
+                            cell.sequence.store(pos + 1, std::memory_order_release);
+                            return true;
+                        }
+                    }
+                    else if (diff < 0) {
+                        return false;   // 가득 참
+                    }
+                    else {
+                        pos = m_enqueuePos.load(std::memory_order_relaxed);
+                    }
+                }
+            }
+
+            void* pop() noexcept {
+                size_t pos = m_dequeuePos.load(std::memory_order_relaxed);
+                for (;;) {
+                    Cell& cell = m_cells[pos & m_mask];
+                    size_t sequence = cell.sequence.load(std::memory_order_acquire);
+                    intptr_t diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos + 1);
+                    if (diff == 0) {
+                        if (m_dequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                            void* block = cell.block;
+                            cell.sequence.store(pos + m_mask + 1, std::memory_order_release);
+                            return block;
+                        }
+                    }
+                    else if (diff < 0) {
+                        return nullptr; // 비어 있음
+                    }
+                    else {
+                        pos = m_dequeuePos.load(std::memory_order_relaxed);
+                    }
+                }
+            }
+
+        private:
+            const size_t m_blockSize;
+            size_t m_mask = 0;
+            std::unique_ptr<Cell[]> m_cells;
+
+            alignas(64) std::atomic<size_t> m_enqueuePos{ 0 };
+            alignas(64) std::atomic<size_t> m_dequeuePos{ 0 };
+            std::atomic<uint64_t> m_reused{ 0 };
+            std::atomic<uint64_t> m_allocated{ 0 };
+        };
+
+        // ========================================
+        // BlockPoolAllocator
+        // std::allocate_shared용 할당자 (제어 블록 + 객체를 BlockPool 블록 하나에)
+        // 풀은 할당자보다 오래 살아야 함 (보통 프로세스 수명 동안 유지)
+        // ========================================
+        template<typename T>
+        class BlockPoolAllocator {
+        public:
+            using value_type = T;
+
+            explicit BlockPoolAllocator(BlockPool& pool) noexcept : m_pool(&pool) {}
+
+            template<typename U>
+            BlockPoolAllocator(const BlockPoolAllocator<U>& other) noexcept : m_pool(other.pool()) {}
+
+            T* allocate(size_t count) {
+                return static_cast<T*>(m_pool->allocate(count * sizeof(T)));
+            }
+
+            void deallocate(T* pointer, size_t count) noexcept {
+                m_pool->deallocate(pointer, count * sizeof(T));
+            }
+
+            BlockPool* pool() const noexcept { return m_pool; }
+
+            template<typename U>
+            bool operator==(const BlockPoolAllocator<U>& other) const noexcept { return m_pool == other.pool(); }
+            template<typename U>
+            bool operator!=(const BlockPoolAllocator<U>& other) const noexcept { return m_pool != other.pool(); }
+
+        private:
+            BlockPool* m_pool;
+        };
+
+    } // namespace Server
+} // namespace Blokus
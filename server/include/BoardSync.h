@@ -0,0 +1,52 @@
+#pragma once
+
+#include "GameLogic.h"
+#include "MessageWriter.h"
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+namespace Blokus {
+    namespace Server {
+
+        // ========================================
+        // BoardSync 클래스
+        // 보드 변경(블록 배치)마다 순번을 매기고 위치 해시를 누적 관리
+        // - 해시: 점유된 칸마다 cellKey(행, 열, 색상)를 XOR (배치된 칸만 갱신하면 되는 누적 해시)
+        // - 클라이언트는 BLOCK_PLACED의 seq/hash와 자기 보드 해시를 비교해 어긋남을 감지
+        // - 압축 스냅샷: 점유 비트맵 400비트 + 점유 칸마다 색상 2비트, base64 문자열
+        // - 스레드 안전하지 않음 (GameRoom은 m_playersMutex 안에서만 사용)
+        // ========================================
+        class BoardSync {
+        public:
+            BoardSync();
+
+            // 새 게임 (빈 보드, 순번 0)
+            void reset();
+
+            // 블록 배치 반영 (새 순번 반환)
+            uint64_t applyPlacement(const Common::PositionList& cells, Common::PlayerColor color);
+
+            uint64_t getSeq() const { return m_hashes.size() - 1; }
+            uint64_t getHash() const { return m_hashes.back(); }
+
+            // 클라이언트가 보고한 (순번, 해시)가 그 순번 시점의 보드와 같은지
+            // (아직 도착하지 않은 배치가 있어 순번이 뒤처진 경우도 일치로 판단)
+            bool matches(uint64_t seq, uint64_t hash) const;
+
+            static uint64_t cellKey(int row, int col, Common::PlayerColor color);
+            static uint64_t computeHash(const Common::GameLogic& logic);
+
+            // 16자리 소문자 16진수
+            static void writeHash(MessageWriter& writer, uint64_t hash);
+            static bool parseHash(std::string_view text, uint64_t& hash);
+
+            // 압축 보드 (따옴표 없는 base64)
+            static void writePackedBoard(MessageWriter& writer, const Common::GameLogic& logic);
+
+        private:
+            std::vector<uint64_t> m_hashes;     // m_hashes[seq] = 해당 순번 직후의 보드 해시
+        };
+
+    } // namespace Server
+} // namespace Blokus
@@ -0,0 +1,84 @@
+#pragma once
+
+#include "MessageWriter.h"
+#include "TokenBucket.h"
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/steady_timer.hpp>
+#include <chrono>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Blokus {
+    namespace Server {
+
+        class Session;
+        using SessionPtr = std::shared_ptr<Session>;
+
+        // ========================================
+        // ChatService 클래스
+        // 로비 채팅 팬아웃 파이프라인
+        // - 사용자별 토큰 버킷으로 도배 차단 (방 채팅 포함)
+        // - 로비 채팅은 짧은 구간(CHAT_BATCH_WINDOW_MS) 동안 모아 수신자마다 프레임 1개로 전송
+        //   (메시지마다 전체 세션을 순회하던 N^2 쓰기를 구간당 1회 순회로 줄임)
+        // - 최근 로비 채팅을 고정 크기 링에 보관해 새로 들어온 사용자에게 전송
+        // ========================================
+        class ChatService {
+        public:
+            struct Options {
+                int ratePerSecond = 2;                          // 초당 충전되는 메시지 수
+                int burst = 5;                                  // 버킷 크기 (연속 전송 허용량)
+                std::chrono::milliseconds batchWindow{ 50 };
+                size_t historySize = 50;
+            };
+
+            // 배치 전송 시점의 로비 사용자 (GameServer::getActualLobbyUsers)
+            using LobbyMembersProvider = std::function<std::vector<SessionPtr>()>;
+
+            ChatService(boost::asio::io_context& ioContext, const Options& options, LobbyMembersProvider provider);
+            ~ChatService();
+
+            ChatService(const ChatService&) = delete;
+            ChatService& operator=(const ChatService&) = delete;
+
+            // 토큰 하나 사용 (false면 전송 한도 초과)
+            bool tryConsume(const std::string& userId);
+
+            // 로비 채팅 등록 ("CHAT:..." 한 줄, 다음 배치에 포함)
+            void publishLobby(std::string chatLine);
+
+            // 최근 로비 채팅 전송 (CHAT_HISTORY:개수 + CHAT 줄들을 프레임 1개로)
+            void sendHistory(const SessionPtr& session) const;
+
+            // 가득 찬 버킷 정리 (하트비트에서 호출)
+            size_t pruneIdleBuckets();
+
+            void stop();
+
+        private:
+            void scheduleFlushLocked();
+            void flush();
+
+        private:
+            const Options m_options;
+            LobbyMembersProvider m_lobbyMembersProvider;
+
+            // 토큰 버킷
+            std::unordered_map<std::string, TokenBucket> m_buckets;
+            std::mutex m_bucketsMutex;
+
+            // 대기 중인 로비 채팅 + 최근 기록 (타이머 예약/취소도 같은 뮤텍스 안에서)
+            std::vector<std::string> m_pending;
+            std::deque<std::string> m_history;
+            boost::asio::steady_timer m_flushTimer;
+            bool m_flushScheduled = false;
+            bool m_stopped = false;
+            mutable std::mutex m_mutex;
+        };
+
+    } // namespace Server
+} // namespace Blokus
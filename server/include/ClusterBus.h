@@ -0,0 +1,152 @@
+#pragma once
+
+#include <boost/asio.hpp>
+#include <atomic>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace Blokus {
+    namespace Server {
+
+        // ========================================
+        // 클러스터 버스 메시지
+        // 전송 형식: 한 줄에 "보낸노드\t토픽\t페이로드\n" (각 필드의 \\, \t, \n은 이스케이프)
+        // ========================================
+        struct ClusterMessage {
+            std::string source;     // 보낸 노드 ID
+            std::string topic;
+            std::string payload;
+
+            std::string encode() const;
+            static bool decode(const std::string& line, ClusterMessage& message);
+        };
+
+        // ========================================
+        // ClusterBus 인터페이스
+        // 노드 사이 브로드캐스트 전달 (보낸 노드 자신에게는 전달하지 않음)
+        // - 같은 노드에서 보낸 메시지는 보낸 순서대로 도착해야 함
+        // - 수신 콜백은 한 번에 하나씩 호출됨 (구현체의 strand에서 실행)
+        // - 연결이 끊겼다 다시 붙으면 onConnected가 다시 호출됨 (상태 재동기화 시점)
+        // ========================================
+        class ClusterBus {
+        public:
+            using MessageHandler = std::function<void(const ClusterMessage&)>;
+            using ConnectedHandler = std::function<void()>;
+
+            virtual ~ClusterBus() = default;
+
+            virtual bool start(MessageHandler onMessage, ConnectedHandler onConnected) = 0;
+            virtual void stop() = 0;
+            virtual void publish(const std::string& topic, const std::string& payload) = 0;
+            virtual bool isConnected() const = 0;
+        };
+
+        // ========================================
+        // InProcessClusterBus
+        // 같은 프로세스 안의 노드끼리 메모리로 전달하는 대역 브로커 (단일 프로세스 실행/로컬 검증용)
+        // ========================================
+        class InProcessClusterBus : public ClusterBus {
+        public:
+            InProcessClusterBus(boost::asio::io_context& ioContext, std::string nodeId);
+            ~InProcessClusterBus() override;
+
+            bool start(MessageHandler onMessage, ConnectedHandler onConnected) override;
+            void stop() override;
+            void publish(const std::string& topic, const std::string& payload) override;
+            bool isConnected() const override { return m_attached.load(); }
+
+        private:
+            struct Endpoint;
+            struct Hub;
+            static Hub& hub();
+
+        private:
+            const std::string m_nodeId;
+            std::shared_ptr<Endpoint> m_endpoint;
+            std::atomic<bool> m_attached{ false };
+        };
+
+        // ========================================
+        // TcpClusterBus
+        // ClusterBroker(중계 서버)에 TCP로 붙는 버스 클라이언트
+        // - 끊기면 일정 간격으로 재접속, 연결 전 발행분은 제한된 큐에 보관
+        // - 여러 프로세스를 루프백으로 묶어 로컬에서 클러스터 모드를 검증할 수 있음
+        // ========================================
+        class TcpClusterBus : public ClusterBus, public std::enable_shared_from_this<TcpClusterBus> {
+        public:
+            TcpClusterBus(boost::asio::io_context& ioContext, std::string nodeId, std::string brokerHost, int brokerPort);
+            ~TcpClusterBus() override;
+
+            bool start(MessageHandler onMessage, ConnectedHandler onConnected) override;
+            void stop() override;
+            void publish(const std::string& topic, const std::string& payload) override;
+            bool isConnected() const override { return m_connected.load(); }
+
+        private:
+            void connect();
+            void scheduleReconnect();
+            void startRead();
+            void startWrite();
+            void handleDisconnect(const boost::system::error_code& error);
+
+        private:
+            const std::string m_nodeId;
+            const std::string m_brokerHost;
+            const int m_brokerPort;
+
+            boost::asio::strand<boost::asio::io_context::executor_type> m_strand;
+            boost::asio::ip::tcp::resolver m_resolver;
+            boost::asio::ip::tcp::socket m_socket;
+            boost::asio::steady_timer m_reconnectTimer;
+            boost::asio::streambuf m_readBuffer;
+
+            // m_strand에서만 접근
+            std::deque<std::string> m_writeQueue;
+            bool m_writing = false;
+
+            MessageHandler m_onMessage;
+            ConnectedHandler m_onConnected;
+            std::atomic<bool> m_running{ false };
+            std::atomic<bool> m_connected{ false };
+        };
+
+        // ========================================
+        // ClusterBroker
+        // 버스 중계 서버 (받은 줄을 보낸 연결을 제외한 모든 연결에 그대로 전달)
+        // 외부 메시지 브로커 대신 노드 하나가 프로세스 안에서 띄우는 대역
+        // ========================================
+        class ClusterBroker {
+        public:
+            explicit ClusterBroker(boost::asio::io_context& ioContext);
+            ~ClusterBroker();
+
+            bool start(const std::string& bindAddress, int port);
+            void stop();
+
+            size_t getConnectionCount() const;
+
+        private:
+            struct Connection;
+
+            void startAccept();
+            void startRead(const std::shared_ptr<Connection>& connection);
+            void relay(const std::shared_ptr<Connection>& from, const std::shared_ptr<const std::string>& line);
+            void startWrite(const std::shared_ptr<Connection>& connection);
+            void closeConnection(const std::shared_ptr<Connection>& connection);
+            void closeAll();
+
+        private:
+            boost::asio::strand<boost::asio::io_context::executor_type> m_strand;
+            boost::asio::ip::tcp::acceptor m_acceptor;
+            std::atomic<bool> m_running{ false };
+
+            std::vector<std::shared_ptr<Connection>> m_connections;     // m_strand에서만 접근
+            std::atomic<size_t> m_connectionCount{ 0 };
+        };
+
+    } // namespace Server
+} // namespace Blokus
@@ -0,0 +1,135 @@
+#pragma once
+
+#include "ClusterBus.h"
+#include <chrono>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Blokus {
+    namespace Server {
+
+        // ========================================
+        // ClusterManager 클래스
+        // 여러 게임 서버 노드를 하나의 서비스처럼 묶는 조정자 (CLUSTER_ENABLED)
+        // - 방은 만든 노드가 소유 (방 ID 대역을 노드별로 나눔), 다른 노드의 방 참가는 소유 노드로 안내
+        // - 로그인 사용자 / 방 목록 행 / 로비 사용자 목록을 버스로 복제
+        // - 변경은 즉시 이벤트로, 하트비트마다 노드 전체 상태(node.state)로 다시 맞춤 (유실 복구)
+        // - 같은 계정이 두 노드에서 동시에 로그인하면 먼저 로그인한 쪽만 남김 (동시각이면 노드 ID 순)
+        //
+        // 토픽 (페이로드)
+        //   node.hello  ""                              새 노드 합류/재접속 -> 다른 노드가 node.state로 응답
+        //   node.state  "N host port" / "U 사용자ID 로그인시각" / "R 방ID 목록행" / "L 로비행" 줄 목록
+        //   node.leave  ""                              정상 종료
+        //   user.online "사용자ID 로그인시각(ms)"
+        //   user.offline "사용자ID"
+        //   room.upsert "방ID 목록행"
+        //   room.remove "방ID"
+        // ========================================
+        class ClusterManager {
+        public:
+            // 노드 하나가 쓰는 방 ID 대역 크기 (노드 N의 방은 1001 + N * ROOM_ID_STRIDE부터)
+            static constexpr int ROOM_ID_STRIDE = 100000;
+
+            struct Options {
+                std::string nodeId;
+                std::string publicHost;         // 클라이언트가 이 노드로 접속할 주소 (방 이동 안내용)
+                int publicPort = 0;
+                std::chrono::seconds nodeTimeout{ 30 };
+            };
+
+            struct NodeAddress {
+                std::string nodeId;
+                std::string host;
+                int port = 0;
+            };
+
+            // 원격 방 목록 행 반영 (row == nullptr이면 제거)
+            using RoomRowSink = std::function<void(int roomId, const std::string* row)>;
+            // 중복 로그인 경합에서 진 로컬 사용자 (세션 종료는 호출자가 처리)
+            using ConflictHandler = std::function<void(const std::string& userId, const std::string& winnerNodeId)>;
+            // node.state에 실을 로컬 로비 사용자 행 ("username,displayName,level,status")
+            using LobbyRosterProvider = std::function<std::vector<std::string>()>;
+
+            ClusterManager(Options options, std::shared_ptr<ClusterBus> bus);
+            ~ClusterManager();
+
+            ClusterManager(const ClusterManager&) = delete;
+            ClusterManager& operator=(const ClusterManager&) = delete;
+
+            void setRoomRowSink(RoomRowSink sink) { m_roomRowSink = std::move(sink); }
+            void setConflictHandler(ConflictHandler handler) { m_conflictHandler = std::move(handler); }
+            void setLobbyRosterProvider(LobbyRosterProvider provider) { m_lobbyRosterProvider = std::move(provider); }
+
+            bool start();
+            void stop();
+
+            // 로컬 변경 알림
+            void claimUser(const std::string& userId);
+            void releaseUser(const std::string& userId);
+            void publishRoomRow(int roomId, const std::string* row);   // 방 목록 캐시 갱신 시 (nullptr = 제거)
+
+            // 하트비트 (node.state 발행 + 응답 없는 노드 정리)
+            void tick();
+
+            // 조회
+            bool isUserOnRemoteNode(const std::string& userId, std::string* nodeId = nullptr) const;
+            std::optional<NodeAddress> findRoomOwner(int roomId) const;
+            std::vector<std::string> getRemoteLobbyRows() const;
+            size_t getRemoteNodeCount() const;
+            const std::string& getNodeId() const { return m_options.nodeId; }
+
+        private:
+            using Clock = std::chrono::steady_clock;
+
+            struct RemoteNode {
+                std::string host;
+                int port = 0;
+                Clock::time_point lastSeen;
+                std::unordered_map<std::string, uint64_t> users;    // 사용자 ID -> 로그인 시각
+                std::map<int, std::string> rooms;                   // 방 ID -> 목록 행
+                std::vector<std::string> lobbyRows;
+            };
+
+            // 잠금 밖에서 실행할 후속 작업 (방 목록 반영 / 경합 패배 세션 종료)
+            struct PendingActions {
+                std::vector<std::pair<int, std::optional<std::string>>> roomRows;
+                std::vector<std::pair<std::string, std::string>> lostUsers;     // 사용자 ID, 이긴 노드
+            };
+
+            void handleMessage(const ClusterMessage& message);
+            void applyNodeStateLocked(const std::string& nodeId, const std::string& payload, PendingActions& actions);
+            void checkUserClaimLocked(const std::string& nodeId, const std::string& userId, uint64_t claimedAt, PendingActions& actions);
+            void removeNodeLocked(const std::string& nodeId, PendingActions& actions);
+            RemoteNode& touchNodeLocked(const std::string& nodeId);
+            void runActions(PendingActions& actions);
+
+            void publish(const std::string& topic, const std::string& payload);
+            void publishHello();
+            void publishState();
+            std::string buildStatePayload();
+
+            static uint64_t nowMillis();
+
+        private:
+            const Options m_options;
+            std::shared_ptr<ClusterBus> m_bus;
+
+            RoomRowSink m_roomRowSink;
+            ConflictHandler m_conflictHandler;
+            LobbyRosterProvider m_lobbyRosterProvider;
+
+            mutable std::mutex m_mutex;
+            std::unordered_map<std::string, uint64_t> m_localUsers;     // 사용자 ID -> 로그인 시각
+            std::map<int, std::string> m_localRooms;                    // 방 ID -> 목록 행
+            std::unordered_map<std::string, RemoteNode> m_nodes;
+            bool m_running = false;
+        };
+
+    } // namespace Server
+} // namespace Blokus
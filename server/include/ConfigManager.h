@@ -37,6 +37,76 @@ namespace Blokus {
                 serverPort = getEnvInt("SERVER_PORT", 9999);
                 maxClients = getEnvInt("SERVER_MAX_CLIENTS", 1000);
                 threadPoolSize = getEnvInt("SERVER_THREAD_POOL_SIZE", 4);
+                ioModel = getEnvString("IO_MODEL", "per_core");  // per_core | shared
+                networkBackend = getEnvString("NETWORK_BACKEND", "auto");  // auto | epoll | io_uring
+                ioUringRegisteredBuffers = getEnvInt("IO_URING_REGISTERED_BUFFERS", 512);
+
+                // 지표 엔드포인트 (Prometheus, 0이면 비활성화)
+                metricsPort = getEnvInt("METRICS_PORT", 9091);
+                metricsBindAddress = getEnvString("METRICS_BIND_ADDRESS", "127.0.0.1");
+
+                // 추적 스팬 (N개 메시지 중 1개 기록, 0이면 비활성화)
+                traceSampleEvery = getEnvInt("TRACE_SAMPLE_EVERY", 0);
+                traceBufferEvents = getEnvInt("TRACE_BUFFER_EVENTS", 16384);
+
+                // 관전 (방별 관전 채널, 별도 팬아웃 스레드 풀)
+                spectatorEnabled = getEnvBool("SPECTATOR_ENABLED", true);
+                spectatorMaxPerRoom = getEnvInt("SPECTATOR_MAX_PER_ROOM", 500);
+                spectatorFanoutThreads = getEnvInt("SPECTATOR_FANOUT_THREADS", 2);
+                spectatorShardSize = getEnvInt("SPECTATOR_SHARD_SIZE", 64);
+                spectatorMaxPendingFrames = getEnvInt("SPECTATOR_MAX_PENDING_FRAMES", 32);
+                spectatorLogEntries = getEnvInt("SPECTATOR_LOG_ENTRIES", 64);
+
+                // 세션 재개 (연결이 끊긴 방/게임 좌석을 유예 시간 동안 보류)
+                resumeEnabled = getEnvBool("RESUME_ENABLED", true);
+                resumeGraceSeconds = getEnvInt("RESUME_GRACE_SECONDS", 60);
+                resumeReplayEvents = getEnvInt("RESUME_REPLAY_EVENTS", 256);
+
+                // 채팅 (사용자별 전송 한도 + 로비 채팅 배치 전송)
+                chatRatePerSecond = getEnvInt("CHAT_RATE_PER_SECOND", 2);
+                chatBurst = getEnvInt("CHAT_BURST", 5);
+                chatBatchWindowMs = getEnvInt("CHAT_BATCH_WINDOW_MS", 50);
+                chatHistorySize = getEnvInt("CHAT_HISTORY_SIZE", 50);
+
+                // 입장 제어 (리스너의 IP별 연결 속도 / 미인증 세션 수 / 세션별 수신 한도)
+                admissionIpConnectPerMinute = getEnvInt("ADMISSION_IP_CONNECT_PER_MINUTE", 60);
+                admissionIpConnectBurst = getEnvInt("ADMISSION_IP_CONNECT_BURST", 20);
+                admissionMaxUnauthenticated = getEnvInt("ADMISSION_MAX_UNAUTHENTICATED", 256);
+                authIdleDeadlineSeconds = getEnvInt("AUTH_IDLE_DEADLINE_SECONDS", 60);
+                sessionMessageRatePerSecond = getEnvInt("SESSION_MESSAGE_RATE_PER_SECOND", 30);
+                sessionMessageBurst = getEnvInt("SESSION_MESSAGE_BURST", 60);
+                sessionMessageDropLimit = getEnvInt("SESSION_MESSAGE_DROP_LIMIT", 300);
+
+                // 프레임 압축 (협상한 클라이언트에게만 큰 프레임을 deflate + 공유 사전으로 전송)
+                compressionEnabled = getEnvBool("COMPRESSION_ENABLED", true);
+                compressionMinBytes = getEnvInt("COMPRESSION_MIN_BYTES", 512);
+                compressionLevel = getEnvInt("COMPRESSION_LEVEL", 6);
+
+                // 세션 풀 (해제된 세션/읽기 버퍼 블록을 재접속 시 재사용)
+                sessionPoolSize = getEnvInt("SESSION_POOL_SIZE", 1024);
+
+                // 중복 로그인 (같은 IP에서 동시에 로그인할 수 있는 계정 수, 0 = 제한 없음)
+                loginMaxUsersPerIp = getEnvInt("LOGIN_MAX_USERS_PER_IP", 32);
+
+                // 드레인 종료 (SIGTERM 시 진행 중인 방을 파일로 넘겨 다음 프로세스가 이어서 진행)
+                drainOnShutdown = getEnvBool("DRAIN_ON_SHUTDOWN", true);
+                drainSnapshotFile = getEnvString("DRAIN_SNAPSHOT_FILE", "logs/room_migration.dat");
+                drainReconnectHintSeconds = getEnvInt("DRAIN_RECONNECT_HINT_SECONDS", 10);
+                drainFlushTimeoutMs = getEnvInt("DRAIN_FLUSH_TIMEOUT_MS", 3000);
+                drainSnapshotMaxAgeSeconds = getEnvInt("DRAIN_SNAPSHOT_MAX_AGE_SECONDS", 600);
+                migrationSeatGraceSeconds = getEnvInt("MIGRATION_SEAT_GRACE_SECONDS", 120);
+
+                // 클러스터 (여러 노드가 버스로 로그인 사용자/방 목록을 공유)
+                clusterEnabled = getEnvBool("CLUSTER_ENABLED", false);
+                clusterNodeIndex = getEnvInt("CLUSTER_NODE_INDEX", 0);
+                clusterNodeId = getEnvString("CLUSTER_NODE_ID", ("node-" + std::to_string(clusterNodeIndex)).c_str());
+                clusterPublicHost = getEnvString("CLUSTER_PUBLIC_HOST", "127.0.0.1");
+                clusterBus = getEnvString("CLUSTER_BUS", "tcp");
+                clusterBusHost = getEnvString("CLUSTER_BUS_HOST", "127.0.0.1");
+                clusterBusPort = getEnvInt("CLUSTER_BUS_PORT", 9990);
+                clusterBrokerListen = getEnvBool("CLUSTER_BROKER_LISTEN", false);
+                clusterBrokerBindAddress = getEnvString("CLUSTER_BROKER_BIND_ADDRESS", "127.0.0.1");
+                clusterNodeTimeoutSeconds = getEnvInt("CLUSTER_NODE_TIMEOUT_SECONDS", 30);
 
                 // 데이터베이스 설정
                 dbHost = getEnvString("DB_HOST", "localhost");
@@ -45,15 +115,34 @@ namespace Blokus {
                 dbPassword = getEnvString("DB_PASSWORD", "admin");
                 dbName = getEnvString("DB_NAME", "blokus_online");
                 dbPoolSize = getEnvInt("DB_POOL_SIZE", 10);
+                dbExecutorThreads = getEnvInt("DB_EXECUTOR_THREADS", 4);
+
+                // 게임 결과 저장 큐 설정
+                gameResultBatchSize = getEnvInt("GAME_RESULT_BATCH_SIZE", 64);
+                gameResultFlushIntervalMs = getEnvInt("GAME_RESULT_FLUSH_INTERVAL_MS", 1000);
+                gameResultMaxRetries = getEnvInt("GAME_RESULT_MAX_RETRIES", 5);
+                gameResultSpillFile = getEnvString("GAME_RESULT_SPILL_FILE", "logs/pending_game_results.dat");
+                userStatsCacheMaxEntries = getEnvInt("USER_STATS_CACHE_MAX_ENTRIES", 10000);
 
                 // 보안 설정
                 jwtSecret = getEnvString("JWT_SECRET", "thissecretisonlyusedfordevelopmentenviromenttest");
                 sessionTimeoutHours = getEnvInt("SESSION_TIMEOUT_HOURS", 24);
                 passwordSaltRounds = getEnvInt("PASSWORD_SALT_ROUNDS", 12);
 
+                // JWT 검증 캐시 / JWKS 새로고침 설정
+                jwtCacheMaxEntries = getEnvInt("JWT_CACHE_MAX_ENTRIES", 4096);
+                jwksRefreshIntervalSec = getEnvInt("JWKS_REFRESH_INTERVAL_SEC", 300);
+
+                // 암호 작업(Argon2) 실행기 설정
+                cryptoThreads = getEnvInt("CRYPTO_THREADS", 2);
+                cryptoQueueLimit = getEnvInt("CRYPTO_QUEUE_LIMIT", 64);
+                cryptoPerClientLimit = getEnvInt("CRYPTO_PER_CLIENT_LIMIT", 2);
+
                 // 로깅 설정
                 logLevel = getEnvString("LOG_LEVEL", "info");
                 logDirectory = getEnvString("LOG_DIRECTORY", "logs");
+                logAsync = getEnvBool("LOG_ASYNC", true);
+                logQueueSize = getEnvInt("LOG_QUEUE_SIZE", 8192);
 
                 // 개발 설정
                 debugMode = getEnvBool("DEBUG_MODE", true);
@@ -107,6 +196,74 @@ namespace Blokus {
             static int serverPort;
             static int maxClients;
             static int threadPoolSize;
+            static std::string ioModel;
+            static std::string networkBackend;
+            static int ioUringRegisteredBuffers;
+
+            // 지표 관련
+            static int metricsPort;
+            static std::string metricsBindAddress;
+            static int traceSampleEvery;
+            static int traceBufferEvents;
+
+            // 관전 관련
+            static bool spectatorEnabled;
+            static int spectatorMaxPerRoom;
+            static int spectatorFanoutThreads;
+            static int spectatorShardSize;
+            static int spectatorMaxPendingFrames;
+            static int spectatorLogEntries;
+
+            // 세션 재개 관련
+            static bool resumeEnabled;
+            static int resumeGraceSeconds;
+            static int resumeReplayEvents;     // 방별 재전송용 이벤트 로그 크기
+
+            // 채팅 관련
+            static int chatRatePerSecond;
+            static int chatBurst;                      // 연속으로 보낼 수 있는 메시지 수
+            static int chatBatchWindowMs;              // 로비 채팅을 모아 보내는 구간
+            static int chatHistorySize;                // 새로 들어온 사용자에게 보내는 최근 로비 채팅 수
+
+            // 입장 제어 관련
+            static int admissionIpConnectPerMinute;    // IP별 분당 새 연결 수 (DEBUG_MODE에서는 무시)
+            static int admissionIpConnectBurst;
+            static int admissionMaxUnauthenticated;    // 동시에 열려 있을 수 있는 미인증 세션 수
+            static int authIdleDeadlineSeconds;        // 접속 후 이 시간 안에 로그인하지 않으면 연결 종료 (0 = 끄기)
+            static int sessionMessageRatePerSecond;    // 세션별 초당 수신 메시지 수 (0 = 끄기)
+            static int sessionMessageBurst;
+            static int sessionMessageDropLimit;        // 연속으로 버린 메시지가 이만큼이면 연결 종료
+
+            // 프레임 압축 관련
+            static bool compressionEnabled;
+            static int compressionMinBytes;            // 이보다 큰 프레임만 압축 (줄바꿈 포함)
+            static int compressionLevel;               // zlib 압축 레벨 (1~9)
+
+            // 세션 풀 관련
+            static int sessionPoolSize;                // 보관해 둘 해제된 세션/읽기 버퍼 블록 수 (시작 시 한 번 읽음)
+
+            // 중복 로그인 관련
+            static int loginMaxUsersPerIp;             // NAT/학교망 대비 IP당 로그인 계정 수 (DEBUG_MODE에서는 무시)
+
+            // 드레인 종료 관련
+            static bool drainOnShutdown;
+            static std::string drainSnapshotFile;
+            static int drainReconnectHintSeconds;      // 클라이언트에 안내하는 재접속 대기 시간
+            static int drainFlushTimeoutMs;            // 재접속 안내가 송신 큐에서 모두 나갈 때까지 기다리는 최대 시간
+            static int drainSnapshotMaxAgeSeconds;     // 이보다 오래된 이전 파일은 복원하지 않음
+            static int migrationSeatGraceSeconds;      // 복원된 좌석을 재로그인 전까지 보류하는 시간
+
+            // 클러스터 관련
+            static bool clusterEnabled;
+            static int clusterNodeIndex;               // 방 ID 대역 (노드마다 달라야 함)
+            static std::string clusterNodeId;
+            static std::string clusterPublicHost;      // 다른 노드가 클라이언트를 이 노드로 안내할 때 쓰는 주소
+            static std::string clusterBus;             // "tcp" (ClusterBroker 경유) | "inproc" (단일 프로세스)
+            static std::string clusterBusHost;
+            static int clusterBusPort;
+            static bool clusterBrokerListen;           // 이 노드가 버스 중계 서버를 함께 실행
+            static std::string clusterBrokerBindAddress;
+            static int clusterNodeTimeoutSeconds;
 
             // DB 관련
             static std::string dbHost;
@@ -116,15 +273,34 @@ namespace Blokus {
             static std::string dbName;
             static std::string dbConnectionString;
             static int dbPoolSize;
+            static int dbExecutorThreads;
+
+            // 게임 결과 저장 큐 관련
+            static int gameResultBatchSize;
+            static int gameResultFlushIntervalMs;
+            static int gameResultMaxRetries;
+            static std::string gameResultSpillFile;
+            static int userStatsCacheMaxEntries;
 
             // 인증 및 세션 관련
             static std::string jwtSecret;
             static int sessionTimeoutHours;
             static int passwordSaltRounds;
 
+            // JWT 검증 캐시 관련
+            static int jwtCacheMaxEntries;
+            static int jwksRefreshIntervalSec;
+
+            // 암호 작업 실행기 관련
+            static int cryptoThreads;
+            static int cryptoQueueLimit;
+            static int cryptoPerClientLimit;
+
             // 디버깅 관련
             static std::string logLevel;
             static std::string logDirectory;
+            static bool logAsync;
+            static int logQueueSize;
             static bool debugMode;
             static bool enableSqlLogging;
 
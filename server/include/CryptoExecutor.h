@@ -0,0 +1,118 @@
+#pragma once
+
+#include <boost/asio.hpp>
+#include <spdlog/spdlog.h>
+#include <string>
+#include <vector>
+#include <deque>
+#include <unordered_map>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include <type_traits>
+#include <exception>
+
+namespace Blokus {
+    namespace Server {
+
+        // ========================================
+        // CryptoExecutor 클래스
+        // Argon2 해싱/검증처럼 CPU와 메모리를 크게 쓰는 작업을 I/O 스레드에서 분리하는 전용 워커 풀
+        // - 전체 대기열 깊이 제한, 클라이언트(IP)별 대기 제한 및 라운드로빈 처리
+        // - 포화 시 대기하지 않고 즉시 거절
+        // ========================================
+        class CryptoExecutor {
+        public:
+            // 작업 종류별 지연 시간 통계
+            struct LatencyStats {
+                uint64_t count = 0;
+                double totalWaitMs = 0.0;
+                double totalExecMs = 0.0;
+                double maxWaitMs = 0.0;
+                double maxExecMs = 0.0;
+
+                double avgWaitMs() const { return count > 0 ? totalWaitMs / count : 0.0; }
+                double avgExecMs() const { return count > 0 ? totalExecMs / count : 0.0; }
+            };
+
+            CryptoExecutor(size_t threadCount, size_t maxQueueDepth, size_t maxPerClient);
+            ~CryptoExecutor();
+
+            void shutdown();
+
+            // 작업 등록 (포화 시 false 반환, 작업은 실행되지 않음)
+            bool submit(const std::string& clientKey, const std::string& label, std::function<void()> task);
+
+            // 작업 완료 후 핸들러를 지정한 executor(세션 소켓 등)에서 실행
+            template<typename Work, typename Executor, typename Handler>
+            bool execute(const std::string& clientKey, const std::string& label,
+                Work work, const Executor& completionExecutor, Handler handler);
+
+            // 상태 확인
+            size_t getQueuedCount() const;
+            uint64_t getRejectedCount() const { return m_rejectedCount.load(); }
+            std::unordered_map<std::string, LatencyStats> getLatencyStats() const;
+
+        private:
+            struct Task {
+                std::function<void()> work;
+                std::string label;
+                std::chrono::steady_clock::time_point enqueuedAt;
+            };
+
+            void workerLoop();
+            void recordLatency(const std::string& label, double waitMs, double execMs);
+
+        private:
+            size_t m_threadCount;
+            size_t m_maxQueueDepth;
+            size_t m_maxPerClient;
+
+            // 클라이언트별 대기열 + 라운드로빈 순서
+            std::unordered_map<std::string, std::deque<Task>> m_queues;
+            std::deque<std::string> m_readyClients;
+            size_t m_queuedCount = 0;
+            mutable std::mutex m_queueMutex;
+            std::condition_variable m_queueCv;
+
+            std::vector<std::thread> m_workers;
+            std::atomic<bool> m_shouldStop{ false };
+
+            // 지표
+            std::atomic<uint64_t> m_rejectedCount{ 0 };
+            std::unordered_map<std::string, LatencyStats> m_latency;
+            mutable std::mutex m_metricsMutex;
+        };
+
+        // ========================================
+        // 템플릿 구현
+        // ========================================
+
+        template<typename Work, typename Executor, typename Handler>
+        bool CryptoExecutor::execute(const std::string& clientKey, const std::string& label,
+            Work work, const Executor& completionExecutor, Handler handler) {
+            using Result = std::invoke_result_t<Work>;
+            static_assert(!std::is_void_v<Result>, "CryptoExecutor::execute 작업은 결과를 반환해야 합니다");
+
+            return submit(clientKey, label,
+                [work = std::move(work), completionExecutor, handler = std::move(handler), label]() mutable {
+                    Result result{};
+                    try {
+                        result = work();
+                    }
+                    catch (const std::exception& e) {
+                        spdlog::error("암호 작업 중 예외 ({}): {}", label, e.what());
+                    }
+                    boost::asio::post(completionExecutor,
+                        [handler = std::move(handler), result = std::move(result)]() mutable {
+                            handler(std::move(result));
+                        });
+                });
+        }
+
+    } // namespace Server
+} // namespace Blokus
@@ -0,0 +1,126 @@
+#pragma once
+
+#include "DatabaseManager.h"
+#include "ServerMetrics.h"
+#include "Tracing.h"
+#include <boost/asio.hpp>
+#include <spdlog/spdlog.h>
+#include <memory>
+#include <future>
+#include <atomic>
+#include <type_traits>
+#include <exception>
+
+namespace Blokus {
+    namespace Server {
+
+        // ========================================
+        // DatabaseExecutor 클래스
+        // libpqxx 블로킹 I/O를 전용 스레드 풀에서 실행하여 io_context 워커를 점유하지 않도록 함
+        // ========================================
+        class DatabaseExecutor {
+        public:
+            DatabaseExecutor(std::shared_ptr<DatabaseManager> dbManager, size_t threadCount);
+            ~DatabaseExecutor();
+
+            void shutdown();
+
+            // 작업 결과를 future로 반환
+            template<typename Work>
+            auto submit(Work work) -> std::future<std::invoke_result_t<Work, DatabaseManager&>>;
+
+            // 작업 완료 후 핸들러를 지정한 executor(세션 소켓 등)에서 실행
+            // 작업이 예외를 던지면 DatabaseManager 규약대로 기본값(nullopt/false/빈 목록)을 전달
+            template<typename Work, typename Executor, typename Handler>
+            void execute(Work work, const Executor& completionExecutor, Handler handler);
+
+            // 상태 확인
+            size_t getPendingCount() const { return m_pendingCount.load(); }
+            size_t getThreadCount() const { return m_threadCount; }
+
+        private:
+            // 작업 실행 시간을 DB 지표에 기록 (예외로 빠져나가도 기록되도록 RAII)
+            struct QueryTimer {
+                std::chrono::steady_clock::time_point startedAt = std::chrono::steady_clock::now();
+                ~QueryTimer() {
+                    ServerMetrics::instance().dbQueryTime.recordDuration(std::chrono::steady_clock::now() - startedAt);
+                }
+            };
+
+        private:
+            std::shared_ptr<DatabaseManager> m_dbManager;
+            size_t m_threadCount;
+            boost::asio::thread_pool m_pool;
+            std::atomic<size_t> m_pendingCount{ 0 };
+            std::atomic<bool> m_isShutdown{ false };
+        };
+
+        // ========================================
+        // 템플릿 구현
+        // ========================================
+
+        template<typename Work>
+        auto DatabaseExecutor::submit(Work work) -> std::future<std::invoke_result_t<Work, DatabaseManager&>> {
+            using Result = std::invoke_result_t<Work, DatabaseManager&>;
+
+            auto task = std::make_shared<std::packaged_task<Result()>>(
+                [dbManager = m_dbManager, work = std::move(work), traceContext = Tracer::currentContext()]() mutable {
+                    TraceContextScope traceScope(traceContext);
+                    TraceSpan span("DatabaseExecutor::job");
+                    QueryTimer timer;
+                    return work(*dbManager);
+                });
+            auto future = task->get_future();
+
+            ++m_pendingCount;
+            boost::asio::post(m_pool, [this, task]() {
+                (*task)();
+                --m_pendingCount;
+            });
+
+            return future;
+        }
+
+        template<typename Work, typename Executor, typename Handler>
+        void DatabaseExecutor::execute(Work work, const Executor& completionExecutor, Handler handler) {
+            using Result = std::invoke_result_t<Work, DatabaseManager&>;
+
+            ++m_pendingCount;
+            boost::asio::post(m_pool,
+                [this, dbManager = m_dbManager, work = std::move(work),
+                 completionExecutor, handler = std::move(handler), traceContext = Tracer::currentContext()]() mutable {
+                    // 요청을 보낸 메시지의 추적에 DB 작업 스팬을 이어 붙임
+                    TraceContextScope traceScope(traceContext);
+                    if constexpr (std::is_void_v<Result>) {
+                        try {
+                            TraceSpan span("DatabaseExecutor::job");
+                            QueryTimer timer;
+                            work(*dbManager);
+                        }
+                        catch (const std::exception& e) {
+                            spdlog::error("DB 비동기 작업 중 예외: {}", e.what());
+                        }
+                        --m_pendingCount;
+                        boost::asio::post(completionExecutor, std::move(handler));
+                    }
+                    else {
+                        Result result{};
+                        try {
+                            TraceSpan span("DatabaseExecutor::job");
+                            QueryTimer timer;
+                            result = work(*dbManager);
+                        }
+                        catch (const std::exception& e) {
+                            spdlog::error("DB 비동기 작업 중 예외: {}", e.what());
+                        }
+                        --m_pendingCount;
+                        boost::asio::post(completionExecutor,
+                            [handler = std::move(handler), result = std::move(result)]() mutable {
+                                handler(std::move(result));
+                            });
+                    }
+                });
+        }
+
+    } // namespace Server
+} // namespace Blokus
@@ -32,6 +32,20 @@ namespace Blokus {
             double getAverageScore() const;
         };
 
+        //  로그인 시 한 번에 조회하는 계정 + 설정
+        struct UserProfile {
+            UserAccount account;
+            std::optional<UserSettings> settings;  // 설정 레코드가 없으면 nullopt
+        };
+
+        //  게임 결과 배치 저장용 행 (플레이어 1명 = 1행)
+        struct GameResultRow {
+            uint32_t userId;
+            int score;
+            bool won;
+            int expGained;       // 게임 미완료자는 0
+        };
+
         //  시스템 통계 구조체
         struct DatabaseStats {
             int totalUsers;
@@ -62,6 +76,8 @@ namespace Blokus {
             std::optional<UserAccount> getUserByUsername(const std::string& username);
             std::optional<UserAccount> getUserByDisplayName(const std::string& displayName);
             std::optional<UserAccount> getUserById(uint32_t userId);
+            std::vector<UserAccount> getUsersByIds(const std::vector<uint32_t>& userIds);
+            std::optional<UserProfile> getUserProfileByUsername(const std::string& username);  // 계정 + 설정 (단일 왕복)
 
             // 사용자 생성/수정
             bool createUser(const std::string& username, const std::string& passwordHash);
@@ -85,10 +101,13 @@ namespace Blokus {
                                const std::vector<bool>& isWinner,
                                bool isDraw = false);
             
+            // 여러 게임 결과를 유저당 1행으로 합산하여 단일 트랜잭션으로 저장 (통계 + 경험치 + 레벨업)
+            bool saveGameResultsBatch(const std::vector<GameResultRow>& rows);
+            
             // 경험치 및 레벨 시스템
             bool updatePlayerExperience(uint32_t userId, int expGained);
             bool checkAndProcessLevelUp(uint32_t userId);
-            int getRequiredExpForLevel(int level) const;
+            static int getRequiredExpForLevel(int level);   // 고정 공식 (DB 조회 없음, I/O 스레드에서 호출 가능)
             int calculateExperienceGain(bool won, int score, bool completedGame) const;
 
             // ========================================
@@ -0,0 +1,50 @@
+#pragma once
+
+#include "MessageWriter.h"
+#include <memory>
+#include <string>
+#include <string_view>
+#include <zlib.h>
+
+namespace Blokus {
+    namespace Server {
+
+        // ========================================
+        // FrameCompressor 클래스
+        // 협상한 클라이언트에게 보내는 큰 프레임의 프레임 단위 압축 (raw deflate + 공유 사전)
+        // - 전송 형식: "Z:" + base64(raw deflate(마지막 줄바꿈 제외 원문)) + "\n"
+        // - 묶음 프레임(채팅 묶음 등)은 통째로 압축되므로 받는 쪽은 inflate 결과를 다시 줄 단위로 나눔
+        // - 프레임마다 독립 압축 (앞 프레임 문맥을 쓰지 않음) -> 받는 쪽은 순서와 상관없이 프레임별 inflate
+        // - 결과가 세션과 무관하므로 스레드별 컨텍스트를 재사용하고, 같은 브로드캐스트 프레임은 한 번만 압축
+        // - 압축해도 원문보다 작지 않으면 nullptr (원문 그대로 전송)
+        // - 스레드 안전하지 않음 (forThisThread()로 스레드마다 하나)
+        // ========================================
+        class FrameCompressor {
+        public:
+            // 협상 코덱 이름 (사전이 바뀌면 d2, d3 ...으로 올리고 이전 이름은 거절)
+            static constexpr std::string_view CODEC = "deflate-d1";
+            static constexpr std::string_view PREFIX = "Z:";
+
+            explicit FrameCompressor(int level);
+            ~FrameCompressor();
+
+            FrameCompressor(const FrameCompressor&) = delete;
+            FrameCompressor& operator=(const FrameCompressor&) = delete;
+
+            SharedFrame compress(const SharedFrame& frame);
+
+            static std::string_view dictionary();
+            static FrameCompressor& forThisThread();
+
+        private:
+            z_stream m_stream{};
+            bool m_ready = false;
+            std::string m_deflated;                     // 재사용 버퍼
+
+            // 직전 프레임 결과 (브로드캐스트 루프에서 같은 프레임이 연속으로 들어옴)
+            std::weak_ptr<const std::string> m_lastSource;
+            SharedFrame m_lastResult;
+        };
+
+    } // namespace Server
+} // namespace Blokus
@@ -0,0 +1,98 @@
+#pragma once
+
+#include "DatabaseManager.h"
+#include <string>
+#include <vector>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include <optional>
+
+namespace Blokus {
+    namespace Server {
+
+        class Session;
+        class UserStatsCache;
+
+        // 저장 대기 중인 게임 1판의 결과
+        struct PendingGameResult {
+            int roomId = 0;
+            std::vector<GameResultRow> rows;
+            std::vector<std::weak_ptr<Session>> sessions; // rows와 같은 순서, 저장 후 세션 계정 동기화용
+            int attempts = 0;
+            bool appliedToCache = false;  // UserStatsCache에 반영됨 (이전 실행의 스필 복구분은 false)
+            std::vector<bool> countedInCache; // rows와 같은 순서, 캐시의 미반영 카운트를 올린 행
+        };
+
+        // ========================================
+        // GameResultPersister 클래스
+        // 게임 종료 경로에서 DB 대기를 제거하기 위한 비동기 배치 저장 큐
+        // ========================================
+        class GameResultPersister {
+        public:
+            explicit GameResultPersister(std::shared_ptr<DatabaseManager> dbManager);
+            ~GameResultPersister();
+
+            // 초기화/정리 (초기화 시 이전 실행의 스필 파일 복구)
+            bool initialize();
+            void shutdown();
+
+            // 사용자 통계 캐시 연결 (initialize 전에 설정)
+            void setUserStatsCache(std::shared_ptr<UserStatsCache> statsCache) { m_statsCache = statsCache; }
+
+            // 게임 결과 등록 (DB I/O 없이 즉시 반환, 캐시와 접속 중인 세션은 즉시 갱신)
+            void enqueue(PendingGameResult result);
+
+            // 주기를 기다리지 않고 즉시 플러시 요청 (로그아웃 등)
+            void requestFlush();
+
+            // 상태 확인
+            size_t getPendingCount() const;
+            uint64_t getSpilledCount() const { return m_spilledCount.load(); }
+
+        private:
+            // 워커
+            void workerLoop();
+            bool flushBatch(const std::vector<PendingGameResult>& batch);
+            void syncSessions(const std::vector<PendingGameResult>& batch);
+
+            // 디스크 스필 (DB 장애 시 유실 방지)
+            void spillToDisk(const std::vector<PendingGameResult>& batch);
+            size_t recoverSpilledResults();
+            std::string serializeResult(const PendingGameResult& result) const;
+            std::optional<PendingGameResult> deserializeResult(const std::string& line) const;
+
+        private:
+            std::shared_ptr<DatabaseManager> m_dbManager;
+            std::shared_ptr<UserStatsCache> m_statsCache;
+
+            // 설정
+            size_t m_batchSize;
+            std::chrono::milliseconds m_flushInterval;
+            int m_maxRetries;
+            std::string m_spillPath;
+            uint64_t m_instanceId;  // 스필 줄의 캐시 반영 정보가 이 프로세스 것인지 구분
+
+            // 대기 큐
+            std::deque<PendingGameResult> m_queue;
+            mutable std::mutex m_queueMutex;
+            std::condition_variable m_queueCv;
+            bool m_flushRequested = false;
+
+            // 스필 파일
+            std::mutex m_spillMutex;
+            std::atomic<bool> m_hasSpilledResults{ false };
+            std::atomic<uint64_t> m_spilledCount{ 0 };
+
+            // 상태
+            std::atomic<bool> m_isInitialized{ false };
+            std::atomic<bool> m_shouldStop{ false };
+            std::unique_ptr<std::thread> m_workerThread;
+        };
+
+    } // namespace Server
+} // namespace Blokus
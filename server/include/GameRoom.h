@@ -4,6 +4,9 @@
 #include "GameLogic.h"
 #include "Session.h"
 #include "PlayerInfo.h"  //  새로 추가: 별도 헤더 사용
+#include "MessageWriter.h"
+#include "SpectatorChannel.h"
+#include "BoardSync.h"
 #include <vector>
 #include <unordered_map>
 #include <mutex>
@@ -12,6 +15,8 @@
 #include <string>
 #include <thread>
 #include <atomic>
+#include <deque>
+#include <optional>
 
 namespace Blokus {
     namespace Server {
@@ -69,6 +74,8 @@ namespace Blokus {
             std::string getHostName() const;
             bool isPrivate() const { return m_isPrivate; }
             const std::string& getPassword() const { return m_password; }
+            bool allowsSpectators() const { return m_allowSpectators; }
+            void setAllowSpectators(bool allow) { m_allowSpectators = allow; }   // 방 목록에 등록하기 전에만 호출
 
             // 게임 제어
             bool startGame();
@@ -109,11 +116,44 @@ namespace Blokus {
             // 메시지 전송
             void broadcastMessage(const std::string& message, const std::string& excludeUserId = "");
             void broadcastMessageLocked(const std::string& message, const std::string& excludeUserId = "");
+            void broadcastFrameLocked(const SharedFrame& frame, const std::string& excludeUserId = "");
             void sendToPlayer(const std::string& userId, const std::string& message);
             void sendToHost(const std::string& message);
 
             // 방 정보 생성
             Common::RoomInfo getRoomInfo() const;
+            void publishRoomListEntry(bool insertIfMissing = false); // RoomManager 방 목록 캐시 갱신
+
+            // 관전 채널 (관전 비활성화 시 nullptr)
+            SpectatorChannelPtr getSpectatorChannel() const;
+            void closeSpectators();
+
+            // 세션 재개: 보류된 좌석에 새 세션을 연결하고 놓친 방 이벤트만 재전송
+            // (clientSeq: 클라이언트가 마지막으로 받은 방 이벤트 순번, 없으면 이전 연결의 전송 완료 순번 사용)
+            // (로그에서 이미 밀려난 구간이면 ROOM_SNAPSHOT 전체 상태로 대체)
+            enum class ResumeOutcome {
+                NotInRoom,
+                Replayed,
+                Resynced
+            };
+            ResumeOutcome resumePlayer(const std::string& userId, SessionPtr session, size_t& replayedCount,
+                std::optional<uint64_t> clientSeq = std::nullopt);
+
+            // 보드 동기화: 클라이언트가 보고한 (순번, 해시)를 검증하고 어긋나면 BOARD_SNAPSHOT 전송
+            enum class BoardSyncResult {
+                NotPlaying,
+                InSync,
+                Resynced
+            };
+            BoardSyncResult verifyBoardSync(SessionPtr session, uint64_t seq, uint64_t hash);
+            bool sendBoardSnapshot(SessionPtr session);   // 게임 중이 아니면 false
+
+            // 무중단 배포: 진행 중인 게임을 스냅샷(JSON 한 줄)으로 내보내고 새 프로세스에서 이어서 진행
+            // - 내보낸 방은 이후 배치/스킵/타임아웃을 처리하지 않음 (스냅샷 이후 변경 유실 방지)
+            // - 복원된 좌석은 플레이어가 다시 로그인할 때까지 세션 없이 유지
+            std::string exportMigrationSnapshot();     // 게임 중이 아니면 빈 문자열
+            static std::shared_ptr<GameRoom> fromMigrationSnapshot(const std::string& snapshot, RoomManager* roomManager);
+            bool isMigratedOut() const { return m_migratedOut; }
 
             //  변경: PlayerInfo 벡터 반환
             std::vector<PlayerInfo> getPlayerList() const;
@@ -160,6 +200,29 @@ namespace Blokus {
             std::vector<PlayerInfo> m_players;
             mutable std::mutex m_playersMutex;
 
+            // 게임 진행 브로드캐스트 직렬화용 재사용 버퍼 (m_playersMutex 보호)
+            MessageWriter m_messageWriter;
+
+            // 관전 채널 (m_playersMutex 보호, 브로드캐스트 프레임을 그대로 로그에 추가)
+            SpectatorChannelPtr m_spectators;
+
+            // 세션 재개용 방 이벤트 로그 (m_playersMutex 보호, 최근 m_eventLogCapacity개만 유지)
+            struct RoomEvent {
+                uint64_t seq;
+                SharedFrame frame;
+                std::string excludeUserId;
+            };
+            std::deque<RoomEvent> m_eventLog;
+            uint64_t m_eventSeq = 0;
+            size_t m_eventLogCapacity = 0;
+
+            // 보드 변경 순번 + 위치 해시 (m_playersMutex 보호)
+            BoardSync m_boardSync;
+
+            // 이번 게임의 배치 기록 (방 이전 시 새 프로세스에서 그대로 재실행, m_playersMutex 보호)
+            std::vector<Common::BlockPlacement> m_placementHistory;
+            std::atomic<bool> m_migratedOut{ false };
+
             // 게임 로직
             std::unique_ptr<Common::GameLogic> m_gameLogic;
             std::unique_ptr<Common::GameStateManager> m_gameStateManager;
@@ -188,6 +251,7 @@ namespace Blokus {
             bool m_isPrivate;
             std::string m_password;
             int m_maxPlayers;
+            bool m_allowSpectators;     // 관전 허용 (Common::GameSettings::allowSpectators, 생성 시 지정)
             
             // 기존 게임 결과 응답 추적 변수들 제거됨 - 즉시 초기화 방식으로 변경
             
@@ -201,6 +265,17 @@ namespace Blokus {
             void saveGameResultsToDatabase(const std::map<Common::PlayerColor, int>& finalScores, 
                                          const std::vector<Common::PlayerColor>& winners);
 
+            // 방 정보 생성 (뮤텍스 잠금 상태에서)
+            Common::RoomInfo getRoomInfoLocked() const;
+
+            // 전체 상태 스냅샷 직렬화 (m_messageWriter 사용) / 관전자용 발행 (뮤텍스 잠금 상태에서)
+            void writeRoomSnapshotLocked(std::string_view prefix);
+            void publishSpectatorSnapshotLocked();
+            void writeBoardSnapshotLocked();
+
+            // 방 이전 스냅샷 복원 (뮤텍스 잠금 상태에서)
+            bool restoreMigrationSnapshotLocked(const nlohmann::json& snapshot);
+
             // 색상 배정
             void assignPlayerColor(PlayerInfo& player);
             Common::PlayerColor getNextAvailableColor() const;
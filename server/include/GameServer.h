@@ -7,6 +7,7 @@
 #include <unordered_map>
 #include <unordered_set>
 #include <mutex>
+#include <condition_variable>
 #include <optional>
 #include <boost/asio.hpp>
 #include <spdlog/spdlog.h>
@@ -14,6 +15,7 @@
 // 기존 정의된 타입들 사용
 #include "ServerTypes.h"
 #include "ConfigManager.h"
+#include "ActiveLoginIndex.h"
 #include "Types.h"
 
 // 전방 선언
@@ -24,6 +26,18 @@ namespace Blokus::Server {
     class AuthenticationService;
     class MessageHandler;
     class VersionManager;
+    class GameResultPersister;
+    class DatabaseExecutor;
+    class UserStatsCache;
+    class CryptoExecutor;
+    class RegisteredBufferPool;
+    class IoContextPool;
+    class MetricsEndpoint;
+    class SessionResumeRegistry;
+    class ClusterManager;
+    class ClusterBroker;
+    class ChatService;
+    class AdmissionController;
 
     struct AuthResult;
     struct RegisterResult;
@@ -42,6 +56,13 @@ namespace Blokus::Server {
         void run();
         bool isRunning() const { return running_.load(); }
 
+        // 드레인 종료 (무중단 배포): 새 방 생성 중단 -> 재접속 안내 -> 진행 중인 방을 파일로 넘기고 종료
+        void drain();
+        bool isDraining() const { return draining_.load(); }
+
+        // 종료 요청 (SIGINT/SIGTERM 처리): 요청만 기록하고 드레인/종료는 run()을 실행 중인 스레드가 수행
+        void requestShutdown(bool drainFirst);
+
         // ConfigManager를 통해 설정 접근
         static int getServerPort() { return ConfigManager::serverPort; }
         static int getMaxClients() { return ConfigManager::maxClients; }
@@ -89,6 +110,9 @@ namespace Blokus::Server {
         
         // 실제 로비에만 있는 사용자 조회 - 채팅 브로드캐스팅용
         std::vector<std::shared_ptr<Session>> getActualLobbyUsers() const;
+
+        // LOBBY_USER_LIST 메시지 (클러스터 모드에서는 다른 노드의 로비 사용자 포함)
+        std::string buildLobbyUserListMessage() const;
         
         // 로비 브로드캐스트 메서드들
         void broadcastLobbyUserLeft(const std::string& username);
@@ -97,29 +121,42 @@ namespace Blokus::Server {
         // 접근자
         boost::asio::io_context& getIOContext() { return ioContext_; }
         std::shared_ptr<DatabaseManager> getDatabaseManager() const { return databaseManager_; }
+        DatabaseExecutor* getDatabaseExecutor() const { return databaseExecutor_.get(); }
+        UserStatsCache* getUserStatsCache() const { return userStatsCache_.get(); }
+        CryptoExecutor* getCryptoExecutor() const { return cryptoExecutor_.get(); }
+        std::shared_ptr<RegisteredBufferPool> getReadBufferPool(int coreIndex) const;
+        IoContextPool* getIoContextPool() const { return ioContextPool_.get(); }
+        GameResultPersister* getGameResultPersister() const { return gameResultPersister_.get(); }
+        SessionResumeRegistry* getResumeRegistry() const { return resumeRegistry_.get(); }
+        ClusterManager* getClusterManager() const { return clusterManager_.get(); }    // 클러스터 비활성화 시 nullptr
+        ChatService* getChatService() const { return chatService_.get(); }
+        AdmissionController* getAdmissionController() const { return admissionController_.get(); }
+
+        // 세션 재개 토큰 발급 (비활성화 시 빈 문자열, 같은 사용자의 보류 좌석은 정리)
+        std::string issueResumeToken(const std::shared_ptr<Session>& session);
 
         // ========================================
         // 중복 로그인 차단 관련 함수들
         // ========================================
 
-        // 세션 등록/해제 (Session 생성자/소멸자에서 호출)
-        bool registerActiveSession(const std::string& userIP, const std::string& userID);
-        void unregisterActiveSession(const std::string& userIP, const std::string& userID);
-
-        // 중복 검증 함수들
-        bool isIPActive(const std::string& userIP) const;
-        bool isUserActive(const std::string& userID) const;
-        bool isDuplicateLogin(const std::string& userIP, const std::string& userID) const;
-
         // 중복 타입을 구분하는 열거형
         enum class DuplicateType {
             NONE,           // 중복 없음
             SAME_USER_IP,   // 같은 사용자가 같은 IP에서 재로그인
             SAME_USER_DIFF_IP,  // 같은 사용자가 다른 IP에서 로그인
-            DIFF_USER_SAME_IP   // 다른 사용자가 같은 IP에서 로그인
+            DIFF_USER_SAME_IP   // 같은 IP의 로그인 사용자 수가 상한 (LOGIN_MAX_USERS_PER_IP)
         };
 
-        // 상세한 중복 검증
+        // 세션 등록/해제 (검사와 등록을 한 번에: NONE이면 등록됨, 그 외에는 거절 사유)
+        DuplicateType registerActiveSession(const std::string& userIP, const std::string& userID);
+        void unregisterActiveSession(const std::string& userIP, const std::string& userID);
+
+        // 중복 검증 함수들
+        bool isIPActive(const std::string& userIP) const;
+        bool isUserActive(const std::string& userID) const;
+        bool isDuplicateLogin(const std::string& userIP, const std::string& userID) const;
+
+        // 상세한 중복 검증 (미리보기용, 실제 차단은 registerActiveSession이 원자적으로 판정)
         DuplicateType checkDuplicateType(const std::string& userIP, const std::string& userID) const;
 
         // 활성 세션 조회 (디버깅/모니터링용)
@@ -127,16 +164,9 @@ namespace Blokus::Server {
         std::vector<std::string> getActiveUserIDs() const;
         size_t getActiveSessionCount() const;
 
-        // 통계 접근자
-        int getCurrentConnections() const {
-            std::lock_guard<std::mutex> lock(statsMutex_);
-            return stats_.currentConnections;
-        }
-
-        ServerStats getStats() const {
-            std::lock_guard<std::mutex> lock(statsMutex_);
-            return stats_;
-        }
+        // 통계 접근자 (ServerMetrics 값으로 구성)
+        int getCurrentConnections() const;
+        ServerStats getStats() const;
 
     private:
         // 내부 초기화 함수들
@@ -146,7 +176,9 @@ namespace Blokus::Server {
         bool initializeNetwork();
 
         // 네트워크 처리
+        bool openShardAcceptors(const boost::asio::ip::tcp::endpoint& endpoint);
         void startAccepting();
+        void startShardAccepting(size_t coreIndex);
         void handleNewConnection(std::shared_ptr<Session> session,
             const boost::system::error_code& error);
 
@@ -170,19 +202,44 @@ namespace Blokus::Server {
         void handleHeartbeat();
         void performCleanup(); //  새로 추가: 통합 정리 작업
         void cleanupSessions();
+        void expireResumeSeats();  // 유예 시간이 지난 보류 좌석 정리
+        void restoreMigratedRooms(); // 이전 프로세스가 드레인 종료하며 넘긴 방 복원
         void cleanupServices(); //  새로 추가: 서비스 정리
 
+        // 클러스터 모드 (CLUSTER_ENABLED)
+        bool startCluster();
+        void stopCluster();
+
+        // 드레인: 세션 송신 큐가 빌 때까지 대기 (남은 세션 수 반환)
+        size_t waitForSendQueues(const std::vector<std::shared_ptr<Session>>& sessions, std::chrono::milliseconds timeout);
+        std::vector<std::string> collectLocalLobbyRows() const;
+        void dropSessionForRemoteLogin(const std::string& userId, const std::string& winnerNodeId);
+
         // 통계 및 로깅
         void logServerStats(); //  새로 추가: 서버 통계 로그
 
     private:
         // 기본 상태
         std::atomic<bool> running_{ false };
+        std::atomic<bool> draining_{ false };
+
+        // 종료 요청 (시그널 핸들러에서 직접 drain/stop을 호출하지 않도록 run()에 넘김)
+        std::unique_ptr<boost::asio::signal_set> signals_;
+        std::mutex shutdownMutex_;
+        std::condition_variable shutdownCv_;
+        bool shutdownRequested_ = false;
+        bool drainRequested_ = false;
 
         // Boost.Asio 핵심
         boost::asio::io_context ioContext_;
         boost::asio::ip::tcp::acceptor acceptor_;
         std::vector<std::thread> threadPool_;
+
+        // 코어별 io_context 모드 (IO_MODEL=per_core): 세션은 수락된 코어에 고정
+        // (세션 소켓이 참조하므로 다른 서비스보다 늦게 소멸되도록 ioContext_ 바로 뒤에 선언)
+        std::unique_ptr<IoContextPool> ioContextPool_;
+        std::vector<std::unique_ptr<boost::asio::ip::tcp::acceptor>> shardAcceptors_;  // SO_REUSEPORT 리스너
+        std::vector<std::shared_ptr<RegisteredBufferPool>> readBufferPools_;           // 코어별 (공유 모드는 1개)
         
         //  핵심 추가: ioContext를 계속 실행 상태로 유지하는 work_guard
         std::unique_ptr<boost::asio::executor_work_guard<boost::asio::io_context::executor_type>> workGuard_;
@@ -196,6 +253,16 @@ namespace Blokus::Server {
         std::unique_ptr<RoomManager> roomManager_;
         std::unique_ptr<AuthenticationService> authService_;
         std::unique_ptr<VersionManager> versionManager_;
+        std::shared_ptr<GameResultPersister> gameResultPersister_;
+        std::unique_ptr<DatabaseExecutor> databaseExecutor_;
+        std::shared_ptr<UserStatsCache> userStatsCache_;
+        std::unique_ptr<CryptoExecutor> cryptoExecutor_;
+        std::unique_ptr<MetricsEndpoint> metricsEndpoint_;  // Prometheus 스크레이프 (METRICS_PORT)
+        std::unique_ptr<SessionResumeRegistry> resumeRegistry_;  // 세션 재개 토큰 / 보류 좌석
+        std::unique_ptr<ClusterBroker> clusterBroker_;      // CLUSTER_BROKER_LISTEN 노드만
+        std::unique_ptr<ClusterManager> clusterManager_;    // RoomManager보다 먼저 소멸 (방 목록 콜백이 참조)
+        std::unique_ptr<ChatService> chatService_;          // 로비 채팅 배치 전송 / 전송 한도
+        std::unique_ptr<AdmissionController> admissionController_;  // 리스너 입장 제어 (세션보다 오래 유지)
 
         // 세션 관리
         std::unordered_map<std::string, std::shared_ptr<Session>> sessions_;
@@ -204,14 +271,10 @@ namespace Blokus::Server {
         // ========================================
         // 중복 로그인 차단을 위한 메모리 기반 추적
         // ========================================
-        std::unordered_set<std::string> activeIPs_;           // 활성 IP 주소들
-        std::unordered_set<std::string> activeUserIDs_;       // 활성 사용자 ID들
-        std::unordered_map<std::string, std::string> ipToUserMap_;  // IP -> UserID 매핑
-        mutable std::mutex activeSessionsMutex_;              // 중복 로그인 차단용 뮤텍스
-
-        // 서버 통계 (ServerTypes.h의 ServerStats 사용)
-        ServerStats stats_;
-        mutable std::mutex statsMutex_;
+        ActiveLoginIndex activeLogins_;     // 사용자 ID -> IP, IP -> 로그인 사용자 수 (샤드 락)
+
+        size_t getMaxUsersPerIp() const;
+        bool findRemoteLogin(const std::string& userIP, const std::string& userID) const;
     };
 
 } // namespace Blokus::Server
\ No newline at end of file
@@ -0,0 +1,72 @@
+#pragma once
+
+#include "MpscQueue.h"
+#include <boost/asio.hpp>
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace Blokus {
+    namespace Server {
+
+        // ========================================
+        // IoContextPool 클래스
+        // 코어(스레드)마다 io_context 하나를 두는 I/O 풀
+        // - 세션은 수락된 코어의 io_context에 고정되어 핸들러가 스레드를 옮겨 다니지 않음
+        // - 다른 코어로 보내는 작업(세션 쓰기 시작 등)은 대상 코어의 MPSC 큐에 넣고
+        //   큐가 비어 있던 경우에만 io_context에 배출 작업 1개를 post (연속 전송은 한 번에 처리)
+        // - 메시지 자체는 세션 송신 큐에 바로 들어감 (세션별 전송 순서 유지, Session::sendFrame 참고)
+        // ========================================
+        class IoContextPool {
+        public:
+            using Task = std::function<void()>;
+
+            explicit IoContextPool(size_t count);
+            ~IoContextPool();
+
+            IoContextPool(const IoContextPool&) = delete;
+            IoContextPool& operator=(const IoContextPool&) = delete;
+
+            void start();
+            void stop();
+
+            size_t size() const { return m_cores.size(); }
+            boost::asio::io_context& context(size_t index) { return m_cores[index]->io; }
+            size_t nextIndex() { return m_nextIndex.fetch_add(1, std::memory_order_relaxed) % m_cores.size(); }
+
+            // 대상 코어에서 작업 실행 (현재 스레드가 대상 코어면 호출 측에서 직접 실행할 것)
+            void post(size_t index, Task task);
+
+            // 현재 스레드의 코어 번호 (풀 밖의 스레드는 -1)
+            static int currentIndex();
+
+            // 상태 확인
+            uint64_t getCrossCorePosts() const { return m_crossCorePosts.load(); }
+            uint64_t getDrainWakeups() const { return m_drainWakeups.load(); }
+
+        private:
+            struct Core {
+                boost::asio::io_context io{ 1 };
+                std::unique_ptr<boost::asio::executor_work_guard<boost::asio::io_context::executor_type>> workGuard;
+                MpscQueue<Task> inbox;
+                std::atomic<bool> drainScheduled{ false };
+                std::thread thread;
+            };
+
+            void scheduleDrain(Core& core);
+            void drain(Core& core);
+
+        private:
+            std::vector<std::unique_ptr<Core>> m_cores;
+            std::atomic<size_t> m_nextIndex{ 0 };
+            std::atomic<bool> m_running{ false };
+
+            // 지표
+            std::atomic<uint64_t> m_crossCorePosts{ 0 };
+            std::atomic<uint64_t> m_drainWakeups{ 0 };
+        };
+
+    } // namespace Server
+} // namespace Blokus
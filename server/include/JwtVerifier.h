@@ -8,6 +8,11 @@
 #include <mutex>
 #include <future>
 #include <vector>
+#include <list>
+#include <thread>
+#include <atomic>
+#include <condition_variable>
+#include <functional>
 
 namespace Blokus {
     namespace Server {
@@ -50,6 +55,15 @@ namespace Blokus {
             JwksKey() = default;
         };
 
+        // 검증 완료 토큰 캐시 항목 (토큰 다이제스트 -> 클레임, exp까지 유효)
+        struct VerifiedTokenEntry {
+            JwtClaims claims;
+            std::list<std::string>::iterator lruIt;
+        };
+
+        // JWKS 페처 (URL -> 응답 본문, 실패 시 nullopt)
+        using JwksFetcher = std::function<std::optional<std::string>(const std::string& url)>;
+
         // JWT 검증기 클래스
         class JwtVerifier {
         public:
@@ -71,10 +85,16 @@ namespace Blokus {
             // 설정
             void setCacheExpiration(std::chrono::minutes duration) { m_cacheExpiration = duration; }
             void setGracePeriod(std::chrono::seconds grace) { m_gracePeriod = grace; }
+            void setRefreshInterval(std::chrono::seconds interval) { m_refreshInterval = interval; }
+            void setTokenCacheCapacity(size_t capacity) { m_tokenCacheCapacity = capacity; }
+            // 기본 HTTP GET(cpr) 대신 사용할 페처 (로컬 대역 서버/검사용, initialize() 전에 설정)
+            void setJwksFetcher(JwksFetcher fetcher) { m_jwksFetcher = std::move(fetcher); }
 
             // 상태 확인
             bool isInitialized() const { return m_isInitialized; }
             size_t getCachedKeyCount() const;
+            size_t getCachedTokenCount() const;
+            uint64_t getTokenCacheHits() const { return m_tokenCacheHits.load(); }
 
         private:
             // JWKS 페칭
@@ -95,14 +115,22 @@ namespace Blokus {
             // JWK를 PEM 형식으로 변환
             std::string jwkToPem(const std::string& n, const std::string& e);
 
-            // 백그라운드 캐시 새로고침
+            // 백그라운드 캐시 새로고침 (stale-while-revalidate: 실패해도 기존 키 유지)
             void startBackgroundRefresh();
             void stopBackgroundRefresh();
             void backgroundRefreshWorker();
+            bool requestRefreshAndWait(std::chrono::milliseconds timeout);
+
+            // 검증 완료 토큰 캐시
+            std::optional<JwtClaims> lookupVerifiedToken(const std::string& digest);
+            void storeVerifiedToken(const std::string& digest, const JwtClaims& claims);
+            void purgeTokensForMissingKeys();
+            static std::string tokenDigest(const std::string& token);
 
         private:
             // 설정
             std::string m_jwksUrl;
+            JwksFetcher m_jwksFetcher;
             std::string m_issuer;
             std::vector<std::string> m_audiences;
             std::chrono::minutes m_cacheExpiration{ 10 }; // 10분 캐시
@@ -119,6 +147,20 @@ namespace Blokus {
 
             // 백그라운드 새로고침
             std::unique_ptr<std::thread> m_refreshThread;
+            std::chrono::seconds m_refreshInterval{ 300 };             // 주기적 재검증 간격
+            std::chrono::seconds m_minOnDemandRefreshInterval{ 30 };   // 알 수 없는 kid로 인한 요청 최소 간격
+            std::mutex m_refreshMutex;
+            std::condition_variable m_refreshCv;
+            bool m_refreshRequested = false;
+            uint64_t m_refreshGeneration = 0;                          // 완료된 새로고침 횟수
+            std::chrono::steady_clock::time_point m_lastOnDemandRefresh{};
+
+            // 검증 완료 토큰 캐시 (LRU, 앞쪽이 최근 사용)
+            size_t m_tokenCacheCapacity{ 4096 };
+            mutable std::mutex m_tokenCacheMutex;
+            std::unordered_map<std::string, VerifiedTokenEntry> m_tokenCache;
+            std::list<std::string> m_tokenLru;
+            std::atomic<uint64_t> m_tokenCacheHits{ 0 };
         };
 
     } // namespace Server
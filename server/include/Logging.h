@@ -0,0 +1,69 @@
+#pragma once
+
+#include <spdlog/spdlog.h>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+namespace Blokus {
+    namespace Server {
+
+        // ========================================
+        // Logging
+        // 서버 기본 로거 구성 (비동기 큐 + 콘솔 싱크)
+        // - 비동기 모드: 호출 스레드는 큐에 넣고 바로 반환, 출력은 전용 스레드 1개가 담당
+        // - 큐가 가득 차면 가장 오래된 항목을 버림 (핫 패스가 로깅 때문에 막히지 않도록)
+        // - 핫 패스의 디버그 로그는 SPDLOG_DEBUG 매크로를 사용해 릴리스 빌드에서 컴파일 단계에 제거
+        //   (SPDLOG_ACTIVE_LEVEL은 CMake에서 빌드 타입별로 지정)
+        // ========================================
+        class Logging {
+        public:
+            static void initialize(const std::string& level, bool async, size_t queueSize);
+            static void shutdown();
+
+            static spdlog::level::level_enum parseLevel(const std::string& level);
+
+            // 비동기 큐가 가득 차서 버려진 로그 수
+            static size_t getDroppedCount();
+        };
+
+        // ========================================
+        // LogRateLimiter
+        // 호출 위치별 로그 빈도 제한 (interval마다 1건만 통과, 나머지는 개수만 셈)
+        // BLOKUS_LOG_RATE_LIMITED 매크로가 호출 위치마다 static 인스턴스를 하나씩 둠
+        // ========================================
+        class LogRateLimiter {
+        public:
+            explicit LogRateLimiter(std::chrono::milliseconds interval)
+                : m_intervalNs(std::chrono::duration_cast<std::chrono::nanoseconds>(interval).count())
+            {
+            }
+
+            // 통과하면 true, suppressed에는 직전 통과 이후 생략된 건수를 돌려줌
+            bool tryAcquire(uint64_t& suppressed);
+
+        private:
+            const int64_t m_intervalNs;
+            std::atomic<int64_t> m_nextAllowedNs{ 0 };
+            std::atomic<uint64_t> m_suppressed{ 0 };
+        };
+
+    } // namespace Server
+} // namespace Blokus
+
+// 클라이언트 입력 등으로 폭주할 수 있는 경고/에러용
+// 예: BLOKUS_LOG_RATE_LIMITED(spdlog::level::warn, 1000, "알 수 없는 메시지 타입: {}", type);
+#define BLOKUS_LOG_RATE_LIMITED(level, intervalMs, ...)                                              \
+    do {                                                                                             \
+        if (spdlog::should_log(level)) {                                                             \
+            static ::Blokus::Server::LogRateLimiter blokusRateLimiter_{ std::chrono::milliseconds(intervalMs) }; \
+            uint64_t blokusSuppressed_ = 0;                                                          \
+            if (blokusRateLimiter_.tryAcquire(blokusSuppressed_)) {                                  \
+                spdlog::log(level, __VA_ARGS__);                                                     \
+                if (blokusSuppressed_ > 0) {                                                         \
+                    spdlog::log(level, "  (같은 위치의 로그 {}건 생략됨)", blokusSuppressed_);          \
+                }                                                                                    \
+            }                                                                                        \
+        }                                                                                            \
+    } while (0)
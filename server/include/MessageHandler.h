@@ -7,6 +7,7 @@
 #include <unordered_set>
 #include <vector>
 #include <cstdint>
+#include <atomic>
 
 // 기존 정의 사용
 #include "ServerTypes.h"
@@ -20,6 +21,10 @@ namespace Blokus::Server {
     class DatabaseManager;
     class GameServer;
     class VersionManager;
+    struct UserAccount;
+    struct UserProfile;
+    struct AuthResult;
+    struct RegisterResult;
 
     //  채팅 브로드캐스트용 콜백만 유지
     using ChatCallback = std::function<void(const std::string& sessionId, const std::string& message)>;
@@ -41,8 +46,10 @@ namespace Blokus::Server {
         void sendError(const std::string& errorMessage);
 
     private:
-        // enum 기반 핸들러 테이블
-        std::unordered_map<MessageType, std::function<void(const std::vector<std::string>&)>> handlers_;
+        // enum 기반 핸들러 테이블 (멤버 함수 포인터, 세션마다 만들지 않고 전체가 공유)
+        using HandlerFn = void (MessageHandler::*)(const std::vector<std::string>&);
+        using HandlerTable = std::unordered_map<MessageType, HandlerFn>;
+        static const HandlerTable& handlerTable();
 
         // 메시지 파싱
         std::pair<MessageType, std::vector<std::string>> parseMessage(const std::string& rawMessage);
@@ -57,6 +64,13 @@ namespace Blokus::Server {
         void handleLoginGuest(const std::vector<std::string>& params);
         void handleLogout(const std::vector<std::string>& params);
         void handleSessionValidate(const std::vector<std::string>& params);
+        void handleSessionResume(const std::vector<std::string>& params);  // 연결이 끊긴 세션/좌석 재개
+        void sendResumeToken();
+        bool rejoinMigratedSeat();  // 무중단 배포: 이전 프로세스에서 옮겨 온 좌석이 있으면 로그인 직후 복귀
+
+        // 인증/가입 결과 처리 (암호 작업 실행기 완료 후 세션 executor에서 호출)
+        void completeAuth(const AuthResult& result, const UserProfile* preloadedProfile, bool profileLoaded);
+        void completeRegister(const std::string& username, const RegisterResult& result);
 
         // 방 관련 핸들러들 (직접 처리)
         void handleCreateRoom(const std::vector<std::string>& params);
@@ -68,6 +82,11 @@ namespace Blokus::Server {
         void handleEndGame(const std::vector<std::string>& params);
         void handleTransferHost(const std::vector<std::string>& params);
 
+        // 관전 관련 핸들러들 (방 뮤텍스 없이 관전 채널만 사용)
+        void handleSpectateRoom(const std::vector<std::string>& params);
+        void handleSpectateLeave(const std::vector<std::string>& params);
+        bool stopSpectating();
+
         // 로비 관련 핸들러들
         void handleLobbyEnter(const std::vector<std::string>& params);
         void handleLobbyLeave(const std::vector<std::string>& params);
@@ -87,6 +106,7 @@ namespace Blokus::Server {
 
         // 게임 관련 핸들러들
         void handleGameMove(const std::vector<std::string>& params);
+        void handleGameSync(const std::vector<std::string>& params);  // 보드 순번/해시 검증, 스냅샷 요청
 
         // 기본 핸들러들
         void handlePing(const std::vector<std::string>& params);
@@ -95,19 +115,29 @@ namespace Blokus::Server {
         // 로비 브로드캐스팅 헬퍼 함수들
         void sendLobbyUserList();
         void sendRoomList();
+        bool sendRoomRedirect(int roomId);  // 클러스터 모드: 다른 노드 소유 방이면 ROOM_REDIRECT 전송
         void broadcastLobbyUserJoined(const std::string& username);
         void broadcastLobbyUserLeft(const std::string& username);
         
         // 채팅 브로드캐스팅 헬퍼 함수들
         void broadcastLobbyChatMessage(const std::string& username, const std::string& message);
         void broadcastRoomChatMessage(const std::string& username, const std::string& message);
+        void sendChatHistory();     // 최근 로비 채팅 (로그인 / 로비 입장 시)
         
         // 방 정보 동기화 헬퍼 함수
         void sendRoomInfo(const std::shared_ptr<GameRoom>& room);
         void broadcastRoomInfoToRoom(const std::shared_ptr<GameRoom>& room);
 
         // 유저 스탯 정보 조회 헬퍼 함수
-        std::string generateUserStatsResponse();
+        // 내 통계 (MY_STATS_UPDATE): 세션 -> 통계 캐시 -> DB 실행기 순으로 계정을 찾아 전송 (I/O 스레드에서 DB 대기 없음)
+        void sendMyStats();
+        std::string generateUserStatsResponse(const UserAccount& userAccount);
+        void sendUserStatsResponse(const UserAccount& userAccount, const std::shared_ptr<Session>& targetSession);
+        void sendUserSettingsResponse(const UserSettings& settings);
+
+        // DB 작업을 비동기 실행기에서 수행하고 완료 핸들러는 세션 소켓 executor에서 실행
+        template<typename Work, typename Handler>
+        void runDatabaseTask(Work work, Handler handler);
 
         // 인증 관련 헬퍼 함수들
         bool requiresAuthentication(MessageType messageType) const;
@@ -123,6 +153,9 @@ namespace Blokus::Server {
 
         //  채팅 콜백만 유지
         ChatCallback chatCallback_;
+
+        // 비밀번호 검증이 암호 작업 실행기에서 진행 중인지 (중복 auth 요청 차단)
+        std::atomic<bool> authInProgress_{ false };
     };
 
 } // namespace Blokus::Server
\ No newline at end of file
@@ -0,0 +1,108 @@
+#pragma once
+
+#include <charconv>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace Blokus {
+    namespace Server {
+
+        // 줄바꿈까지 포함된 전송 단위 (브로드캐스트 시 모든 수신자가 같은 버퍼를 공유)
+        using SharedFrame = std::shared_ptr<const std::string>;
+
+        inline SharedFrame makeFrame(std::string_view message) {
+            auto frame = std::make_shared<std::string>();
+            frame->reserve(message.size() + 1);
+            frame->append(message);
+            frame->push_back('\n');
+            return frame;
+        }
+
+        // ========================================
+        // MessageWriter 클래스
+        // 텍스트/JSON 메시지를 재사용 버퍼에 직렬화 (ostringstream 대신 std::to_chars, 로캘 영향 없음)
+        // - reset()은 버퍼 용량을 유지하므로 방마다 하나를 두고 이벤트마다 재사용
+        // - frame()으로 공유 전송 단위를 만들어 수신자 수와 관계없이 할당 1회
+        // - 스레드 안전하지 않음 (GameRoom은 m_playersMutex 안에서만 사용)
+        // ========================================
+        class MessageWriter {
+        public:
+            MessageWriter& reset(std::string_view prefix = {}) {
+                m_buffer.clear();
+                m_buffer.append(prefix);
+                return *this;
+            }
+
+            MessageWriter& raw(std::string_view text) {
+                m_buffer.append(text);
+                return *this;
+            }
+
+            MessageWriter& raw(char c) {
+                m_buffer.push_back(c);
+                return *this;
+            }
+
+            template<typename T>
+            MessageWriter& number(T value) {
+                static_assert(std::is_integral_v<T> || std::is_enum_v<T>, "정수 또는 열거형만 지원");
+                char digits[24];
+                std::to_chars_result result;
+                if constexpr (std::is_enum_v<T>) {
+                    result = std::to_chars(digits, digits + sizeof(digits), static_cast<std::underlying_type_t<T>>(value));
+                }
+                else {
+                    result = std::to_chars(digits, digits + sizeof(digits), value);
+                }
+                m_buffer.append(digits, result.ptr);
+                return *this;
+            }
+
+            MessageWriter& boolean(bool value) {
+                m_buffer.append(value ? "true" : "false");
+                return *this;
+            }
+
+            // JSON 문자열 (따옴표 포함, 제어 문자/따옴표/역슬래시 이스케이프)
+            MessageWriter& jsonString(std::string_view text) {
+                static const char kHex[] = "0123456789abcdef";
+                m_buffer.push_back('"');
+                for (char c : text) {
+                    if (c == '"' || c == '\\') {
+                        m_buffer.push_back('\\');
+                        m_buffer.push_back(c);
+                    }
+                    else if (static_cast<unsigned char>(c) < 0x20) {
+                        m_buffer.append("\\u00");
+                        m_buffer.push_back(kHex[(c >> 4) & 0x0F]);
+                        m_buffer.push_back(kHex[c & 0x0F]);
+                    }
+                    else {
+                        m_buffer.push_back(c);
+                    }
+                }
+                m_buffer.push_back('"');
+                return *this;
+            }
+
+            // "key": 형태 (key는 이스케이프가 필요 없는 리터럴만 사용)
+            MessageWriter& key(std::string_view name) {
+                m_buffer.push_back('"');
+                m_buffer.append(name);
+                m_buffer.append("\":");
+                return *this;
+            }
+
+            std::string_view view() const { return m_buffer; }
+            size_t size() const { return m_buffer.size(); }
+
+            SharedFrame frame() const { return makeFrame(m_buffer); }
+
+        private:
+            std::string m_buffer;
+        };
+
+    } // namespace Server
+} // namespace Blokus
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <boost/asio.hpp>
+#include <atomic>
+#include <memory>
+#include <string>
+
+namespace Blokus {
+    namespace Server {
+
+        // ========================================
+        // MetricsEndpoint 클래스
+        // Prometheus 스크레이프용 최소 HTTP 응답기 (GET 만 처리, 요청마다 연결 종료)
+        // - /metrics: Prometheus 텍스트 형식
+        // - /trace: 추적 스팬 Chrome trace JSON 덤프, /trace/sample?every=N: 샘플링 비율 변경
+        // 게임 프로토콜 포트와 분리된 별도 포트에서 제어용 io_context로 동작
+        // ========================================
+        class MetricsEndpoint {
+        public:
+            explicit MetricsEndpoint(boost::asio::io_context& ioContext);
+            ~MetricsEndpoint();
+
+            bool start(const std::string& bindAddress, int port);
+            void stop();
+
+            uint64_t getScrapeCount() const { return m_scrapeCount.load(); }
+
+        private:
+            void startAccept();
+            void handleConnection(std::shared_ptr<boost::asio::ip::tcp::socket> socket);
+
+        private:
+            boost::asio::io_context& m_ioContext;
+            boost::asio::ip::tcp::acceptor m_acceptor;
+            std::atomic<bool> m_running{ false };
+            std::atomic<uint64_t> m_scrapeCount{ 0 };
+        };
+
+    } // namespace Server
+} // namespace Blokus
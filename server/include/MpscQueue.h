@@ -0,0 +1,73 @@
+#pragma once
+
+#include <atomic>
+#include <optional>
+#include <utility>
+
+namespace Blokus {
+    namespace Server {
+
+        // ========================================
+        // MpscQueue 클래스
+        // 다중 생산자 / 단일 소비자 무잠금 큐 (Vyukov 노드 기반)
+        // - push: 여러 스레드에서 호출 가능 (wait-free)
+        // - pop/empty: 소비자 스레드 하나에서만 호출
+        // - 생산자가 push 도중이면 잠시 비어 보일 수 있음 (호출 측에서 재확인)
+        // ========================================
+        template<typename T>
+        class MpscQueue {
+        public:
+            MpscQueue()
+                : m_head(new Node())
+                , m_tail(m_head.load(std::memory_order_relaxed))
+            {
+            }
+
+            ~MpscQueue() {
+                while (pop()) {
+                }
+                delete m_tail;
+            }
+
+            MpscQueue(const MpscQueue&) = delete;
+            MpscQueue& operator=(const MpscQueue&) = delete;
+
+            void push(T value) {
+                Node* node = new Node();
+                node->value.emplace(std::move(value));
+
+                Node* prev = m_head.exchange(node, std::memory_order_acq_rel);
+                prev->next.store(node, std::memory_order_release);
+            }
+
+            std::optional<T> pop() {
+                Node* tail = m_tail;
+                Node* next = tail->next.load(std::memory_order_acquire);
+                if (!next) {
+                    return std::nullopt;
+                }
+
+                // next가 새 더미 노드가 되고 값은 꺼내서 반환
+                m_tail = next;
+                std::optional<T> value(std::move(next->value));
+                next->value.reset();
+                delete tail;
+                return value;
+            }
+
+            bool empty() const {
+                return m_tail->next.load(std::memory_order_acquire) == nullptr;
+            }
+
+        private:
+            struct Node {
+                std::atomic<Node*> next{ nullptr };
+                std::optional<T> value;
+            };
+
+            alignas(64) std::atomic<Node*> m_head;  // 생산자 쪽 (마지막 노드)
+            alignas(64) Node* m_tail;                // 소비자 쪽 (더미 노드)
+        };
+
+    } // namespace Server
+} // namespace Blokus
@@ -21,6 +21,11 @@ namespace Blokus::Server {
         // 핵심 참조점
         SessionPtr session_;
 
+        // 세션 없는 좌석의 사용자 정보 (서버 재시작 후 복원된 좌석, 재접속 전까지 사용)
+        std::string seatUserId_;
+        std::string seatUsername_;
+        std::string seatDisplayName_;
+
         // 게임 방 전용 상태 정보
         Common::PlayerColor color_;
         bool isHost_;
@@ -49,17 +54,20 @@ namespace Blokus::Server {
 
         // 사용자 ID 반환
         std::string getUserId() const {
-            return session_ ? session_->getUserId() : "";
+            return session_ ? session_->getUserId() : seatUserId_;
         }
 
         // 사용자명 반환
         std::string getUsername() const {
-            return session_ ? session_->getUsername() : "";
+            return session_ ? session_->getUsername() : seatUsername_;
         }
 
         // 표시명 반환 (displayName 우선, 없으면 username)
         std::string getDisplayName() const {
-            return session_ ? session_->getDisplayName() : getUsername();
+            if (session_) {
+                return session_->getDisplayName();
+            }
+            return seatDisplayName_.empty() ? seatUsername_ : seatDisplayName_;
         }
 
         // 연결 상태 확인
@@ -83,8 +91,9 @@ namespace Blokus::Server {
         }
 
         // 정리가 필요한 플레이어인지 확인 (연결 끊김)
+        // 세션 없이 복원된 좌석(방 이전)은 재접속 유예가 끝날 때 RoomManager가 정리
         bool needsCleanup() const {
-            return !session_ || !session_->isActive();
+            return session_ ? !session_->isActive() : seatUserId_.empty();
         }
 
         // ========================================
@@ -153,6 +162,12 @@ namespace Blokus::Server {
             }
         }
 
+        void sendFrame(const SharedFrame& frame, uint64_t roomSeq = 0) const {
+            if (session_) {
+                session_->sendFrame(frame, roomSeq);
+            }
+        }
+
         // 세션 포인터 직접 접근 (필요시)
         SessionPtr getSession() const { return session_; }
 
@@ -166,7 +181,7 @@ namespace Blokus::Server {
         // JSON으로 변환 (네트워크 전송용)
         nlohmann::json toJson() const;
 
-        // JSON에서 복원 (세션은 별도 설정 필요)
+        // JSON에서 복원 (세션은 별도 설정 필요, 세션 없이 복원하면 JSON의 사용자 정보로 좌석 유지)
         static PlayerInfo fromJson(const nlohmann::json& json, SessionPtr session = nullptr);
 
         // 게임 상태만 JSON으로 변환 (간단한 동기화용)
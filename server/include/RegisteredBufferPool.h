@@ -0,0 +1,61 @@
+#pragma once
+
+#include <boost/asio.hpp>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+namespace Blokus {
+    namespace Server {
+
+        // ========================================
+        // RegisteredBufferPool 클래스
+        // 세션 읽기 버퍼를 하나의 연속 메모리에서 슬롯 단위로 나눠 주는 풀
+        // - io_uring 빌드(BLOKUS_IO_URING)에서는 io_context에 등록하여 커널 고정 버퍼로 사용
+        // - 등록 실패/미지원 빌드에서는 일반 버퍼로 동작 (세션은 슬롯이 없으면 자체 버퍼 사용)
+        // ========================================
+        class RegisteredBufferPool {
+        public:
+            RegisteredBufferPool(boost::asio::io_context& ioContext, size_t slotCount, size_t slotSize);
+            ~RegisteredBufferPool();
+
+            RegisteredBufferPool(const RegisteredBufferPool&) = delete;
+            RegisteredBufferPool& operator=(const RegisteredBufferPool&) = delete;
+
+            // 빌드 시 결정된 asio 리액터 이름 ("io_uring" 또는 "epoll")
+            static const char* compiledBackend();
+
+            // 슬롯 할당/반환 (소진 시 nullopt)
+            std::optional<size_t> acquire();
+            void release(size_t slot);
+
+            char* data(size_t slot) { return m_storage.data() + slot * m_slotSize; }
+            size_t slotSize() const { return m_slotSize; }
+            boost::asio::mutable_buffer buffer(size_t slot) { return boost::asio::buffer(data(slot), m_slotSize); }
+
+            bool isRegistered() const;
+#ifdef BLOKUS_IO_URING
+            boost::asio::mutable_registered_buffer registeredBuffer(size_t slot);
+#endif
+
+            // 상태 확인
+            size_t capacity() const { return m_slotCount; }
+            size_t inUse() const;
+
+        private:
+            size_t m_slotCount;
+            size_t m_slotSize;
+            std::vector<char> m_storage;
+
+            std::vector<size_t> m_freeSlots;
+            mutable std::mutex m_mutex;
+
+#ifdef BLOKUS_IO_URING
+            std::optional<boost::asio::buffer_registration<std::vector<boost::asio::mutable_buffer>>> m_registration;
+#endif
+        };
+
+    } // namespace Server
+} // namespace Blokus
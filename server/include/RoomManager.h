@@ -3,19 +3,25 @@
 #include "GameRoom.h"
 #include "ServerTypes.h"
 #include "Types.h"
+#include "SpectatorChannel.h"
+#include <boost/asio/thread_pool.hpp>
 #include <unordered_map>
+#include <map>
 #include <vector>
 #include <memory>
 #include <shared_mutex>
 #include <atomic>
 #include <functional>
 #include <chrono>
+#include <mutex>
+#include <cstdint>
 
 namespace Blokus {
     namespace Server {
 
         // 전방 선언
         class DatabaseManager;
+        class GameResultPersister;
 
         // ========================================
         // RoomManager 클래스
@@ -31,10 +37,14 @@ namespace Blokus {
             void setDatabaseManager(std::shared_ptr<DatabaseManager> dbManager);
             std::shared_ptr<DatabaseManager> getDatabaseManager() const;
 
+            // 게임 결과 비동기 저장 큐 설정
+            void setGameResultPersister(std::shared_ptr<GameResultPersister> persister) { m_gameResultPersister = persister; }
+            std::shared_ptr<GameResultPersister> getGameResultPersister() const { return m_gameResultPersister; }
+
             // 방 생성 관련
             int createRoom(const std::string& hostId, const std::string& hostUsername,
                 const std::string& roomName, bool isPrivate = false,
-                const std::string& password = "");
+                const std::string& password = "", bool allowSpectators = true);
             bool removeRoom(int roomId);
             void removeAllRooms();
 
@@ -61,6 +71,20 @@ namespace Blokus {
             std::vector<GameRoomPtr> getWaitingRooms() const;
             std::vector<GameRoomPtr> getPlayingRooms() const;
 
+            // 방 목록 캐시 (버전 관리 + 사전 직렬화된 ROOM_LIST 스냅샷)
+            std::string getRoomListMessage() const;
+            uint64_t getRoomListVersion() const;
+            void sendRoomListSnapshot(SessionPtr session);
+            void subscribeRoomList(SessionPtr session);
+            void unsubscribeRoomList(const std::string& sessionId);
+            void updateRoomListEntry(const Common::RoomInfo& info, bool insertIfMissing = false); // 방 뮤텍스 보유 상태에서 호출
+
+            // 클러스터 모드: 로컬 방 목록 행 변경 알림 (row == nullptr이면 제거, 방 목록 락 안에서 호출)
+            using RoomListListener = std::function<void(int roomId, const std::string* row)>;
+            void setRoomListListener(RoomListListener listener);
+            // 다른 노드 소유 방의 목록 행 반영 (row == nullptr이면 제거)
+            void applyRemoteRoomListRow(int roomId, const std::string* row);
+
             // 클라이언트-방 매칭 정보 관련
             GameRoomPtr findPlayerRoom(const std::string& userId) const;
             bool isPlayerInRoom(const std::string& userId) const;
@@ -83,9 +107,21 @@ namespace Blokus {
             void broadcastToWaitingRooms(const std::string& message);
             void broadcastToPlayingRooms(const std::string& message);
 
+            // 관전 채널 생성 (관전 비활성화 시 nullptr, 팬아웃은 관전 전용 스레드 풀에서 처리)
+            SpectatorChannelPtr createSpectatorChannel(int roomId);
+
+            // 무중단 배포: 진행 중인 방 내보내기 / 이전 프로세스가 남긴 방 복원
+            std::vector<std::string> exportPlayingRooms();
+            bool restoreRoom(const std::string& snapshot, std::chrono::seconds seatGrace);
+            // 로그인한 사용자의 복원 좌석 반환 (없으면 nullptr, 한 번만 반환)
+            GameRoomPtr claimMigratedSeat(const std::string& userId);
+            // 유예 시간 안에 돌아오지 않은 복원 좌석 정리, 정리한 좌석 수 반환
+            size_t expireMigratedSeats(std::chrono::steady_clock::time_point now);
+
             // 방 초기화 관련
             void setMaxRooms(size_t maxRooms) { m_maxRooms = maxRooms; }
             void setMaxPlayersPerRoom(size_t maxPlayers) { m_maxPlayersPerRoom = maxPlayers; }
+            void setRoomIdBase(int firstRoomId) { m_nextRoomId = firstRoomId; }   // 클러스터 노드별 방 ID 대역
             size_t getMaxRooms() const { return m_maxRooms; }
 
             using RoomEventCallback = std::function<void(int roomId, const std::string& event, const std::string& data)>;
@@ -100,7 +136,7 @@ namespace Blokus {
             std::unordered_map<std::string, int> m_playerToRoom;
             mutable std::shared_mutex m_playerMappingMutex;
 
-            // 방 ID관련, 1000부터 오름차순 배정
+            // 방 ID관련, 1001부터 오름차순 배정 (클러스터 모드에서는 노드별 대역 시작값부터)
             std::atomic<int> m_nextRoomId;
 
             // 방 초기화
@@ -109,10 +145,35 @@ namespace Blokus {
 
             // 이벤트 콜백
             RoomEventCallback m_eventCallback;
+
+            // 방 목록 캐시 (방 ID 순 정렬된 직렬화 행 + 전체 스냅샷)
+            std::map<int, std::string> m_roomListRows;
+            std::string m_roomListSnapshot;
+            uint64_t m_roomListVersion;
+            std::unordered_map<std::string, std::weak_ptr<Session>> m_roomListSubscribers;
+            mutable std::mutex m_roomListMutex;
+            RoomListListener m_roomListListener;
             
             // DatabaseManager 참조
             std::shared_ptr<DatabaseManager> m_databaseManager;
 
+            // 게임 결과 저장 큐 참조
+            std::shared_ptr<GameResultPersister> m_gameResultPersister;
+
+            // 복원된 좌석 (사용자 ID -> 방 ID, 재접속 마감 시각)
+            struct MigratedSeat {
+                int roomId;
+                std::chrono::steady_clock::time_point deadline;
+            };
+            std::unordered_map<std::string, MigratedSeat> m_migratedSeats;
+            mutable std::mutex m_migratedSeatsMutex;
+
+            // 관전 팬아웃 전용 스레드 풀 (게임 I/O 코어와 분리)
+            std::unique_ptr<boost::asio::thread_pool> m_spectatorPool;
+            SpectatorChannel::Options m_spectatorOptions;
+
+            void initializeSpectatorPool();
+
             // 내부 유틸리티 함수들
             bool validateRoomCreation(const std::string& roomName) const;
             bool validateJoinRoom(int roomId, const std::string& userId, const std::string& password) const;
@@ -126,6 +187,14 @@ namespace Blokus {
 
             // 방 이벤트
             void triggerRoomEvent(int roomId, const std::string& event, const std::string& data = "");
+
+            // 방 목록 캐시 갱신
+            void refreshRoomListEntry(int roomId, bool isNewRoom);
+            void removeRoomListEntry(int roomId);
+            void rebuildRoomListSnapshotLocked();
+            void sendRoomListSnapshotLocked(const SessionPtr& session) const;
+            void publishRoomListDeltaLocked(const std::string& delta);
+            static std::string serializeRoomListRow(const Common::RoomInfo& info);
             void updateStatistics();
         };
 
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <chrono>
+
+namespace Blokus {
+    namespace Server {
+
+        // ========================================
+        // RoomMigrationStore 클래스
+        // 드레인 종료 시 진행 중인 방 스냅샷을 파일로 넘기고, 다음 프로세스가 시작할 때 한 번 읽어 감
+        // 파일 형식: 첫 줄 "BLOKUS_ROOM_MIGRATION <기록 시각(epoch ms)>", 이후 한 줄에 방 하나 (JSON)
+        // ========================================
+        class RoomMigrationStore {
+        public:
+            explicit RoomMigrationStore(std::string path);
+
+            // 임시 파일에 쓰고 교체 (쓰는 도중 죽어도 이전 파일이나 빈 상태만 남음)
+            bool save(const std::vector<std::string>& snapshots);
+
+            // 스냅샷을 읽고 파일 삭제 (maxAge보다 오래된 파일은 버림)
+            std::vector<std::string> consume(std::chrono::seconds maxAge);
+
+            const std::string& getPath() const { return m_path; }
+
+        private:
+            std::string m_path;
+        };
+
+    } // namespace Server
+} // namespace Blokus
@@ -0,0 +1,220 @@
+#pragma once
+
+#include "ServerTypes.h"
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Blokus {
+    namespace Server {
+
+        // ========================================
+        // ShardedCounter
+        // 스레드별 샤드(캐시 라인 단위)에 나눠 더하는 단조 증가 카운터
+        // 여러 I/O 코어가 같은 값을 갱신해도 캐시 라인 경합이 없고, 읽을 때만 합산
+        // ========================================
+        class ShardedCounter {
+        public:
+            static constexpr size_t kShardCount = 16;
+
+            void add(uint64_t amount = 1) {
+                m_shards[shardIndex()].value.fetch_add(amount, std::memory_order_relaxed);
+            }
+
+            uint64_t value() const {
+                uint64_t total = 0;
+                for (const auto& shard : m_shards) {
+                    total += shard.value.load(std::memory_order_relaxed);
+                }
+                return total;
+            }
+
+            // 현재 스레드의 샤드 번호 (스레드 생성 순서대로 배정)
+            static size_t shardIndex();
+
+        private:
+            struct alignas(64) Shard {
+                std::atomic<uint64_t> value{ 0 };
+            };
+            std::array<Shard, kShardCount> m_shards{};
+        };
+
+        // ========================================
+        // Gauge
+        // 현재 값 (연결 수, 방 수 등)
+        // ========================================
+        class Gauge {
+        public:
+            void set(int64_t value) { m_value.store(value, std::memory_order_relaxed); }
+            int64_t add(int64_t delta) { return m_value.fetch_add(delta, std::memory_order_relaxed) + delta; }
+            int64_t value() const { return m_value.load(std::memory_order_relaxed); }
+
+            void updateMax(int64_t candidate) {
+                int64_t current = m_value.load(std::memory_order_relaxed);
+                while (candidate > current && !m_value.compare_exchange_weak(current, candidate, std::memory_order_relaxed)) {
+                }
+            }
+
+        private:
+            std::atomic<int64_t> m_value{ 0 };
+        };
+
+        // ========================================
+        // Histogram
+        // HDR 방식의 로그-선형 버킷 (2의 거듭제곱 구간마다 8칸, 상대 오차 12.5% 이내)
+        // 값은 정수 단위 (지연 시간은 마이크로초, 큐 깊이는 개수)
+        // 버킷은 값이 여러 칸에 흩어지므로 샤딩하지 않고, 합계/개수만 샤드 카운터 사용
+        // ========================================
+        class Histogram {
+        public:
+            static constexpr int kSubBucketBits = 3;
+            static constexpr int kSubBuckets = 1 << kSubBucketBits;
+            static constexpr int kMagnitudes = 40;
+            static constexpr int kBucketCount = kSubBuckets * kMagnitudes;
+
+            void record(uint64_t value);
+
+            void recordDuration(std::chrono::steady_clock::duration elapsed) {
+                auto micros = std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count();
+                record(micros > 0 ? static_cast<uint64_t>(micros) : 0);
+            }
+
+            uint64_t count() const { return m_count.value(); }
+            uint64_t sum() const { return m_sum.value(); }
+            uint64_t max() const { return m_max.load(std::memory_order_relaxed); }
+
+            // 백분위 값 (해당 버킷의 상한)
+            uint64_t percentile(double p) const;
+
+            // 상한 이하 값의 누적 개수 (Prometheus le 버킷용)
+            uint64_t countAtOrBelow(uint64_t bound) const;
+
+        private:
+            static int bucketIndex(uint64_t value);
+            static uint64_t bucketUpperBound(int index);
+
+        private:
+            std::array<std::atomic<uint64_t>, kBucketCount> m_buckets{};
+            ShardedCounter m_count;
+            ShardedCounter m_sum;
+            std::atomic<uint64_t> m_max{ 0 };
+        };
+
+        // ========================================
+        // ServerMetrics
+        // 서버 전역 지표 모음 (ConfigManager와 같이 프로세스 전역 접근)
+        // - 핫 패스(세션 송수신, 메시지 처리)는 잠금 없이 기록
+        // - 방 수처럼 다른 컴포넌트가 가진 값은 수집 시점에 collector 콜백으로 갱신
+        // ========================================
+        class ServerMetrics {
+        public:
+            using Collector = std::function<void(ServerMetrics&)>;
+
+            static ServerMetrics& instance();
+
+            // 메시지 타입별 처리 시간 히스토그램 (등록되지 않은 타입은 Unknown으로 집계)
+            Histogram& messageHandleTime(MessageType type);
+
+            // 수집 직전에 호출할 콜백 등록/해제 (GameServer가 방 수, 대기열 등을 채움)
+            void setCollector(Collector collector);
+
+            // Prometheus 텍스트 형식 (version 0.0.4)
+            std::string renderPrometheus();
+
+        public:
+            // 연결
+            ShardedCounter connectionsAccepted;
+            Gauge connectionsCurrent;
+            Gauge connectionsPeak;
+            Gauge sessionPoolReused;            // 세션 풀에서 재사용한 세션 블록 (누적)
+            Gauge sessionPoolAllocated;         // 풀이 비어 새로 할당한 세션 블록 (누적)
+            Gauge readBufferSlabsReused;        // 재사용한 읽기 버퍼 슬랩 (누적)
+            Gauge readBufferSlabsAllocated;
+
+            // 입장 제어
+            ShardedCounter connectionsRejectedIpRate;
+            ShardedCounter connectionsRejectedUnauthenticated;
+            Gauge unauthenticatedSessions;      // 미인증 슬롯을 점유 중인 세션
+            ShardedCounter authDeadlineDrops;   // 로그인 유예 시간 안에 아무것도 하지 않은 연결
+            ShardedCounter messagesRateLimited; // 세션별 수신 한도로 버린 메시지
+
+            // 송수신
+            ShardedCounter messagesReceived;
+            ShardedCounter messagesSent;
+            ShardedCounter bytesReceived;
+            ShardedCounter bytesSent;
+            Histogram sendQueueDepth;           // 전송 요청 시점의 세션 송신 큐 길이
+            ShardedCounter framesCompressed;    // 압축해서 보낸 프레임 (수신자별)
+            ShardedCounter compressionBytesIn;  // 압축 전 크기 합
+            ShardedCounter compressionBytesOut; // 실제로 보낸 "Z:" 프레임 크기 합
+
+            // DB
+            Histogram dbQueryTime;              // DatabaseExecutor 작업 실행 시간
+            Gauge dbPendingJobs;
+
+            // 게임
+            Gauge activeRooms;
+            Gauge playersInRooms;
+            Gauge authenticatedSessions;
+            ShardedCounter gamesStarted;
+            Histogram turnDuration;             // 턴 시작부터 다음 턴/종료까지
+            ShardedCounter boardSnapshotsSent;  // BOARD_SNAPSHOT 전송 (요청 + 어긋남 복구)
+            ShardedCounter boardDesyncs;        // 클라이언트 보드 해시 불일치
+
+            // 관전
+            Gauge spectatorsCurrent;
+            ShardedCounter spectatorFramesSent;
+            ShardedCounter spectatorResyncs;    // 밀린 관전자에게 스냅샷으로 합쳐 보낸 횟수
+
+            // 세션 재개
+            Gauge sessionsAwaitingResume;
+            ShardedCounter sessionResumes;
+            ShardedCounter sessionResumeReplayedEvents;
+            ShardedCounter sessionResumeResyncs;    // 로그 범위를 벗어나 전체 상태로 대체한 재개
+            ShardedCounter sessionResumeExpired;
+
+            // 클러스터
+            Gauge clusterNodes;                 // 이 노드가 알고 있는 다른 노드 수
+            ShardedCounter clusterMessagesPublished;
+            ShardedCounter clusterMessagesReceived;
+            ShardedCounter clusterLoginConflicts;   // 다른 노드와의 동시 로그인 경합에서 내려놓은 세션
+
+            // 채팅
+            ShardedCounter chatMessages;            // 로비 채팅 (배치 전송 대상)
+            ShardedCounter chatBatches;
+            ShardedCounter chatFramesSent;          // 배치마다 수신자별 프레임 1개
+            ShardedCounter chatRateLimited;
+
+            // 무중단 배포
+            ShardedCounter roomsMigratedOut;        // 드레인 종료 시 파일로 넘긴 진행 중인 방
+            ShardedCounter roomsMigratedIn;         // 시작 시 이전 프로세스에서 복원한 방
+            ShardedCounter migratedSeatsReclaimed;  // 재로그인으로 다시 앉은 복원 좌석
+
+            // 로깅
+            Gauge logMessagesDropped;           // 비동기 로그 큐가 가득 차 버려진 누적 건수
+
+            std::chrono::system_clock::time_point startTime = std::chrono::system_clock::now();
+
+        private:
+            ServerMetrics();
+
+            ServerMetrics(const ServerMetrics&) = delete;
+            ServerMetrics& operator=(const ServerMetrics&) = delete;
+
+        private:
+            // 생성 시 모든 MessageType으로 채운 뒤 변경하지 않음 (읽기 전용이라 잠금 불필요)
+            std::unordered_map<int, std::unique_ptr<Histogram>> m_messageHandleTimes;
+
+            Collector m_collector;
+            std::mutex m_collectorMutex;
+        };
+
+    } // namespace Server
+} // namespace Blokus
@@ -78,6 +78,7 @@ namespace Blokus {
             Guest = 102,
             Logout = 103,
             Validate = 104,
+            Resume = 105,
 
             // 로비 관련 (200-299)
             Lobby = 200,
@@ -95,12 +96,15 @@ namespace Blokus {
             RoomStart = 306,
             RoomEnd = 307,
             RoomTransferHost = 308,
+            RoomSpectate = 309,
+            RoomSpectateLeave = 310,
 
             // 게임 관련 (400-499)
             Game = 400,
             GameMove = 401,
             GameEnd = 402,
             GameResultResponse = 403,
+            GameSync = 404,
 
             // 채팅 관련 (500-599)
             Chat = 500,
@@ -2,6 +2,9 @@
 
 #include "ServerTypes.h"  // ConnectionState가 여기에 정의됨
 #include "DatabaseManager.h"  // UserAccount 구조체를 위해 추가
+#include "MessageWriter.h"
+#include "TokenBucket.h"
+#include "FrameCompressor.h"
 #include <boost/asio.hpp>
 #include <spdlog/spdlog.h>
 #include <memory>
@@ -18,6 +21,8 @@
 namespace Blokus::Server {
     class MessageHandler;
     class GameServer;
+    class RegisteredBufferPool;
+    class BlockPool;
 }
 
 namespace Blokus::Server {
@@ -35,10 +40,21 @@ namespace Blokus::Server {
         explicit Session(boost::asio::ip::tcp::socket socket, GameServer* server = nullptr);
         ~Session();
 
+        // 세션 풀에서 생성 (제어 블록 + 세션 메모리를 해제된 세션 블록에서 재사용)
+        static std::shared_ptr<Session> create(boost::asio::ip::tcp::socket socket, GameServer* server);
+
+        // 풀 상태 (메트릭용)
+        static const BlockPool& getSessionPool();
+        static const BlockPool& getReadBufferSlabs();
+
         void start();
         void stop();
         bool isActive() const { return active_.load(); }
 
+        // 세션 재개로 새 연결이 넘겨받은 세션 (종료 시 방 퇴장 / 좌석 보류를 하지 않음)
+        void markSuperseded() { superseded_.store(true); }
+        bool isSuperseded() const { return superseded_.load(); }
+
         // 메시지 핸들러 할당
         void setMessageHandler(std::unique_ptr<MessageHandler> handler);
         MessageHandler* getMessageHandler() const { return messageHandler_.get(); }
@@ -51,6 +67,14 @@ namespace Blokus::Server {
         ConnectionState getState() const { return state_; }
         int getCurrentRoomId() const { return currentRoomId_; }
 
+        // 관전 중인 방 (-1이면 관전 안 함, 관전 채널 스레드에서도 접근)
+        int getSpectatingRoomId() const { return spectatingRoomId_.load(); }
+        void setSpectatingRoom(int roomId) { spectatingRoomId_.store(roomId); }
+        void clearSpectatingRoom(int roomId) {
+            int expected = roomId;
+            spectatingRoomId_.compare_exchange_strong(expected, -1);
+        }
+
         // 사용자 계정 정보 접근자
         const std::optional<UserAccount>& getUserAccount() const { return userAccount_; }
         bool hasUserAccount() const { return userAccount_.has_value(); }
@@ -90,11 +114,31 @@ namespace Blokus::Server {
         // 인증 상태 관련
         bool setAuthenticated(const std::string& userId, const std::string& username, std::string* errorMessage = nullptr);
         void clearAuthentication();  // 인증 상태 완전 초기화
+        void releaseActiveRegistration();  // 중복 로그인 추적에서만 제외 (좌석 보류 / 세션 재개 시)
         void setUserAccount(const UserAccount& account);
         void updateUserAccount(const UserAccount& account);
 
         // 프로토콜 관련
         void sendMessage(const std::string& message);
+        void sendFrame(SharedFrame frame, uint64_t roomSeq = 0);  // 줄바꿈이 붙은 공유 버퍼 (브로드캐스트용, 복사 없음)
+
+        // 프레임 압축 (version:check에서 코덱을 협상한 클라이언트만, 이후 큰 프레임을 "Z:"로 전송)
+        void enableCompression() { compressionEnabled_.store(true); }
+        bool isCompressionEnabled() const { return compressionEnabled_.load(); }
+
+        // 방 이벤트 순번 표시 (version:check에서 room-seq를 협상한 클라이언트만, 방 이벤트 앞에 "S:순번:")
+        // 클라이언트가 resume에 마지막으로 받은 순번을 보내면 그 이후부터 재전송
+        static constexpr std::string_view ROOM_SEQ_CAPABILITY = "room-seq";
+        void enableRoomSeqTags() { roomSeqTagsEnabled_.store(true); }
+
+        // 소켓까지 전송이 끝난 마지막 방 이벤트 순번 (클라이언트가 순번을 보내지 않은 재개에서만 사용)
+        uint64_t getDeliveredRoomSeq() const { return deliveredRoomSeq_.load(); }
+        void setDeliveredRoomSeq(uint64_t seq);     // 방 입장/재개 시 기준 순번 (순서 검사도 다시 시작)
+        // 방 이벤트가 순번보다 작은 값으로 큐에 들어온 적이 있음 -> 순번을 믿을 수 없으므로 재개 시 전체 상태
+        bool hasRoomSeqReordered() const {
+            std::lock_guard<std::mutex> lock(sendMutex_);
+            return roomSeqReordered_;
+        }
         void sendBinary(const std::vector<uint8_t>& data);
 
         // 콜백 함수 정의
@@ -111,27 +155,52 @@ namespace Blokus::Server {
         std::string getRemoteIP() const;  // IP 주소만 반환 (포트 제외)
         boost::asio::ip::tcp::socket& getSocket() { return socket_; }  // 소켓 반환
 
+        // 입장 제어: 리스너에서 미인증 슬롯을 받은 세션 (로그인 또는 종료 시 반환)
+        void holdAdmissionSlot() { holdsAdmissionSlot_.store(true); }
+
+        // 코어별 io_context 모드: 세션이 고정된 코어 번호 (공유 모드는 -1)
+        void setCoreIndex(int coreIndex) { coreIndex_ = coreIndex; }
+        int getCoreIndex() const { return coreIndex_; }
+
         size_t getPendingMessageCount() const {
             std::lock_guard<std::mutex> lock(sendMutex_);
             return outgoingMessages_.size();
         }
 
+        static constexpr size_t MAX_MESSAGE_LENGTH = 8192;
+
     private:
         // I/O 관련
         boost::asio::ip::tcp::socket socket_;
-        static constexpr size_t MAX_MESSAGE_LENGTH = 8192;
-        char readBuffer_[MAX_MESSAGE_LENGTH];
+        char* readBuffer_ = nullptr;    // 읽기 버퍼 슬랩 (등록 버퍼 슬롯이 없을 때 start()에서 받음)
         std::string messageBuffer_;
 
+        // 공용 읽기 버퍼 풀 슬롯 (io_uring 등록 버퍼, 없으면 readBuffer_ 슬랩 사용)
+        std::shared_ptr<RegisteredBufferPool> readBufferPool_;
+        std::optional<size_t> readBufferSlot_;
+        int coreIndex_ = -1;
+
         // 세션 정보 관련
         std::string sessionId_;
         std::string userId_;
         std::string username_;
         ConnectionState state_;
         int currentRoomId_;
+        std::atomic<int> spectatingRoomId_{ -1 };
         std::atomic<bool> active_;
+        std::atomic<bool> superseded_{ false };
+        std::atomic<uint64_t> deliveredRoomSeq_{ 0 };
+        std::atomic<bool> compressionEnabled_{ false };
+        std::atomic<bool> roomSeqTagsEnabled_{ false };
         std::chrono::steady_clock::time_point lastActivity_;
         bool justLeftRoom_;
+
+        // 입장 제어 / 수신 한도
+        std::atomic<bool> holdsAdmissionSlot_{ false };
+        std::atomic<bool> everAuthenticated_{ false };
+        boost::asio::steady_timer authDeadlineTimer_;   // 로그인 전 무응답 연결 정리
+        TokenBucket messageBucket_;                     // 읽기 핸들러에서만 접근 (세션당 읽기 1개)
+        uint32_t droppedMessages_ = 0;                  // 연속으로 버린 메시지 수
         
         // 사용자 계정 정보
         std::optional<UserAccount> userAccount_;
@@ -147,10 +216,16 @@ namespace Blokus::Server {
         // 메시지 핸들러
         std::unique_ptr<MessageHandler> messageHandler_;
 
-        // 메시지 큐
+        // 메시지 큐 (roomSeq는 방 브로드캐스트 프레임만 0이 아님)
+        struct OutgoingFrame {
+            SharedFrame frame;
+            uint64_t roomSeq;
+        };
         mutable std::mutex sendMutex_;
-        std::queue<std::string> outgoingMessages_;
+        std::queue<OutgoingFrame> outgoingMessages_;
         bool writing_;
+        uint64_t lastQueuedRoomSeq_ = 0;    // sendMutex_ 보호
+        bool roomSeqReordered_ = false;     // sendMutex_ 보호
 
         SessionEventCallback disconnectCallback_;
         MessageEventCallback messageCallback_;
@@ -162,6 +237,9 @@ namespace Blokus::Server {
         void handleWrite(const boost::system::error_code& error, size_t bytesTransferred);
 
         void processMessage(const std::string& message);
+        bool admitIncomingMessage();    // 세션별 수신 한도 (MessageHandler 파싱 전)
+        void scheduleAuthDeadline(std::chrono::steady_clock::duration delay);
+        void releaseAdmissionSlot();
         void handleError(const boost::system::error_code& error);
         void cleanup();
 
@@ -0,0 +1,78 @@
+#pragma once
+
+#include "DatabaseManager.h"  // UserAccount, UserSettings
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Blokus {
+    namespace Server {
+
+        class Session;
+        using SessionPtr = std::shared_ptr<Session>;
+
+        // ========================================
+        // SessionResumeRegistry 클래스
+        // 연결이 끊긴 세션의 재개 토큰 관리
+        // - 인증 성공 시 사용자당 토큰 하나 발급 (재발급 시 이전 토큰 폐기)
+        // - 방/게임 중 연결이 끊기면 좌석을 유예 시간 동안 보류 (park)
+        // - 새 연결이 resume:토큰을 보내면 보류된 좌석과 인증 정보를 넘겨받음 (claim)
+        // - 유예 시간이 지난 좌석은 collectExpired()로 꺼내 방에서 정리
+        // ========================================
+        class SessionResumeRegistry {
+        public:
+            using Clock = std::chrono::steady_clock;
+
+            struct Ticket {
+                std::string token;
+                std::string userId;
+                std::string username;
+                std::optional<UserAccount> account;
+                std::optional<UserSettings> settings;
+                std::weak_ptr<Session> previousSession;
+
+                // 보류 상태 (연결이 끊긴 뒤에만 설정)
+                bool parked = false;
+                int roomId = -1;
+                Clock::time_point deadline{};
+            };
+
+            explicit SessionResumeRegistry(std::chrono::seconds graceWindow);
+
+            // 인증 성공 시 발급 (같은 사용자의 보류된 좌석이 있으면 함께 돌려줌 -> 호출자가 방에서 정리)
+            std::string issue(const SessionPtr& session, std::optional<Ticket>* replacedParked = nullptr);
+
+            // 연결 끊김 시 좌석 보류 (발급된 토큰이 없거나 다른 세션의 토큰이면 false)
+            bool park(const std::string& userId, const std::string& sessionId, int roomId);
+
+            // 재개 요청 (토큰은 1회용, 성공 시 제거됨)
+            std::optional<Ticket> claim(const std::string& token);
+
+            // 로그아웃 / 정상 종료 시 폐기
+            void revoke(const std::string& userId);
+
+            // 유예 시간이 지난 보류 좌석 (제거 후 반환)
+            std::vector<Ticket> collectExpired(Clock::time_point now = Clock::now());
+
+            std::chrono::seconds getGraceWindow() const { return m_graceWindow; }
+            size_t getParkedCount() const;
+
+        private:
+            static std::string generateToken();
+            void eraseLocked(const std::string& token);
+
+        private:
+            const std::chrono::seconds m_graceWindow;
+
+            mutable std::mutex m_mutex;
+            std::unordered_map<std::string, Ticket> m_tickets;          // 토큰 -> 티켓
+            std::unordered_map<std::string, std::string> m_userTokens;  // 사용자 ID -> 토큰
+            size_t m_parkedCount = 0;
+        };
+
+    } // namespace Server
+} // namespace Blokus
@@ -0,0 +1,112 @@
+#pragma once
+
+#include "MessageWriter.h"
+#include <boost/asio.hpp>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace Blokus {
+    namespace Server {
+
+        class Session;
+        using SessionPtr = std::shared_ptr<Session>;
+
+        // ========================================
+        // SpectatorChannel 클래스
+        // 방 하나의 관전 채널 (스냅샷 + 추가 전용 이벤트 로그)
+        // - 방은 자기 뮤텍스 안에서 publish()로 브로드캐스트 프레임을 로그에 붙이기만 함
+        // - 관전자 전송은 별도 실행기(팬아웃 스레드 풀)에서 샤드 단위로 병렬 처리
+        //   (방 -> 채널 -> 샤드 작업 -> 각 세션의 코어 큐)
+        // - 새 관전자는 방 뮤텍스 없이 스냅샷 + 로그를 받고 합류
+        // - 송신 큐가 밀린 관전자는 건너뛰고, 놓친 구간이 로그에서 밀려나면 최신 스냅샷으로 합쳐서 보냄
+        // ========================================
+        class SpectatorChannel : public std::enable_shared_from_this<SpectatorChannel> {
+        public:
+            struct Options {
+                size_t maxViewers = 500;
+                size_t maxPendingFrames = 32;   // 관전자 송신 큐가 이보다 길면 이번 전송은 건너뜀
+                size_t shardSize = 64;          // 팬아웃 작업 하나가 담당하는 관전자 수
+                size_t maxLogEntries = 64;      // 로그가 이만큼 쌓이면 방에 새 스냅샷 요청
+            };
+
+            enum class JoinResult {
+                Joined,
+                AlreadyJoined,
+                Full,
+                Closed
+            };
+
+            SpectatorChannel(int roomId, boost::asio::any_io_executor executor, const Options& options);
+            ~SpectatorChannel();
+
+            SpectatorChannel(const SpectatorChannel&) = delete;
+            SpectatorChannel& operator=(const SpectatorChannel&) = delete;
+
+            // 방 쪽 (방 뮤텍스 보유 상태에서 호출, 채널 뮤텍스만 잠깐 사용)
+            void publishSnapshot(SharedFrame snapshot);
+            bool publish(const SharedFrame& frame);     // true면 로그가 가득 차서 새 스냅샷이 필요
+            void close();
+
+            // 관전자 쪽 (방 뮤텍스를 사용하지 않음)
+            JoinResult addViewer(const SessionPtr& session);
+            bool removeViewer(const std::string& sessionId);
+            size_t getViewerCount() const { return m_viewerCount.load(std::memory_order_relaxed); }
+
+        private:
+            struct Viewer {
+                std::weak_ptr<Session> session;
+                std::string sessionId;
+                std::mutex mutex;               // 같은 관전자에게 보내는 순서 보장
+                uint64_t deliveredSeq = 0;
+                bool synced = false;
+            };
+
+            // 팬아웃 시점의 스냅샷 + 로그 (log[i]의 순번은 snapshotSeq + i + 1)
+            struct Backlog {
+                SharedFrame snapshot;
+                uint64_t snapshotSeq = 0;
+                std::vector<SharedFrame> log;
+            };
+
+            enum class DeliveryResult {
+                Delivered,
+                Lagging,
+                Gone
+            };
+
+            using ViewerList = std::vector<std::shared_ptr<Viewer>>;
+
+            void scheduleFanout();
+            void runFanout();
+            void fanoutShard(const std::shared_ptr<const Backlog>& backlog,
+                const std::shared_ptr<const ViewerList>& viewers, size_t begin, size_t end);
+            DeliveryResult deliverLocked(Viewer& viewer, const Backlog& backlog);
+            void scheduleRetry();
+            void pruneViewers();
+
+        private:
+            const int m_roomId;
+            const Options m_options;
+            boost::asio::any_io_executor m_executor;
+            boost::asio::steady_timer m_retryTimer;
+
+            mutable std::mutex m_mutex;
+            SharedFrame m_snapshot;
+            uint64_t m_snapshotSeq = 0;
+            uint64_t m_seq = 0;
+            std::vector<SharedFrame> m_log;
+            ViewerList m_viewers;
+            bool m_closed = false;
+
+            std::atomic<size_t> m_viewerCount{ 0 };
+            std::atomic<bool> m_fanoutScheduled{ false };
+            std::atomic<bool> m_retryScheduled{ false };
+        };
+
+        using SpectatorChannelPtr = std::shared_ptr<SpectatorChannel>;
+
+    } // namespace Server
+} // namespace Blokus
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+
+namespace Blokus {
+    namespace Server {
+
+        // ========================================
+        // TokenBucket
+        // 초당 ratePerSecond개씩 최대 burst개까지 충전되는 전송 한도
+        // 스레드 안전하지 않음 (호출자가 잠금 / 단일 스레드에서 사용)
+        // ========================================
+        struct TokenBucket {
+            using Clock = std::chrono::steady_clock;
+
+            double tokens = 0.0;
+            Clock::time_point lastRefill{};
+
+            TokenBucket() = default;
+            TokenBucket(double burst, Clock::time_point now) : tokens(burst), lastRefill(now) {}
+
+            bool tryConsume(double ratePerSecond, double burst, Clock::time_point now) {
+                double elapsed = std::chrono::duration<double>(now - lastRefill).count();
+                tokens = std::min(burst, tokens + elapsed * ratePerSecond);
+                lastRefill = now;
+
+                if (tokens < 1.0) {
+                    return false;
+                }
+                tokens -= 1.0;
+                return true;
+            }
+
+            // 마지막 사용 후 가득 찰 만큼 시간이 지났으면 새 버킷과 같음 (정리 대상)
+            bool isRefilled(double ratePerSecond, double burst, Clock::time_point now) const {
+                return std::chrono::duration<double>(now - lastRefill).count() * ratePerSecond + tokens >= burst;
+            }
+        };
+
+    } // namespace Server
+} // namespace Blokus
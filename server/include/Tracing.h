@@ -0,0 +1,101 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+namespace Blokus {
+    namespace Server {
+
+        // ========================================
+        // TraceContext
+        // 현재 스레드가 처리 중인 추적 (샘플링된 루트 스팬 아래에서만 sampled=true)
+        // 다른 스레드(DB 실행기 등)로 작업을 넘길 때 함께 복사해 전달
+        // ========================================
+        struct TraceContext {
+            uint64_t traceId = 0;
+            bool sampled = false;
+        };
+
+        // ========================================
+        // Tracer
+        // 스팬을 스레드별 링 버퍼에 기록하고 요청 시 Chrome trace / Perfetto JSON으로 덤프
+        // - 샘플링 끔(기본): 루트 스팬은 원자 변수 1회 읽기, 자식 스팬은 thread_local 플래그 1회 확인
+        // - 링 버퍼는 소유 스레드만 쓰고, 덤프는 덮어써졌을 수 있는 구간을 버리고 읽음
+        // ========================================
+        class Tracer {
+        public:
+            // sampleEvery: 루트 스팬 N개 중 1개 기록 (0 = 끔, 1 = 전부)
+            static void configure(int sampleEvery, size_t eventsPerThread);
+            static void setSampleEvery(int sampleEvery);
+            static int getSampleEvery() { return s_sampleEvery.load(std::memory_order_relaxed); }
+
+            static TraceContext currentContext();
+            static void setCurrentContext(const TraceContext& context);
+
+            // {"traceEvents":[...]} 형식 (chrome://tracing, ui.perfetto.dev에서 열기)
+            static std::string dumpChromeTrace();
+
+            static uint64_t nowNanos();
+
+        private:
+            friend class TraceSpan;
+
+            static bool sampleRoot();
+            static uint64_t nextTraceId();
+            static void record(const char* name, uint64_t startNs, uint64_t durationNs, uint64_t traceId, int64_t arg);
+
+            static std::atomic<int> s_sampleEvery;
+        };
+
+        // ========================================
+        // TraceSpan
+        // 범위 기반 스팬 (name은 문자열 리터럴 등 수명이 긴 문자열만 사용)
+        // - 일반 스팬: 현재 스레드가 샘플링된 추적 안에 있을 때만 기록
+        // - 루트 스팬(TraceSpan::root): 샘플링 여부를 결정하고 새 추적을 시작
+        // ========================================
+        class TraceSpan {
+        public:
+            explicit TraceSpan(const char* name, int64_t arg = -1);
+            ~TraceSpan();
+
+            static TraceSpan root(const char* name, int64_t arg = -1);
+
+            TraceSpan(const TraceSpan&) = delete;
+            TraceSpan& operator=(const TraceSpan&) = delete;
+
+            void setArg(int64_t arg) { m_arg = arg; }
+            bool isRecording() const { return m_recording; }
+
+        private:
+            struct RootTag {};
+            TraceSpan(const char* name, int64_t arg, RootTag);
+
+        private:
+            const char* m_name;
+            int64_t m_arg;
+            uint64_t m_startNs = 0;
+            uint64_t m_traceId = 0;
+            bool m_recording = false;
+            bool m_ownsContext = false;
+            TraceContext m_previousContext;
+        };
+
+        // ========================================
+        // TraceContextScope
+        // 전달받은 추적 컨텍스트를 현재 스레드에 설치하고 범위를 벗어나면 복원
+        // ========================================
+        class TraceContextScope {
+        public:
+            explicit TraceContextScope(const TraceContext& context);
+            ~TraceContextScope();
+
+            TraceContextScope(const TraceContextScope&) = delete;
+            TraceContextScope& operator=(const TraceContextScope&) = delete;
+
+        private:
+            TraceContext m_previous;
+        };
+
+    } // namespace Server
+} // namespace Blokus
@@ -0,0 +1,64 @@
+#pragma once
+
+#include "DatabaseManager.h"
+#include <string>
+#include <vector>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+
+namespace Blokus {
+    namespace Server {
+
+        // ========================================
+        // UserStatsCache 클래스
+        // 사용자 프로필/통계의 메모리 캐시 (write-behind)
+        // - 게임 결과는 즉시 캐시에 반영하고, DB 반영은 GameResultPersister가 유저당 1행으로 합산하여 처리
+        // - DB에 아직 반영되지 않은(dirty) 항목은 축출하지 않음
+        // ========================================
+        class UserStatsCache {
+        public:
+            UserStatsCache(std::shared_ptr<DatabaseManager> dbManager, size_t maxEntries);
+
+            // DB에서 읽은 계정 등록 (미반영 결과가 있으면 통계는 캐시 값을 유지하고 최종 값을 반환)
+            UserAccount put(const UserAccount& account);
+
+            // 조회
+            std::optional<UserAccount> get(uint32_t userId);
+            std::optional<UserAccount> findByName(const std::string& name);  // username 또는 display_name
+
+            // 게임 결과 1행을 캐시에 반영 (캐시에 없는 사용자는 nullopt)
+            std::optional<UserAccount> applyGameResult(const GameResultRow& row);
+
+            // DB 반영 완료된 결과 행 통지 (dirty 카운트 감소, applyGameResult가 값을 돌려준 행만 전달)
+            void markFlushed(const std::vector<GameResultRow>& rows);
+
+            // 상태 확인
+            size_t size() const;
+            size_t getDirtyCount() const;
+
+        private:
+            struct Entry {
+                UserAccount account;
+                int pendingRows = 0;  // DB에 아직 반영되지 않은 결과 행 수
+                std::list<uint32_t>::iterator lruIt;
+            };
+
+            void touchLocked(Entry& entry);
+            void evictLocked();
+            static std::string normalizeName(const std::string& name);
+
+        private:
+            std::shared_ptr<DatabaseManager> m_dbManager;
+            size_t m_maxEntries;
+
+            std::unordered_map<uint32_t, Entry> m_entries;
+            std::unordered_map<std::string, uint32_t> m_nameIndex;  // 소문자 username/display_name -> userId
+            std::list<uint32_t> m_lru;                              // 앞쪽이 최근 사용
+            mutable std::mutex m_mutex;
+        };
+
+    } // namespace Server
+} // namespace Blokus
@@ -0,0 +1,583 @@
+#include "BotClient.h"
+#include <spdlog/spdlog.h>
+#include <sstream>
+
+namespace Blokus::LoadGen {
+
+    namespace {
+        std::vector<std::string> splitFields(const std::string& message) {
+            std::vector<std::string> fields;
+            std::string field;
+            std::istringstream iss(message);
+            while (std::getline(iss, field, ':')) {
+                fields.push_back(field);
+            }
+            return fields;
+        }
+
+        bool startsWith(const std::string& text, const char* prefix) {
+            return text.rfind(prefix, 0) == 0;
+        }
+
+        // 서버 JSON은 평평한 정수 필드 위주라 필요한 값만 직접 추출 (첫 번째 일치 사용)
+        int extractJsonInt(const std::string& json, const char* key, int defaultValue = -1) {
+            std::string needle = std::string("\"") + key + "\":";
+            size_t pos = json.find(needle);
+            if (pos == std::string::npos) {
+                return defaultValue;
+            }
+            pos += needle.size();
+
+            bool negative = false;
+            if (pos < json.size() && json[pos] == '-') {
+                negative = true;
+                ++pos;
+            }
+
+            int value = 0;
+            bool hasDigit = false;
+            while (pos < json.size() && json[pos] >= '0' && json[pos] <= '9') {
+                value = value * 10 + (json[pos] - '0');
+                hasDigit = true;
+                ++pos;
+            }
+            if (!hasDigit) {
+                return defaultValue;
+            }
+            return negative ? -value : value;
+        }
+    }
+
+    // ========================================
+    // RoomGroup
+    // ========================================
+
+    void RoomGroup::publishRoom(int createdRoomId) {
+        roomId = createdRoomId;
+        for (auto& weakMember : members) {
+            if (auto member = weakMember.lock()) {
+                member->onRoomAvailable(createdRoomId);
+            }
+        }
+    }
+
+    // ========================================
+    // 생성자
+    // ========================================
+
+    BotClient::BotClient(boost::asio::io_context& ioContext, const LoadConfig& config, LoadStats& stats,
+        std::shared_ptr<RoomGroup> group, int botIndex, bool isHost,
+        const boost::asio::ip::tcp::endpoint& serverEndpoint)
+        : m_ioContext(ioContext)
+        , m_socket(ioContext)
+        , m_pingTimer(ioContext)
+        , m_actionTimer(ioContext)
+        , m_readBuffer(64 * 1024)
+        , m_config(config)
+        , m_stats(stats)
+        , m_group(std::move(group))
+        , m_serverEndpoint(serverEndpoint)
+        , m_botIndex(botIndex)
+        , m_isHost(isHost)
+        , m_planner(static_cast<uint32_t>(botIndex) * 2654435761u + 1)
+    {
+    }
+
+    // ========================================
+    // 연결/종료
+    // ========================================
+
+    void BotClient::start() {
+        boost::system::error_code ec;
+        m_socket.open(m_serverEndpoint.protocol(), ec);
+        if (ec) {
+            closeWithError("소켓 생성", ec);
+            return;
+        }
+
+        // 같은 IP 중복 로그인 차단을 피하기 위해 출발지 주소를 봇마다 나눠 사용
+        if (!m_config.sourceAddresses.empty()) {
+            const std::string& source = m_config.sourceAddresses[m_botIndex % m_config.sourceAddresses.size()];
+            auto address = boost::asio::ip::make_address(source, ec);
+            if (!ec) {
+                m_socket.bind(boost::asio::ip::tcp::endpoint(address, 0), ec);
+            }
+            if (ec) {
+                closeWithError("출발지 주소 바인드", ec);
+                return;
+            }
+        }
+
+        m_stats.connectAttempts++;
+        m_connectStartedAt = std::chrono::steady_clock::now();
+
+        auto self = shared_from_this();
+        m_socket.async_connect(m_serverEndpoint, [this, self](const boost::system::error_code& connectError) {
+            if (connectError) {
+                m_stats.connectFailures++;
+                closeWithError("연결", connectError);
+                return;
+            }
+
+            m_stats.connected++;
+            m_stats.activeConnections++;
+            m_stats.recordLatency(RequestKind::Connect, std::chrono::steady_clock::now() - m_connectStartedAt);
+
+            boost::system::error_code optionError;
+            m_socket.set_option(boost::asio::ip::tcp::no_delay(true), optionError);
+
+            m_phase = Phase::LoggingIn;
+            startRead();
+
+            m_username = m_config.namePrefix + std::to_string(m_botIndex);
+            send("guest:" + m_username, RequestKind::GuestLogin);
+        });
+    }
+
+    void BotClient::stop() {
+        if (m_phase == Phase::Stopped) {
+            return;
+        }
+
+        bool wasConnected = m_phase != Phase::Connecting;
+        m_phase = Phase::Stopped;
+        m_pingTimer.cancel();
+        m_actionTimer.cancel();
+
+        boost::system::error_code ec;
+        m_socket.shutdown(boost::asio::ip::tcp::socket::shutdown_both, ec);
+        m_socket.close(ec);
+
+        if (wasConnected) {
+            m_stats.activeConnections--;
+        }
+    }
+
+    void BotClient::closeWithError(const char* where, const boost::system::error_code& ec) {
+        if (m_phase == Phase::Stopped) {
+            return;
+        }
+
+        if (ec != boost::asio::error::operation_aborted) {
+            spdlog::debug("봇 {} {} 실패: {}", m_botIndex, where, ec.message());
+            if (m_phase != Phase::Connecting) {
+                m_stats.disconnects++;
+            }
+        }
+        stop();
+    }
+
+    // ========================================
+    // 송수신
+    // ========================================
+
+    void BotClient::startRead() {
+        auto self = shared_from_this();
+        boost::asio::async_read_until(m_socket, m_readBuffer, '\n',
+            [this, self](const boost::system::error_code& ec, size_t bytes) {
+                handleRead(ec, bytes);
+            });
+    }
+
+    void BotClient::handleRead(const boost::system::error_code& ec, size_t bytes) {
+        if (ec) {
+            closeWithError("수신", ec);
+            return;
+        }
+
+        m_stats.bytesReceived += bytes;
+
+        std::string message(boost::asio::buffers_begin(m_readBuffer.data()),
+            boost::asio::buffers_begin(m_readBuffer.data()) + bytes - 1);
+        m_readBuffer.consume(bytes);
+
+        if (!message.empty() && message.back() == '\r') {
+            message.pop_back();
+        }
+
+        m_stats.messagesReceived++;
+        handleMessage(message);
+
+        if (m_phase != Phase::Stopped) {
+            startRead();
+        }
+    }
+
+    void BotClient::send(const std::string& message, RequestKind kind) {
+        m_pending.push_back({ kind, std::chrono::steady_clock::now() });
+        sendRaw(message);
+    }
+
+    void BotClient::sendRaw(const std::string& message) {
+        if (m_phase == Phase::Stopped) {
+            return;
+        }
+
+        bool writeInProgress = !m_writeQueue.empty();
+        m_writeQueue.push_back(message + "\n");
+        if (!writeInProgress) {
+            doWrite();
+        }
+    }
+
+    void BotClient::doWrite() {
+        auto self = shared_from_this();
+        boost::asio::async_write(m_socket, boost::asio::buffer(m_writeQueue.front()),
+            [this, self](const boost::system::error_code& ec, size_t bytes) {
+                if (ec) {
+                    closeWithError("송신", ec);
+                    return;
+                }
+
+                m_stats.messagesSent++;
+                m_stats.bytesSent += bytes;
+
+                m_writeQueue.pop_front();
+                if (!m_writeQueue.empty() && m_phase != Phase::Stopped) {
+                    doWrite();
+                }
+            });
+    }
+
+    // ========================================
+    // 응답 대기 목록
+    // ========================================
+
+    void BotClient::completeRequest(RequestKind kind) {
+        for (auto it = m_pending.begin(); it != m_pending.end(); ++it) {
+            if (it->kind == kind) {
+                m_stats.recordLatency(kind, std::chrono::steady_clock::now() - it->sentAt);
+                m_pending.erase(it);
+                return;
+            }
+        }
+    }
+
+    void BotClient::failOldestRequest() {
+        if (m_pending.empty()) {
+            return;
+        }
+
+        RequestKind kind = m_pending.front().kind;
+        m_pending.pop_front();
+
+        if (kind == RequestKind::StartGame) {
+            m_startRequested = false;
+        }
+    }
+
+    // ========================================
+    // 메시지 처리
+    // ========================================
+
+    void BotClient::handleMessage(const std::string& message) {
+        if (message == "pong") {
+            completeRequest(RequestKind::Ping);
+            return;
+        }
+
+        if (startsWith(message, "ERROR:")) {
+            m_stats.recordError(message.substr(6));
+            failOldestRequest();
+            return;
+        }
+
+        if (startsWith(message, "BLOCK_PLACED:")) {
+            handleBlockPlaced(message.substr(13));
+            return;
+        }
+        if (startsWith(message, "TURN_CHANGED:")) {
+            std::string json = message.substr(13);
+            handleTurn(extractJsonInt(json, "playerColor"), extractJsonInt(json, "turnNumber"));
+            return;
+        }
+        if (startsWith(message, "GAME_STATE_UPDATE:")) {
+            std::string json = message.substr(18);
+            handleTurn(extractJsonInt(json, "currentPlayer"), extractJsonInt(json, "turnNumber"));
+            return;
+        }
+        if (message == "GAME_MOVE_SUCCESS") {
+            completeRequest(RequestKind::Move);
+            return;
+        }
+
+        std::vector<std::string> fields = splitFields(message);
+        if (fields.empty()) {
+            return;
+        }
+        const std::string& type = fields[0];
+
+        if (type == "GUEST_LOGIN_SUCCESS" && fields.size() >= 2) {
+            completeRequest(RequestKind::GuestLogin);
+            m_username = fields[1];
+            m_phase = Phase::InLobby;
+            schedulePing();
+
+            if (m_isHost) {
+                send("room:create:" + m_config.namePrefix + "room" + std::to_string(m_group->index), RequestKind::CreateRoom);
+            }
+            else if (m_group->roomId > 0) {
+                joinRoom();
+            }
+        }
+        else if (type == "ROOM_CREATED" && fields.size() >= 2) {
+            completeRequest(RequestKind::CreateRoom);
+            m_phase = Phase::InRoom;
+            m_group->publishRoom(std::stoi(fields[1]));
+        }
+        else if (type == "ROOM_JOIN_SUCCESS") {
+            completeRequest(RequestKind::JoinRoom);
+            m_phase = Phase::InRoom;
+            sendReady();
+        }
+        else if (type == "ROOM_INFO") {
+            handleRoomInfo(fields);
+        }
+        else if (type == "PLAYER_READY") {
+            handlePlayerReady(fields);
+        }
+        else if (type == "GAME_STARTED") {
+            completeRequest(RequestKind::StartGame);
+            m_phase = Phase::Playing;
+            m_startRequested = false;
+            m_lastActedTurn = -1;
+            m_planner.reset();
+            resetBoardSeq();
+            if (m_isHost) {
+                m_stats.gamesStarted++;
+            }
+        }
+        else if (type == "GAME_PLAYER_INFO") {
+            handleGamePlayerInfo(fields);
+        }
+        else if (type == "GAME_ENDED") {
+            handleGameEnded();
+        }
+    }
+
+    void BotClient::handleRoomInfo(const std::vector<std::string>& fields) {
+        // ROOM_INFO:id:name:host:count:max:private:playing:mode[:userId,username,display,isHost,isReady,color]...
+        if (!m_isHost || fields.size() < 9) {
+            return;
+        }
+
+        m_readyByUsername.clear();
+        for (size_t i = 9; i < fields.size(); ++i) {
+            std::vector<std::string> player;
+            std::string part;
+            std::istringstream iss(fields[i]);
+            while (std::getline(iss, part, ',')) {
+                player.push_back(part);
+            }
+            if (player.size() < 6 || player[3] == "1") {
+                continue;
+            }
+            m_readyByUsername[player[1]] = player[4] == "1";
+        }
+        m_roomPlayerCount = static_cast<int>(fields.size() - 9);
+
+        if (fields[7] == "0") {
+            tryStartGame();
+        }
+    }
+
+    void BotClient::handlePlayerReady(const std::vector<std::string>& fields) {
+        // 직접 응답 PLAYER_READY:1 / 방 브로드캐스트 PLAYER_READY:username:1
+        if (fields.size() == 2) {
+            completeRequest(RequestKind::Ready);
+            return;
+        }
+
+        if (m_isHost && fields.size() >= 3 && fields[1] != m_username) {
+            m_readyByUsername[fields[1]] = fields[2] == "1";
+            tryStartGame();
+        }
+    }
+
+    void BotClient::handleGamePlayerInfo(const std::vector<std::string>& fields) {
+        // GAME_PLAYER_INFO:username,color:username,color...
+        for (size_t i = 1; i < fields.size(); ++i) {
+            size_t comma = fields[i].rfind(',');
+            if (comma == std::string::npos) {
+                continue;
+            }
+            if (fields[i].substr(0, comma) == m_username) {
+                m_myColor = std::stoi(fields[i].substr(comma + 1));
+            }
+        }
+    }
+
+    void BotClient::handleTurn(int currentColor, int turnNumber) {
+        if (m_phase != Phase::Playing || currentColor != m_myColor || m_myColor == 0) {
+            return;
+        }
+        // 같은 라운드의 GAME_STATE_UPDATE/TURN_CHANGED 중복 알림은 한 번만 처리
+        if (turnNumber == m_lastActedTurn) {
+            return;
+        }
+        m_lastActedTurn = turnNumber;
+        scheduleMove(turnNumber);
+    }
+
+    void BotClient::handleBlockPlaced(const std::string& json) {
+        Common::BlockPlacement placement;
+        placement.type = static_cast<Common::BlockType>(extractJsonInt(json, "blockType", 0));
+        placement.position = { extractJsonInt(json, "row", 0), extractJsonInt(json, "col", 0) };
+        placement.rotation = static_cast<Common::Rotation>(extractJsonInt(json, "rotation", 0));
+        placement.flip = static_cast<Common::FlipState>(extractJsonInt(json, "flip", 0));
+        placement.player = static_cast<Common::PlayerColor>(extractJsonInt(json, "playerColor", 0));
+
+        // 순번이 없는 서버는 도착 순서대로 반영
+        int seq = extractJsonInt(json, "seq", 0);
+        if (seq <= 0) {
+            applyBoardPlacement(placement);
+            return;
+        }
+
+        // 이미 반영한 순번 (세션 재개 재전송 등)
+        if (static_cast<uint64_t>(seq) <= m_boardSeq) {
+            m_stats.boardSeqOutOfOrder++;
+            return;
+        }
+
+        // 앞 순번이 아직 안 왔으면 불일치로 보지 않고 보류 (빈 순번이 채워지면 이어서 반영)
+        if (static_cast<uint64_t>(seq) > m_boardSeq + 1) {
+            m_stats.boardSeqOutOfOrder++;
+            m_heldPlacements.emplace(static_cast<uint64_t>(seq), placement);
+            return;
+        }
+
+        applyBoardPlacement(placement);
+        m_boardSeq = static_cast<uint64_t>(seq);
+        for (auto it = m_heldPlacements.begin(); it != m_heldPlacements.end() && it->first == m_boardSeq + 1;
+            it = m_heldPlacements.erase(it)) {
+            applyBoardPlacement(it->second);
+            m_boardSeq = it->first;
+        }
+    }
+
+    void BotClient::applyBoardPlacement(const Common::BlockPlacement& placement) {
+        if (!m_planner.applyPlacement(placement)) {
+            m_stats.boardDesyncs++;
+        }
+    }
+
+    void BotClient::resetBoardSeq() {
+        // 게임이 끝날 때까지 채워지지 않은 순번은 실제 불일치
+        m_stats.boardDesyncs += m_heldPlacements.size();
+        m_heldPlacements.clear();
+        m_boardSeq = 0;
+    }
+
+    void BotClient::handleGameEnded() {
+        if (m_phase != Phase::Playing) {
+            return;
+        }
+
+        m_phase = Phase::InRoom;
+        m_myColor = 0;
+        m_actionTimer.cancel();
+        m_planner.reset();
+        resetBoardSeq();
+
+        if (m_isHost) {
+            m_stats.gamesCompleted++;
+            m_readyByUsername.clear();
+        }
+        else {
+            // 게임 종료 시 서버가 준비 상태를 해제하므로 다시 준비
+            sendReady();
+        }
+    }
+
+    // ========================================
+    // 동작
+    // ========================================
+
+    void BotClient::onRoomAvailable(int roomId) {
+        if (m_isHost || m_phase != Phase::InLobby) {
+            return;
+        }
+        (void)roomId;
+        joinRoom();
+    }
+
+    void BotClient::joinRoom() {
+        send("room:join:" + std::to_string(m_group->roomId), RequestKind::JoinRoom);
+    }
+
+    void BotClient::sendReady() {
+        send("room:ready:1", RequestKind::Ready);
+    }
+
+    void BotClient::tryStartGame() {
+        if (!m_isHost || m_phase != Phase::InRoom || m_startRequested) {
+            return;
+        }
+        if (m_roomPlayerCount < m_config.roomSize) {
+            return;
+        }
+        for (const auto& [username, ready] : m_readyByUsername) {
+            if (!ready) {
+                return;
+            }
+        }
+
+        m_startRequested = true;
+        send("room:start", RequestKind::StartGame);
+    }
+
+    void BotClient::scheduleMove(int turnNumber) {
+        if (m_config.thinkTimeMs <= 0) {
+            makeMove(turnNumber);
+            return;
+        }
+
+        auto self = shared_from_this();
+        m_actionTimer.expires_after(std::chrono::milliseconds(m_config.thinkTimeMs));
+        m_actionTimer.async_wait([this, self, turnNumber](const boost::system::error_code& ec) {
+            if (!ec) {
+                makeMove(turnNumber);
+            }
+        });
+    }
+
+    void BotClient::makeMove(int turnNumber) {
+        if (m_phase != Phase::Playing || turnNumber != m_lastActedTurn) {
+            return;
+        }
+
+        auto move = m_planner.chooseMove(static_cast<Common::PlayerColor>(m_myColor));
+        if (!move) {
+            // 서버가 배치 불가 플레이어를 자동 스킵하므로 여기 오면 로컬 보드 불일치 가능성
+            m_stats.movesUnavailable++;
+            return;
+        }
+
+        // game:move:블록타입:x(열):y(행):회전:뒤집기
+        std::ostringstream oss;
+        oss << "game:move:" << static_cast<int>(move->type)
+            << ":" << move->position.second << ":" << move->position.first
+            << ":" << static_cast<int>(move->rotation) << ":" << static_cast<int>(move->flip);
+
+        m_stats.movesSent++;
+        send(oss.str(), RequestKind::Move);
+    }
+
+    void BotClient::schedulePing() {
+        if (m_config.pingIntervalMs <= 0 || m_phase == Phase::Stopped) {
+            return;
+        }
+
+        auto self = shared_from_this();
+        m_pingTimer.expires_after(std::chrono::milliseconds(m_config.pingIntervalMs));
+        m_pingTimer.async_wait([this, self](const boost::system::error_code& ec) {
+            if (ec || m_phase == Phase::Stopped) {
+                return;
+            }
+            send("ping", RequestKind::Ping);
+            schedulePing();
+        });
+    }
+
+} // namespace Blokus::LoadGen
@@ -0,0 +1,143 @@
+#pragma once
+
+#include "LoadStats.h"
+#include "MovePlanner.h"
+#include <boost/asio.hpp>
+#include <chrono>
+#include <deque>
+#include <map>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Blokus::LoadGen {
+
+    class BotClient;
+
+    // ========================================
+    // 부하 생성 설정
+    // ========================================
+    struct LoadConfig {
+        std::string host = "127.0.0.1";
+        uint16_t port = 9999;
+        int connections = 100;
+        int roomSize = 4;
+        int threads = 4;
+        int rampPerSecond = 200;                    // 초당 새 연결 수
+        int durationSeconds = 60;
+        int pingIntervalMs = 5000;                  // 0이면 핑 없음
+        int thinkTimeMs = 0;                        // 내 턴이 온 뒤 수를 보내기까지 대기
+        std::vector<std::string> sourceAddresses;   // 비어 있으면 OS가 선택
+        std::string namePrefix = "lg";
+    };
+
+    // ========================================
+    // RoomGroup
+    // 한 방에 모이는 봇 묶음 (같은 io_context에서만 접근하므로 잠금 없음)
+    // ========================================
+    struct RoomGroup {
+        int index = 0;
+        int roomId = 0;                             // 호스트가 방을 만들면 설정
+        std::vector<std::weak_ptr<BotClient>> members;
+
+        void publishRoom(int createdRoomId);
+    };
+
+    // ========================================
+    // BotClient
+    // 헤드리스 TCP 클라이언트 1개
+    // 게스트 로그인 -> 방 생성/참가 -> 준비 -> 게임 진행을 반복하며 왕복 시간을 기록
+    // ========================================
+    class BotClient : public std::enable_shared_from_this<BotClient> {
+    public:
+        BotClient(boost::asio::io_context& ioContext, const LoadConfig& config, LoadStats& stats,
+            std::shared_ptr<RoomGroup> group, int botIndex, bool isHost,
+            const boost::asio::ip::tcp::endpoint& serverEndpoint);
+
+        void start();
+        void stop();                                // io_context 스레드에서 호출
+
+        // RoomGroup에서 호출 (방 id가 정해짐)
+        void onRoomAvailable(int roomId);
+
+    private:
+        enum class Phase {
+            Connecting,
+            LoggingIn,
+            InLobby,
+            InRoom,
+            Playing,
+            Stopped
+        };
+
+        // 네트워크
+        void startRead();
+        void handleRead(const boost::system::error_code& ec, size_t bytes);
+        void send(const std::string& message, RequestKind kind);
+        void sendRaw(const std::string& message);
+        void doWrite();
+        void closeWithError(const char* where, const boost::system::error_code& ec);
+
+        // 메시지 처리
+        void handleMessage(const std::string& message);
+        void handleRoomInfo(const std::vector<std::string>& fields);
+        void handlePlayerReady(const std::vector<std::string>& fields);
+        void handleGamePlayerInfo(const std::vector<std::string>& fields);
+        void handleTurn(int currentColor, int turnNumber);
+        void handleBlockPlaced(const std::string& json);
+        void applyBoardPlacement(const Common::BlockPlacement& placement);
+        void resetBoardSeq();
+        void handleGameEnded();
+
+        // 동작
+        void joinRoom();
+        void sendReady();
+        void tryStartGame();
+        void scheduleMove(int turnNumber);
+        void makeMove(int turnNumber);
+        void schedulePing();
+
+        // 응답 대기 목록 (서버는 세션별로 순서대로 응답)
+        void completeRequest(RequestKind kind);
+        void failOldestRequest();
+
+    private:
+        boost::asio::io_context& m_ioContext;
+        boost::asio::ip::tcp::socket m_socket;
+        boost::asio::steady_timer m_pingTimer;
+        boost::asio::steady_timer m_actionTimer;
+        boost::asio::streambuf m_readBuffer;
+        std::deque<std::string> m_writeQueue;
+
+        const LoadConfig& m_config;
+        LoadStats& m_stats;
+        std::shared_ptr<RoomGroup> m_group;
+        boost::asio::ip::tcp::endpoint m_serverEndpoint;
+
+        int m_botIndex;
+        bool m_isHost;
+        Phase m_phase = Phase::Connecting;
+        std::string m_username;
+
+        struct PendingRequest {
+            RequestKind kind;
+            std::chrono::steady_clock::time_point sentAt;
+        };
+        std::deque<PendingRequest> m_pending;
+        std::chrono::steady_clock::time_point m_connectStartedAt;
+
+        // 방 상태 (호스트가 시작 조건 판단에 사용)
+        int m_roomPlayerCount = 0;
+        std::unordered_map<std::string, bool> m_readyByUsername;
+        bool m_startRequested = false;
+
+        // 게임 상태
+        MovePlanner m_planner;
+        uint64_t m_boardSeq = 0;                                        // 로컬 보드에 반영한 마지막 배치 순번
+        std::map<uint64_t, Common::BlockPlacement> m_heldPlacements;    // 앞 순번을 기다리는 배치
+        int m_myColor = 0;
+        int m_lastActedTurn = -1;
+    };
+
+} // namespace Blokus::LoadGen
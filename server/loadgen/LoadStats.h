@@ -0,0 +1,172 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+
+namespace Blokus::LoadGen {
+
+    // ========================================
+    // 요청 종류 (요청 -> 응답 왕복 시간 측정 단위)
+    // ========================================
+    enum class RequestKind : uint8_t {
+        Connect = 0,
+        GuestLogin,
+        CreateRoom,
+        JoinRoom,
+        Ready,
+        StartGame,
+        Move,
+        Ping,
+        Count
+    };
+
+    inline const char* requestKindName(RequestKind kind) {
+        switch (kind) {
+        case RequestKind::Connect: return "connect";
+        case RequestKind::GuestLogin: return "guest_login";
+        case RequestKind::CreateRoom: return "room_create";
+        case RequestKind::JoinRoom: return "room_join";
+        case RequestKind::Ready: return "room_ready";
+        case RequestKind::StartGame: return "game_start";
+        case RequestKind::Move: return "game_move";
+        case RequestKind::Ping: return "ping";
+        default: return "unknown";
+        }
+    }
+
+    // ========================================
+    // LatencyHistogram
+    // 로그-선형 버킷 히스토그램 (2의 거듭제곱 구간마다 16칸, 상대 오차 약 6%)
+    // 여러 스레드에서 잠금 없이 기록
+    // ========================================
+    class LatencyHistogram {
+    public:
+        static constexpr int kSubBuckets = 16;
+        static constexpr int kMagnitudes = 40;
+        static constexpr int kBucketCount = kSubBuckets * kMagnitudes;
+
+        void record(uint64_t micros) {
+            m_buckets[bucketIndex(micros)].fetch_add(1, std::memory_order_relaxed);
+            m_count.fetch_add(1, std::memory_order_relaxed);
+            m_sum.fetch_add(micros, std::memory_order_relaxed);
+
+            uint64_t prevMax = m_max.load(std::memory_order_relaxed);
+            while (micros > prevMax && !m_max.compare_exchange_weak(prevMax, micros, std::memory_order_relaxed)) {
+            }
+        }
+
+        uint64_t count() const { return m_count.load(); }
+        uint64_t max() const { return m_max.load(); }
+        double mean() const { return count() > 0 ? static_cast<double>(m_sum.load()) / count() : 0.0; }
+
+        // 백분위 값 (버킷 상한, 마이크로초)
+        uint64_t percentile(double p) const {
+            uint64_t total = count();
+            if (total == 0) {
+                return 0;
+            }
+
+            uint64_t target = static_cast<uint64_t>(std::ceil(p * static_cast<double>(total)));
+            target = target == 0 ? 1 : target;
+
+            uint64_t seen = 0;
+            for (int i = 0; i < kBucketCount; ++i) {
+                seen += m_buckets[i].load(std::memory_order_relaxed);
+                if (seen >= target) {
+                    return std::min(bucketUpperBound(i), max());
+                }
+            }
+            return max();
+        }
+
+    private:
+        static int bucketIndex(uint64_t micros) {
+            if (micros < kSubBuckets) {
+                return static_cast<int>(micros);
+            }
+            int magnitude = 63 - __builtin_clzll(micros);       // floor(log2)
+            int shift = magnitude - 4;                          // 상위 5비트 중 하위 4비트를 보조 버킷으로
+            int sub = static_cast<int>((micros >> shift) & (kSubBuckets - 1));
+            int index = (magnitude - 3) * kSubBuckets + sub;
+            return std::min(index, kBucketCount - 1);
+        }
+
+        static uint64_t bucketUpperBound(int index) {
+            if (index < kSubBuckets) {
+                return static_cast<uint64_t>(index);
+            }
+            int magnitude = index / kSubBuckets + 3;
+            int sub = index % kSubBuckets;
+            int shift = magnitude - 4;
+            return ((static_cast<uint64_t>(kSubBuckets + sub + 1)) << shift) - 1;
+        }
+
+    private:
+        std::array<std::atomic<uint64_t>, kBucketCount> m_buckets{};
+        std::atomic<uint64_t> m_count{ 0 };
+        std::atomic<uint64_t> m_sum{ 0 };
+        std::atomic<uint64_t> m_max{ 0 };
+    };
+
+    // ========================================
+    // LoadStats
+    // 부하 생성기 전체 지표 (봇들이 공유)
+    // ========================================
+    struct LoadStats {
+        // 연결
+        std::atomic<uint64_t> connectAttempts{ 0 };
+        std::atomic<uint64_t> connected{ 0 };
+        std::atomic<uint64_t> connectFailures{ 0 };
+        std::atomic<uint64_t> disconnects{ 0 };
+        std::atomic<int64_t> activeConnections{ 0 };
+
+        // 처리량
+        std::atomic<uint64_t> messagesSent{ 0 };
+        std::atomic<uint64_t> messagesReceived{ 0 };
+        std::atomic<uint64_t> bytesSent{ 0 };
+        std::atomic<uint64_t> bytesReceived{ 0 };
+
+        // 게임
+        std::atomic<uint64_t> gamesStarted{ 0 };
+        std::atomic<uint64_t> gamesCompleted{ 0 };
+        std::atomic<uint64_t> movesSent{ 0 };
+        std::atomic<uint64_t> movesUnavailable{ 0 };   // 둘 곳이 없어 서버 스킵을 기다린 턴
+        std::atomic<uint64_t> boardDesyncs{ 0 };       // BLOCK_PLACED를 로컬 보드에 적용하지 못한 횟수
+        std::atomic<uint64_t> boardSeqOutOfOrder{ 0 };  // 순번이 건너뛰거나 되돌아가 도착한 BLOCK_PLACED (세션 전송 순서가 지켜지면 0)
+
+        // 서버 에러 응답
+        std::atomic<uint64_t> serverErrors{ 0 };
+
+        std::array<LatencyHistogram, static_cast<size_t>(RequestKind::Count)> latency;
+
+        void recordLatency(RequestKind kind, std::chrono::steady_clock::duration elapsed) {
+            auto micros = std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count();
+            latency[static_cast<size_t>(kind)].record(static_cast<uint64_t>(micros < 0 ? 0 : micros));
+        }
+
+        void recordError(const std::string& message) {
+            serverErrors.fetch_add(1, std::memory_order_relaxed);
+
+            // 에러 문구별 집계 (가변 부분이 길면 앞부분만)
+            std::string key = message.size() > 80 ? message.substr(0, 80) : message;
+            std::lock_guard<std::mutex> lock(m_errorMutex);
+            m_errorCounts[key]++;
+        }
+
+        std::map<std::string, uint64_t> getErrorCounts() const {
+            std::lock_guard<std::mutex> lock(m_errorMutex);
+            return m_errorCounts;
+        }
+
+    private:
+        mutable std::mutex m_errorMutex;
+        std::map<std::string, uint64_t> m_errorCounts;
+    };
+
+} // namespace Blokus::LoadGen
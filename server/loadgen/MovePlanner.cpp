@@ -0,0 +1,120 @@
+#include "MovePlanner.h"
+#include "Block.h"
+#include <algorithm>
+#include <set>
+
+namespace Blokus::LoadGen {
+
+    using namespace Blokus::Common;
+
+    MovePlanner::MovePlanner(uint32_t seed)
+        : m_rng(seed)
+    {
+    }
+
+    void MovePlanner::reset() {
+        m_logic.clearBoard();
+    }
+
+    bool MovePlanner::applyPlacement(const BlockPlacement& placement) {
+        return m_logic.placeBlock(placement);
+    }
+
+    std::optional<BlockPlacement> MovePlanner::chooseMove(PlayerColor color) {
+        Common::PositionList anchors = collectAnchors(color);
+        if (anchors.empty()) {
+            return std::nullopt;
+        }
+
+        // 큰 블록부터, 같은 크기는 무작위
+        std::vector<BlockType> blocks = m_logic.getAvailableBlocks(color);
+        std::shuffle(blocks.begin(), blocks.end(), m_rng);
+        std::stable_sort(blocks.begin(), blocks.end(), [](BlockType a, BlockType b) {
+            return Block(a).getSize() > Block(b).getSize();
+        });
+        std::shuffle(anchors.begin(), anchors.end(), m_rng);
+
+        static constexpr FlipState kFlips[] = { FlipState::Normal, FlipState::Horizontal };
+        static constexpr Rotation kRotations[] = {
+            Rotation::Degree_0, Rotation::Degree_90, Rotation::Degree_180, Rotation::Degree_270
+        };
+
+        for (BlockType type : blocks) {
+            // 회전/뒤집기 8가지 중 모양이 같은 것은 한 번만 시도
+            std::set<Common::PositionList> seenShapes;
+
+            for (FlipState flip : kFlips) {
+                for (Rotation rotation : kRotations) {
+                    Block block(type, color);
+                    block.setRotation(rotation);
+                    block.setFlipState(flip);
+
+                    Common::PositionList offsets = block.getAbsolutePositions({ 0, 0 });
+                    Common::PositionList sorted = offsets;
+                    std::sort(sorted.begin(), sorted.end());
+                    if (!seenShapes.insert(sorted).second) {
+                        continue;
+                    }
+
+                    // 블록의 각 칸을 후보 칸에 맞춰 보는 방식으로 기준 위치 계산
+                    for (const auto& anchor : anchors) {
+                        for (const auto& offset : offsets) {
+                            BlockPlacement placement;
+                            placement.type = type;
+                            placement.position = { anchor.first - offset.first, anchor.second - offset.second };
+                            placement.rotation = rotation;
+                            placement.flip = flip;
+                            placement.player = color;
+
+                            if (m_logic.canPlaceBlock(placement)) {
+                                return placement;
+                            }
+                        }
+                    }
+                }
+            }
+        }
+
+        return std::nullopt;
+    }
+
+    Common::PositionList MovePlanner::collectAnchors(PlayerColor color) const {
+        Common::PositionList anchors;
+
+        if (!m_logic.hasPlayerPlacedFirstBlock(color)) {
+            // 시작 모서리 규칙은 GameLogic이 검사하므로 네 모서리를 모두 후보로
+            for (const Common::Position& corner : { Common::Position{ 0, 0 }, Common::Position{ 0, BOARD_SIZE - 1 },
+                     Common::Position{ BOARD_SIZE - 1, 0 }, Common::Position{ BOARD_SIZE - 1, BOARD_SIZE - 1 } }) {
+                if (m_logic.getBoardCell(corner.first, corner.second) == PlayerColor::None) {
+                    anchors.push_back(corner);
+                }
+            }
+            return anchors;
+        }
+
+        bool marked[BOARD_SIZE][BOARD_SIZE] = {};
+        static constexpr int kDiagonals[4][2] = { { -1, -1 }, { -1, 1 }, { 1, -1 }, { 1, 1 } };
+
+        for (int row = 0; row < BOARD_SIZE; ++row) {
+            for (int col = 0; col < BOARD_SIZE; ++col) {
+                if (m_logic.getBoardCell(row, col) != color) {
+                    continue;
+                }
+                for (const auto& d : kDiagonals) {
+                    int r = row + d[0];
+                    int c = col + d[1];
+                    if (r < 0 || r >= BOARD_SIZE || c < 0 || c >= BOARD_SIZE || marked[r][c]) {
+                        continue;
+                    }
+                    if (m_logic.getBoardCell(r, c) == PlayerColor::None) {
+                        marked[r][c] = true;
+                        anchors.emplace_back(r, c);
+                    }
+                }
+            }
+        }
+
+        return anchors;
+    }
+
+} // namespace Blokus::LoadGen
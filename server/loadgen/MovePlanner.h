@@ -0,0 +1,35 @@
+#pragma once
+
+#include "GameLogic.h"
+#include <optional>
+#include <random>
+
+namespace Blokus::LoadGen {
+
+    // ========================================
+    // MovePlanner
+    // 서버와 같은 GameLogic으로 보드를 따라가며 합법적인 수를 고르는 봇 두뇌
+    // - 내 블록과 대각선으로 닿는 빈 칸(첫 수는 네 모서리)만 후보로 삼아 탐색량을 줄임
+    // - 큰 블록 우선, 같은 크기 안에서는 무작위 순서
+    // ========================================
+    class MovePlanner {
+    public:
+        explicit MovePlanner(uint32_t seed);
+
+        void reset();
+
+        // 서버가 알린 배치를 로컬 보드에 반영 (실패 시 false = 보드 불일치)
+        bool applyPlacement(const Common::BlockPlacement& placement);
+
+        // 지정한 색으로 둘 수 있는 수 (없으면 nullopt)
+        std::optional<Common::BlockPlacement> chooseMove(Common::PlayerColor color);
+
+    private:
+        Common::PositionList collectAnchors(Common::PlayerColor color) const;
+
+    private:
+        Common::GameLogic m_logic;
+        std::mt19937 m_rng;
+    };
+
+} // namespace Blokus::LoadGen
@@ -0,0 +1,288 @@
+// ========================================
+// Blokus 부하 생성기 / 장시간 구동 테스트 클라이언트
+// 한 프로세스에서 수천 개의 TCP 연결을 열어 게스트 로그인 -> 방 생성/참가 -> 게임 진행을 반복하고
+// 요청 종류별 왕복 시간 백분위, 서버 에러 응답, 처리량을 보고
+// ========================================
+
+#include "BotClient.h"
+#include "LoadStats.h"
+#include <spdlog/spdlog.h>
+#include <algorithm>
+#include <atomic>
+#include <csignal>
+#include <cstdio>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <thread>
+
+using namespace Blokus::LoadGen;
+
+namespace {
+    std::atomic<bool> g_stopRequested{ false };
+
+    void signalHandler(int) {
+        g_stopRequested = true;
+    }
+
+    void printUsage(const char* program) {
+        std::cout
+            << "사용법: " << program << " [옵션]\n"
+            << "  --host <addr>             서버 주소 (기본 127.0.0.1)\n"
+            << "  --port <port>             서버 포트 (기본 9999)\n"
+            << "  --connections <n>         전체 연결 수 (기본 100)\n"
+            << "  --room-size <2-4>         방당 인원 (기본 4)\n"
+            << "  --threads <n>             클라이언트 I/O 스레드 수 (기본 4)\n"
+            << "  --ramp <n>                초당 새 연결 수 (기본 200)\n"
+            << "  --duration <sec>          구동 시간 (기본 60)\n"
+            << "  --ping-interval-ms <ms>   핑 주기, 0이면 끔 (기본 5000)\n"
+            << "  --think-ms <ms>           수를 두기 전 대기 시간 (기본 0)\n"
+            << "  --source-ips <a,b,...>    출발지 주소 목록 (예: 127.0.0.2,127.0.0.3)\n"
+            << "  --report-interval <sec>   중간 보고 주기 (기본 5)\n"
+            << "  --verbose                 봇 디버그 로그 출력\n";
+    }
+
+    std::vector<std::string> splitComma(const std::string& text) {
+        std::vector<std::string> parts;
+        std::string part;
+        std::istringstream iss(text);
+        while (std::getline(iss, part, ',')) {
+            if (!part.empty()) {
+                parts.push_back(part);
+            }
+        }
+        return parts;
+    }
+
+    // ========================================
+    // 보고
+    // ========================================
+
+    struct Snapshot {
+        uint64_t sent = 0;
+        uint64_t received = 0;
+        uint64_t moves = 0;
+    };
+
+    void printInterval(const LoadStats& stats, Snapshot& last, double seconds) {
+        Snapshot now{ stats.messagesSent.load(), stats.messagesReceived.load(), stats.movesSent.load() };
+
+        spdlog::info("연결 {}/{} | 송신 {:.0f}/s 수신 {:.0f}/s 착수 {:.0f}/s | 게임 완료 {} | 에러 {} | move p99 {:.2f}ms",
+            stats.activeConnections.load(), stats.connectAttempts.load(),
+            (now.sent - last.sent) / seconds, (now.received - last.received) / seconds,
+            (now.moves - last.moves) / seconds, stats.gamesCompleted.load(), stats.serverErrors.load(),
+            stats.latency[static_cast<size_t>(RequestKind::Move)].percentile(0.99) / 1000.0);
+
+        last = now;
+    }
+
+    void printFinalReport(const LoadStats& stats, double elapsedSeconds) {
+        std::printf("\n==================== 부하 테스트 결과 ====================\n");
+        std::printf("구동 시간           : %.1f s\n", elapsedSeconds);
+        std::printf("연결 시도/성공/실패 : %llu / %llu / %llu (도중 끊김 %llu)\n",
+            (unsigned long long)stats.connectAttempts.load(), (unsigned long long)stats.connected.load(),
+            (unsigned long long)stats.connectFailures.load(), (unsigned long long)stats.disconnects.load());
+        std::printf("메시지 송신/수신    : %llu / %llu (%.0f / %.0f msg/s)\n",
+            (unsigned long long)stats.messagesSent.load(), (unsigned long long)stats.messagesReceived.load(),
+            stats.messagesSent.load() / elapsedSeconds, stats.messagesReceived.load() / elapsedSeconds);
+        std::printf("바이트 송신/수신    : %llu / %llu\n",
+            (unsigned long long)stats.bytesSent.load(), (unsigned long long)stats.bytesReceived.load());
+        std::printf("게임 시작/완료      : %llu / %llu\n",
+            (unsigned long long)stats.gamesStarted.load(), (unsigned long long)stats.gamesCompleted.load());
+        std::printf("착수/불가/보드불일치: %llu / %llu / %llu (순번 역전 %llu)\n",
+            (unsigned long long)stats.movesSent.load(), (unsigned long long)stats.movesUnavailable.load(),
+            (unsigned long long)stats.boardDesyncs.load(), (unsigned long long)stats.boardSeqOutOfOrder.load());
+
+        std::printf("\n%-12s %10s %10s %10s %10s %10s %10s %10s\n",
+            "요청(ms)", "count", "mean", "p50", "p90", "p99", "p99.9", "max");
+        for (size_t i = 0; i < static_cast<size_t>(RequestKind::Count); ++i) {
+            const auto& histogram = stats.latency[i];
+            if (histogram.count() == 0) {
+                continue;
+            }
+            std::printf("%-12s %10llu %10.2f %10.2f %10.2f %10.2f %10.2f %10.2f\n",
+                requestKindName(static_cast<RequestKind>(i)), (unsigned long long)histogram.count(),
+                histogram.mean() / 1000.0, histogram.percentile(0.50) / 1000.0, histogram.percentile(0.90) / 1000.0,
+                histogram.percentile(0.99) / 1000.0, histogram.percentile(0.999) / 1000.0, histogram.max() / 1000.0);
+        }
+
+        auto errors = stats.getErrorCounts();
+        std::printf("\n서버 에러 응답      : %llu\n", (unsigned long long)stats.serverErrors.load());
+        for (const auto& [message, count] : errors) {
+            std::printf("  %8llu  %s\n", (unsigned long long)count, message.c_str());
+        }
+        std::printf("==========================================================\n");
+    }
+}
+
+int main(int argc, char* argv[]) {
+    LoadConfig config;
+    int reportIntervalSeconds = 5;
+    bool verbose = false;
+
+    // ========================================
+    // 인자 파싱
+    // ========================================
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        auto next = [&]() -> std::string {
+            if (i + 1 >= argc) {
+                std::cerr << arg << " 옵션에 값이 필요합니다\n";
+                std::exit(1);
+            }
+            return argv[++i];
+        };
+
+        try {
+            if (arg == "--host") config.host = next();
+            else if (arg == "--port") config.port = static_cast<uint16_t>(std::stoi(next()));
+            else if (arg == "--connections") config.connections = std::stoi(next());
+            else if (arg == "--room-size") config.roomSize = std::stoi(next());
+            else if (arg == "--threads") config.threads = std::stoi(next());
+            else if (arg == "--ramp") config.rampPerSecond = std::stoi(next());
+            else if (arg == "--duration") config.durationSeconds = std::stoi(next());
+            else if (arg == "--ping-interval-ms") config.pingIntervalMs = std::stoi(next());
+            else if (arg == "--think-ms") config.thinkTimeMs = std::stoi(next());
+            else if (arg == "--source-ips") config.sourceAddresses = splitComma(next());
+            else if (arg == "--report-interval") reportIntervalSeconds = std::stoi(next());
+            else if (arg == "--verbose") verbose = true;
+            else if (arg == "--help" || arg == "-h") {
+                printUsage(argv[0]);
+                return 0;
+            }
+            else {
+                std::cerr << "알 수 없는 옵션: " << arg << "\n";
+                printUsage(argv[0]);
+                return 1;
+            }
+        }
+        catch (const std::exception&) {
+            std::cerr << arg << " 옵션 값이 올바르지 않습니다\n";
+            return 1;
+        }
+    }
+
+    config.roomSize = std::clamp(config.roomSize, 2, 4);
+    config.threads = std::max(1, config.threads);
+    config.connections = std::max(config.roomSize, config.connections);
+    config.rampPerSecond = std::max(1, config.rampPerSecond);
+    reportIntervalSeconds = std::max(1, reportIntervalSeconds);
+
+    // 게스트 이름 규칙(3~20자, 영문/숫자/_) 안에서 실행마다 겹치지 않도록 접두어에 난수 포함
+    char runTag[8];
+    std::snprintf(runTag, sizeof(runTag), "%04x", static_cast<unsigned>(std::random_device{}() & 0xffff));
+    config.namePrefix = std::string("lg") + runTag + "_";
+
+    spdlog::set_level(verbose ? spdlog::level::debug : spdlog::level::info);
+    std::signal(SIGINT, signalHandler);
+    std::signal(SIGTERM, signalHandler);
+
+    // ========================================
+    // I/O 스레드 및 서버 주소
+    // ========================================
+    std::vector<std::unique_ptr<boost::asio::io_context>> ioContexts;
+    std::vector<std::unique_ptr<boost::asio::executor_work_guard<boost::asio::io_context::executor_type>>> workGuards;
+    for (int i = 0; i < config.threads; ++i) {
+        ioContexts.push_back(std::make_unique<boost::asio::io_context>(1));
+        workGuards.push_back(std::make_unique<boost::asio::executor_work_guard<boost::asio::io_context::executor_type>>(
+            boost::asio::make_work_guard(*ioContexts.back())));
+    }
+
+    boost::asio::ip::tcp::endpoint serverEndpoint;
+    try {
+        boost::asio::ip::tcp::resolver resolver(*ioContexts.front());
+        serverEndpoint = *resolver.resolve(config.host, std::to_string(config.port)).begin();
+    }
+    catch (const std::exception& e) {
+        spdlog::error("서버 주소 확인 실패: {}", e.what());
+        return 1;
+    }
+
+    std::vector<std::thread> threads;
+    for (auto& ioContext : ioContexts) {
+        threads.emplace_back([&ioContext]() {
+            ioContext->run();
+        });
+    }
+
+    spdlog::info("부하 생성 시작: {}:{} 연결 {}개 (방당 {}명), 스레드 {}, 초당 {}개, {}초",
+        config.host, config.port, config.connections, config.roomSize, config.threads,
+        config.rampPerSecond, config.durationSeconds);
+
+    // ========================================
+    // 봇 생성 (방 단위로 같은 io_context에 배치)
+    // ========================================
+    LoadStats stats;
+    std::vector<std::shared_ptr<BotClient>> bots;
+    std::vector<boost::asio::io_context*> botContexts;
+    bots.reserve(config.connections);
+
+    auto startedAt = std::chrono::steady_clock::now();
+    auto lastReportAt = startedAt;
+    Snapshot lastSnapshot;
+
+    int groupCount = (config.connections + config.roomSize - 1) / config.roomSize;
+    int created = 0;
+    auto rampInterval = std::chrono::microseconds(1000000 / config.rampPerSecond);
+    auto nextStartAt = startedAt;
+
+    for (int groupIndex = 0; groupIndex < groupCount && !g_stopRequested; ++groupIndex) {
+        auto& ioContext = *ioContexts[groupIndex % ioContexts.size()];
+        auto group = std::make_shared<RoomGroup>();
+        group->index = groupIndex;
+
+        std::vector<std::shared_ptr<BotClient>> members;
+        for (int seat = 0; seat < config.roomSize && created < config.connections; ++seat, ++created) {
+            auto bot = std::make_shared<BotClient>(ioContext, config, stats, group, created, seat == 0, serverEndpoint);
+            group->members.push_back(bot);
+            members.push_back(bot);
+            bots.push_back(bot);
+            botContexts.push_back(&ioContext);
+        }
+
+        for (auto& bot : members) {
+            std::this_thread::sleep_until(nextStartAt);
+            nextStartAt += rampInterval;
+            boost::asio::post(ioContext, [bot]() { bot->start(); });
+        }
+
+        auto now = std::chrono::steady_clock::now();
+        if (now - lastReportAt >= std::chrono::seconds(reportIntervalSeconds)) {
+            printInterval(stats, lastSnapshot, std::chrono::duration<double>(now - lastReportAt).count());
+            lastReportAt = now;
+        }
+    }
+
+    // ========================================
+    // 구동 및 중간 보고
+    // ========================================
+    auto deadline = startedAt + std::chrono::seconds(config.durationSeconds);
+    while (!g_stopRequested && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(200));
+
+        auto now = std::chrono::steady_clock::now();
+        if (now - lastReportAt >= std::chrono::seconds(reportIntervalSeconds)) {
+            printInterval(stats, lastSnapshot, std::chrono::duration<double>(now - lastReportAt).count());
+            lastReportAt = now;
+        }
+    }
+
+    double elapsedSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - startedAt).count();
+
+    // ========================================
+    // 종료: 각 봇은 자기 io_context에서 정리
+    // ========================================
+    for (size_t i = 0; i < bots.size(); ++i) {
+        auto bot = bots[i];
+        boost::asio::post(*botContexts[i], [bot]() { bot->stop(); });
+    }
+    for (auto& guard : workGuards) {
+        guard.reset();
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    printFinalReport(stats, elapsedSeconds);
+    return stats.connectFailures.load() > 0 && stats.connected.load() == 0 ? 1 : 0;
+}
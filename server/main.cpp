@@ -3,10 +3,11 @@
 #include "GameServer.h"
 #include "ConfigManager.h"
 #include "DatabaseManager.h"
+#include "Logging.h"
 #include <spdlog/spdlog.h>
 #include <iostream>
-#include <csignal>
 #include <memory>
+#include <algorithm>
 
 #ifdef _WIN32
 #include <windows.h>
@@ -14,19 +15,10 @@
 #include <fcntl.h>
 #endif
 
-// 전역 서버 인스턴스 (시그널 핸들러에서 사용)
+// 전역 서버 인스턴스
+// (SIGINT/SIGTERM은 GameServer가 signal_set으로 받아 run()에서 종료/드레인 처리)
 std::unique_ptr<Blokus::Server::GameServer> g_server;
 
-// 시그널 핸들러 (Ctrl+C 처리)
-void signalHandler(int signal) {
-    if (signal == SIGINT || signal == SIGTERM) {
-        spdlog::info("서버 종료 수행");
-        if (g_server) {
-            g_server->stop();
-        }
-    }
-}
-
 int main() {
     try {
         // ========================================
@@ -52,25 +44,18 @@ int main() {
         // ========================================
         Blokus::Server::ConfigManager::initialize();
         
-        // LOG_LEVEL 환경변수에 따른 로그 레벨 설정
+        // LOG_LEVEL / LOG_ASYNC / LOG_QUEUE_SIZE 환경변수에 따른 로거 구성
         std::string logLevel = Blokus::Server::ConfigManager::logLevel;
-        if (logLevel == "debug") {
-            spdlog::set_level(spdlog::level::debug);
-        } else if (logLevel == "info") {
-            spdlog::set_level(spdlog::level::info);
-        } else if (logLevel == "warn") {
-            spdlog::set_level(spdlog::level::warn);
-        } else if (logLevel == "error") {
-            spdlog::set_level(spdlog::level::err);
-        } else {
-            spdlog::set_level(spdlog::level::info);  // 기본값
-        }
+        Blokus::Server::Logging::initialize(logLevel,
+            Blokus::Server::ConfigManager::logAsync,
+            static_cast<size_t>(std::max(64, Blokus::Server::ConfigManager::logQueueSize)));
 
         spdlog::info("블로블로 서버 v{}", Blokus::Server::ConfigManager::serverVersion);
         spdlog::info("========================================");
         spdlog::info("현재 로그 레벨: {}", logLevel);
         if (!Blokus::Server::ConfigManager::validate()) {
             spdlog::error("환경 초기화 실패");
+            Blokus::Server::Logging::shutdown();
             return 1;
         }
 
@@ -88,11 +73,7 @@ int main() {
 
         g_server = std::make_unique<Blokus::Server::GameServer>();
 
-        // 시그널 핸들러 등록 (Ctrl+C 처리)
-        std::signal(SIGINT, signalHandler);
-        std::signal(SIGTERM, signalHandler);
-
-        // run()이 모든 초기화를 수행하고 실행함
+        // run()이 모든 초기화를 수행하고 종료 시그널을 받을 때까지 실행함
         g_server->run();
 
         // ========================================
@@ -103,6 +84,7 @@ int main() {
 
         spdlog::info("서버 종료 성공");
         spdlog::info("========================================");
+        Blokus::Server::Logging::shutdown();
 
     }
     catch (const std::exception& e) {
@@ -116,6 +98,7 @@ int main() {
             g_server.reset();
         }
 
+        Blokus::Server::Logging::shutdown();
         return 1;
     }
 
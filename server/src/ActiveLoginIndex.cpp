@@ -0,0 +1,161 @@
+#include "ActiveLoginIndex.h"
+#include <algorithm>
+#include <functional>
+
+namespace Blokus {
+    namespace Server {
+
+        // ========================================
+        // 생성자
+        // ========================================
+
+        ActiveLoginIndex::ActiveLoginIndex(size_t shardCount) {
+            shardCount = std::max<size_t>(1, shardCount);
+            m_userShards.reserve(shardCount);
+            m_ipShards.reserve(shardCount);
+            for (size_t i = 0; i < shardCount; ++i) {
+                m_userShards.push_back(std::make_unique<UserShard>());
+                m_ipShards.push_back(std::make_unique<IpShard>());
+            }
+        }
+
+        // ========================================
+        // 등록/해제
+        // ========================================
+
+        ActiveLoginIndex::ClaimResult ActiveLoginIndex::claim(const std::string& userId, const std::string& ip, size_t maxUsersPerIp) {
+            // IP 자리를 먼저 예약하고, 사용자 등록에 실패하면 되돌림
+            // (예약 중에는 같은 IP의 다른 로그인이 상한으로 거절될 수 있음 - 보수적 방향)
+            if (!reserveIp(ip, maxUsersPerIp)) {
+                // 이미 로그인된 사용자라면 그쪽 사유를 우선 (클라이언트 안내 문구가 더 정확함)
+                ClaimResult existing = peek(userId, ip, 0);
+                return existing != ClaimResult::Claimed ? existing : ClaimResult::IpLimitReached;
+            }
+
+            ClaimResult result;
+            {
+                UserShard& shard = userShardFor(userId);
+                std::lock_guard<std::mutex> lock(shard.mutex);
+                auto [it, inserted] = shard.users.try_emplace(userId, ip);
+                if (inserted) {
+                    ++m_size;
+                    return ClaimResult::Claimed;
+                }
+                result = it->second == ip ? ClaimResult::SameUserSameIp : ClaimResult::SameUserDiffIp;
+            }
+
+            releaseIp(ip);
+            return result;
+        }
+
+        bool ActiveLoginIndex::release(const std::string& userId, const std::string& ip) {
+            UserShard& shard = userShardFor(userId);
+            {
+                std::lock_guard<std::mutex> lock(shard.mutex);
+                auto it = shard.users.find(userId);
+                if (it == shard.users.end() || it->second != ip) {
+                    return false;
+                }
+                shard.users.erase(it);
+                --m_size;
+            }
+
+            releaseIp(ip);
+            return true;
+        }
+
+        bool ActiveLoginIndex::reserveIp(const std::string& ip, size_t maxUsersPerIp) {
+            IpShard& shard = ipShardFor(ip);
+            std::lock_guard<std::mutex> lock(shard.mutex);
+
+            size_t& count = shard.counts[ip];
+            if (maxUsersPerIp > 0 && count >= maxUsersPerIp) {
+                if (count == 0) {
+                    shard.counts.erase(ip);
+                }
+                return false;
+            }
+            ++count;
+            return true;
+        }
+
+        void ActiveLoginIndex::releaseIp(const std::string& ip) {
+            IpShard& shard = ipShardFor(ip);
+            std::lock_guard<std::mutex> lock(shard.mutex);
+
+            auto it = shard.counts.find(ip);
+            if (it != shard.counts.end() && --it->second == 0) {
+                shard.counts.erase(it);
+            }
+        }
+
+        // ========================================
+        // 조회
+        // ========================================
+
+        ActiveLoginIndex::ClaimResult ActiveLoginIndex::peek(const std::string& userId, const std::string& ip, size_t maxUsersPerIp) const {
+            {
+                UserShard& shard = userShardFor(userId);
+                std::lock_guard<std::mutex> lock(shard.mutex);
+                auto it = shard.users.find(userId);
+                if (it != shard.users.end()) {
+                    return it->second == ip ? ClaimResult::SameUserSameIp : ClaimResult::SameUserDiffIp;
+                }
+            }
+
+            if (maxUsersPerIp > 0 && getUserCountForIp(ip) >= maxUsersPerIp) {
+                return ClaimResult::IpLimitReached;
+            }
+            return ClaimResult::Claimed;
+        }
+
+        bool ActiveLoginIndex::containsUser(const std::string& userId) const {
+            UserShard& shard = userShardFor(userId);
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            return shard.users.count(userId) > 0;
+        }
+
+        size_t ActiveLoginIndex::getUserCountForIp(const std::string& ip) const {
+            IpShard& shard = ipShardFor(ip);
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            auto it = shard.counts.find(ip);
+            return it != shard.counts.end() ? it->second : 0;
+        }
+
+        std::vector<std::string> ActiveLoginIndex::getUserIds() const {
+            std::vector<std::string> userIds;
+            userIds.reserve(m_size.load());
+            for (const auto& shard : m_userShards) {
+                std::lock_guard<std::mutex> lock(shard->mutex);
+                for (const auto& [userId, ip] : shard->users) {
+                    userIds.push_back(userId);
+                }
+            }
+            return userIds;
+        }
+
+        std::vector<std::string> ActiveLoginIndex::getIps() const {
+            std::vector<std::string> ips;
+            for (const auto& shard : m_ipShards) {
+                std::lock_guard<std::mutex> lock(shard->mutex);
+                for (const auto& [ip, count] : shard->counts) {
+                    ips.push_back(ip);
+                }
+            }
+            return ips;
+        }
+
+        // ========================================
+        // 내부 유틸리티
+        // ========================================
+
+        ActiveLoginIndex::UserShard& ActiveLoginIndex::userShardFor(const std::string& userId) const {
+            return *m_userShards[std::hash<std::string>{}(userId) % m_userShards.size()];
+        }
+
+        ActiveLoginIndex::IpShard& ActiveLoginIndex::ipShardFor(const std::string& ip) const {
+            return *m_ipShards[std::hash<std::string>{}(ip) % m_ipShards.size()];
+        }
+
+    } // namespace Server
+} // namespace Blokus
@@ -0,0 +1,64 @@
+#include "AdmissionController.h"
+#include "ServerMetrics.h"
+#include <algorithm>
+
+namespace Blokus {
+    namespace Server {
+
+        AdmissionController::AdmissionController(const Options& options)
+            : m_options(options)
+            , m_ratePerSecond(std::max(1, options.ipConnectPerMinute) / 60.0)
+            , m_burst(static_cast<double>(std::max(1, options.ipConnectBurst)))
+        {
+        }
+
+        AdmissionController::Decision AdmissionController::admit(const std::string& ip) {
+            auto& metrics = ServerMetrics::instance();
+
+            // 1. IP별 연결 속도
+            if (m_options.limitIpRate) {
+                auto now = TokenBucket::Clock::now();
+                std::lock_guard<std::mutex> lock(m_mutex);
+                auto it = m_ipBuckets.try_emplace(ip, m_burst, now).first;
+                if (!it->second.tryConsume(m_ratePerSecond, m_burst, now)) {
+                    metrics.connectionsRejectedIpRate.add();
+                    return Decision::IpRateLimited;
+                }
+            }
+
+            // 2. 미인증 세션 상한 (증가 후 넘치면 되돌림)
+            size_t current = m_unauthenticated.fetch_add(1, std::memory_order_relaxed);
+            if (current >= m_options.maxUnauthenticated) {
+                m_unauthenticated.fetch_sub(1, std::memory_order_relaxed);
+                metrics.connectionsRejectedUnauthenticated.add();
+                return Decision::TooManyUnauthenticated;
+            }
+
+            metrics.unauthenticatedSessions.set(static_cast<int64_t>(current + 1));
+            return Decision::Admitted;
+        }
+
+        void AdmissionController::releaseUnauthenticated() {
+            size_t remaining = m_unauthenticated.fetch_sub(1, std::memory_order_relaxed) - 1;
+            ServerMetrics::instance().unauthenticatedSessions.set(static_cast<int64_t>(remaining));
+        }
+
+        size_t AdmissionController::pruneIdleBuckets() {
+            auto now = TokenBucket::Clock::now();
+
+            std::lock_guard<std::mutex> lock(m_mutex);
+            size_t removed = 0;
+            for (auto it = m_ipBuckets.begin(); it != m_ipBuckets.end();) {
+                if (it->second.isRefilled(m_ratePerSecond, m_burst, now)) {
+                    it = m_ipBuckets.erase(it);
+                    ++removed;
+                }
+                else {
+                    ++it;
+                }
+            }
+            return removed;
+        }
+
+    } // namespace Server
+} // namespace Blokus
@@ -0,0 +1,191 @@
+#include "AuthSessionStore.h"
+#include <algorithm>
+#include <functional>
+
+namespace Blokus {
+    namespace Server {
+
+        // ========================================
+        // 생성자
+        // ========================================
+
+        AuthSessionStore::AuthSessionStore(size_t shardCount) {
+            shardCount = std::max<size_t>(1, shardCount);
+            m_shards.reserve(shardCount);
+            for (size_t i = 0; i < shardCount; ++i) {
+                m_shards.push_back(std::make_unique<Shard>());
+            }
+        }
+
+        // ========================================
+        // 등록/조회
+        // ========================================
+
+        void AuthSessionStore::insert(const std::string& token, const SessionInfo& info) {
+            Shard& shard = shardFor(token);
+            std::lock_guard<std::mutex> lock(shard.mutex);
+
+            auto [it, inserted] = shard.sessions.try_emplace(token);
+            if (inserted) {
+                ++m_size;
+            }
+            it->second.info = info;
+            scheduleLocked(shard, token, it->second);
+        }
+
+        std::optional<SessionInfo> AuthSessionStore::find(const std::string& token) {
+            Shard& shard = shardFor(token);
+            std::lock_guard<std::mutex> lock(shard.mutex);
+
+            auto it = shard.sessions.find(token);
+            if (it == shard.sessions.end()) {
+                return std::nullopt;
+            }
+
+            if (std::chrono::system_clock::now() > it->second.info.expiresAt) {
+                // 힙 항목은 정리 시 세대 불일치로 버려짐
+                shard.sessions.erase(it);
+                --m_size;
+                return std::nullopt;
+            }
+
+            return it->second.info;
+        }
+
+        bool AuthSessionStore::refresh(const std::string& token, std::chrono::system_clock::time_point expiresAt) {
+            Shard& shard = shardFor(token);
+            std::lock_guard<std::mutex> lock(shard.mutex);
+
+            auto it = shard.sessions.find(token);
+            if (it == shard.sessions.end()) {
+                return false;
+            }
+
+            it->second.info.expiresAt = expiresAt;
+            scheduleLocked(shard, token, it->second);
+            return true;
+        }
+
+        bool AuthSessionStore::erase(const std::string& token) {
+            Shard& shard = shardFor(token);
+            std::lock_guard<std::mutex> lock(shard.mutex);
+
+            if (shard.sessions.erase(token) == 0) {
+                return false;
+            }
+            --m_size;
+            return true;
+        }
+
+        // ========================================
+        // 전체 순회 작업
+        // ========================================
+
+        size_t AuthSessionStore::eraseByUserId(const std::string& userId) {
+            size_t count = 0;
+            for (auto& shard : m_shards) {
+                std::lock_guard<std::mutex> lock(shard->mutex);
+                for (auto it = shard->sessions.begin(); it != shard->sessions.end();) {
+                    if (it->second.info.userId == userId) {
+                        it = shard->sessions.erase(it);
+                        ++count;
+                    }
+                    else {
+                        ++it;
+                    }
+                }
+            }
+            m_size -= count;
+            return count;
+        }
+
+        bool AuthSessionStore::containsUsername(const std::string& username) const {
+            for (const auto& shard : m_shards) {
+                std::lock_guard<std::mutex> lock(shard->mutex);
+                for (const auto& [token, entry] : shard->sessions) {
+                    if (entry.info.username == username) {
+                        return true;
+                    }
+                }
+            }
+            return false;
+        }
+
+        void AuthSessionStore::clear() {
+            for (auto& shard : m_shards) {
+                std::lock_guard<std::mutex> lock(shard->mutex);
+                m_size -= shard->sessions.size();
+                shard->sessions.clear();
+                shard->expiryHeap = {};
+            }
+        }
+
+        // ========================================
+        // 만료 정리
+        // ========================================
+
+        size_t AuthSessionStore::purgeExpired(std::chrono::system_clock::time_point now, size_t maxBatch) {
+            maxBatch = std::max<size_t>(1, maxBatch);
+            size_t removed = 0;
+
+            for (auto& shard : m_shards) {
+                bool more = true;
+                while (more) {
+                    // 한 번에 maxBatch개까지만 처리하고 락을 놓아 조회가 오래 막히지 않도록 함
+                    std::lock_guard<std::mutex> lock(shard->mutex);
+                    size_t processed = 0;
+
+                    while (!shard->expiryHeap.empty() && shard->expiryHeap.top().expiresAt < now) {
+                        if (processed++ >= maxBatch) {
+                            break;
+                        }
+
+                        const ExpiryItem& top = shard->expiryHeap.top();
+                        auto it = shard->sessions.find(top.token);
+                        if (it != shard->sessions.end() && it->second.generation == top.generation) {
+                            shard->sessions.erase(it);
+                            --m_size;
+                            ++removed;
+                        }
+                        shard->expiryHeap.pop();
+                    }
+
+                    more = processed > maxBatch;
+                    if (!more) {
+                        compactLocked(*shard);
+                    }
+                }
+            }
+
+            return removed;
+        }
+
+        // ========================================
+        // 내부 헬퍼
+        // ========================================
+
+        AuthSessionStore::Shard& AuthSessionStore::shardFor(const std::string& token) {
+            return *m_shards[std::hash<std::string>{}(token) % m_shards.size()];
+        }
+
+        void AuthSessionStore::scheduleLocked(Shard& shard, const std::string& token, Entry& entry) {
+            entry.generation = ++shard.nextGeneration;
+            shard.expiryHeap.push({ entry.info.expiresAt, token, entry.generation });
+        }
+
+        void AuthSessionStore::compactLocked(Shard& shard) {
+            // 갱신/삭제로 무효화된 힙 항목이 너무 많이 쌓이면 현재 세션 기준으로 다시 구성
+            if (shard.expiryHeap.size() <= shard.sessions.size() * 2 + 64) {
+                return;
+            }
+
+            std::vector<ExpiryItem> items;
+            items.reserve(shard.sessions.size());
+            for (const auto& [token, entry] : shard.sessions) {
+                items.push_back({ entry.info.expiresAt, token, entry.generation });
+            }
+            shard.expiryHeap = decltype(shard.expiryHeap)(std::greater<ExpiryItem>(), std::move(items));
+        }
+
+    } // namespace Server
+} // namespace Blokus
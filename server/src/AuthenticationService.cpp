@@ -8,6 +8,7 @@
 #include <regex>
 #include <iomanip>
 #include <sstream>
+#include <algorithm>
 
 namespace Blokus
 {
@@ -87,6 +88,8 @@ namespace Blokus
                 }
 
                 m_jwtVerifier = std::make_unique<JwtVerifier>(jwksUrl, issuer, audiences);
+                m_jwtVerifier->setRefreshInterval(std::chrono::seconds(std::max(10, ConfigManager::jwksRefreshIntervalSec)));
+                m_jwtVerifier->setTokenCacheCapacity(static_cast<size_t>(std::max(0, ConfigManager::jwtCacheMaxEntries)));
                 if (!m_jwtVerifier->initialize())
                 {
                     spdlog::error("JWT 검증기 초기화 실패");
@@ -121,10 +124,7 @@ namespace Blokus
             }
 
             // 활성 세션 정리
-            {
-                std::lock_guard<std::mutex> lock(m_sessionsMutex);
-                m_activeSessions.clear();
-            }
+            m_sessionStore.clear();
 
             m_isInitialized.store(false);
             spdlog::info("AuthenticationService 종료 완료");
@@ -432,21 +432,8 @@ namespace Blokus
                     return std::nullopt;
                 }
 
-                auto sessionInfo = getSessionInfo(sessionToken);
-                if (!sessionInfo)
-                {
-                    return std::nullopt;
-                }
-
-                // 만료 확인
-                auto now = std::chrono::system_clock::now();
-                if (now > sessionInfo->expiresAt)
-                {
-                    removeSession(sessionToken);
-                    return std::nullopt;
-                }
-
-                return sessionInfo;
+                // 만료된 세션은 저장소에서 즉시 제거되고 nullopt 반환
+                return getSessionInfo(sessionToken);
             }
             catch (const std::exception &e)
             {
@@ -459,17 +446,12 @@ namespace Blokus
         {
             try
             {
-                std::lock_guard<std::mutex> lock(m_sessionsMutex);
-
-                auto it = m_activeSessions.find(sessionToken);
-                if (it == m_activeSessions.end())
+                // 세션 만료 시간 연장
+                if (!m_sessionStore.refresh(sessionToken, getSessionExpireTime()))
                 {
                     return false;
                 }
 
-                // 세션 만료 시간 연장
-                it->second.expiresAt = getSessionExpireTime();
-
                 spdlog::debug("세션 갱신: {}", sessionToken.substr(0, 8) + "...");
                 return true;
             }
@@ -484,23 +466,7 @@ namespace Blokus
         {
             try
             {
-                std::lock_guard<std::mutex> lock(m_sessionsMutex);
-
-                auto it = m_activeSessions.begin();
-                int count = 0;
-
-                while (it != m_activeSessions.end())
-                {
-                    if (it->second.userId == userId)
-                    {
-                        it = m_activeSessions.erase(it);
-                        count++;
-                    }
-                    else
-                    {
-                        ++it;
-                    }
-                }
+                size_t count = m_sessionStore.eraseByUserId(userId);
 
                 spdlog::info("사용자 {} 모든 세션 무효화: {}개", userId, count);
                 return true;
@@ -516,24 +482,8 @@ namespace Blokus
         {
             try
             {
-                std::lock_guard<std::mutex> lock(m_sessionsMutex);
-
-                auto now = std::chrono::system_clock::now();
-                auto it = m_activeSessions.begin();
-                int count = 0;
-
-                while (it != m_activeSessions.end())
-                {
-                    if (now > it->second.expiresAt)
-                    {
-                        it = m_activeSessions.erase(it);
-                        count++;
-                    }
-                    else
-                    {
-                        ++it;
-                    }
-                }
+                // 만료 힙에서 만료된 항목만 꺼내므로 비용은 만료된 세션 수에 비례
+                size_t count = m_sessionStore.purgeExpired(std::chrono::system_clock::now());
 
                 if (count > 0)
                 {
@@ -561,16 +511,7 @@ namespace Blokus
                 // TODO: 데이터베이스에서 중복 확인
 
                 // 임시: 메모리 세션에서 확인
-                std::lock_guard<std::mutex> lock(m_sessionsMutex);
-                for (const auto &[token, session] : m_activeSessions)
-                {
-                    if (session.username == username)
-                    {
-                        return false;
-                    }
-                }
-
-                return true;
+                return !m_sessionStore.containsUsername(username);
             }
             catch (const std::exception &e)
             {
@@ -614,8 +555,7 @@ namespace Blokus
 
         size_t AuthenticationService::getActiveSessionCount() const
         {
-            std::lock_guard<std::mutex> lock(m_sessionsMutex);
-            return m_activeSessions.size();
+            return m_sessionStore.size();
         }
 
         // ========================================
@@ -799,15 +739,13 @@ namespace Blokus
         {
             try
             {
-                std::lock_guard<std::mutex> lock(m_sessionsMutex);
-
                 SessionInfo sessionInfo;
-                sessionInfo.userId = std::stoi(userId);
+                sessionInfo.userId = userId;
                 sessionInfo.username = username;
                 sessionInfo.expiresAt = getSessionExpireTime();
                 sessionInfo.isValid = true;
 
-                m_activeSessions[token] = sessionInfo;
+                m_sessionStore.insert(token, sessionInfo);
 
                 spdlog::debug("세션 저장: {} -> {} ({})", token.substr(0, 8) + "...", username, userId);
                 return true;
@@ -823,13 +761,9 @@ namespace Blokus
         {
             try
             {
-                std::lock_guard<std::mutex> lock(m_sessionsMutex);
-
-                auto it = m_activeSessions.find(token);
-                if (it != m_activeSessions.end())
+                if (m_sessionStore.erase(token))
                 {
-                    spdlog::debug("세션 제거: {} ({})", token.substr(0, 8) + "...", it->second.username);
-                    m_activeSessions.erase(it);
+                    spdlog::debug("세션 제거: {}", token.substr(0, 8) + "...");
                     return true;
                 }
                 return false;
@@ -841,18 +775,11 @@ namespace Blokus
             }
         }
 
-        std::optional<SessionInfo> AuthenticationService::getSessionInfo(const std::string &token) const
+        std::optional<SessionInfo> AuthenticationService::getSessionInfo(const std::string &token)
         {
             try
             {
-                std::lock_guard<std::mutex> lock(m_sessionsMutex);
-
-                auto it = m_activeSessions.find(token);
-                if (it != m_activeSessions.end())
-                {
-                    return it->second;
-                }
-                return std::nullopt;
+                return m_sessionStore.find(token);
             }
             catch (const std::exception &e)
             {
@@ -0,0 +1,124 @@
+#include "BoardSync.h"
+#include <array>
+#include <charconv>
+
+namespace Blokus {
+    namespace Server {
+
+        namespace {
+            constexpr int CELL_COUNT = Common::BOARD_SIZE * Common::BOARD_SIZE;
+            constexpr size_t OCCUPANCY_BYTES = (CELL_COUNT + 7) / 8;
+            constexpr size_t MAX_PACKED_BYTES = OCCUPANCY_BYTES + (CELL_COUNT + 3) / 4;
+
+            // 한 게임의 최대 배치 수 (플레이어 4명 x 블록 21개) + 여유
+            constexpr size_t EXPECTED_PLACEMENTS = 128;
+
+            // splitmix64 (클라이언트도 같은 함수로 칸 키를 만들 수 있도록 표준 상수 사용)
+            uint64_t mix64(uint64_t value) {
+                value += 0x9E3779B97F4A7C15ULL;
+                value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ULL;
+                value = (value ^ (value >> 27)) * 0x94D049BB133111EBULL;
+                return value ^ (value >> 31);
+            }
+
+            void writeBase64(MessageWriter& writer, const uint8_t* data, size_t size) {
+                static const char kAlphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+                size_t i = 0;
+                for (; i + 2 < size; i += 3) {
+                    uint32_t chunk = (data[i] << 16) | (data[i + 1] << 8) | data[i + 2];
+                    writer.raw(kAlphabet[(chunk >> 18) & 0x3F]).raw(kAlphabet[(chunk >> 12) & 0x3F])
+                        .raw(kAlphabet[(chunk >> 6) & 0x3F]).raw(kAlphabet[chunk & 0x3F]);
+                }
+                if (i < size) {
+                    uint32_t chunk = data[i] << 16;
+                    if (i + 1 < size) {
+                        chunk |= data[i + 1] << 8;
+                    }
+                    writer.raw(kAlphabet[(chunk >> 18) & 0x3F]).raw(kAlphabet[(chunk >> 12) & 0x3F]);
+                    writer.raw(i + 1 < size ? kAlphabet[(chunk >> 6) & 0x3F] : '=').raw('=');
+                }
+            }
+        }
+
+        BoardSync::BoardSync() {
+            m_hashes.reserve(EXPECTED_PLACEMENTS);
+            reset();
+        }
+
+        void BoardSync::reset() {
+            m_hashes.clear();
+            m_hashes.push_back(0);  // 빈 보드
+        }
+
+        uint64_t BoardSync::applyPlacement(const Common::PositionList& cells, Common::PlayerColor color) {
+            uint64_t hash = m_hashes.back();
+            for (const auto& cell : cells) {
+                hash ^= cellKey(cell.first, cell.second, color);
+            }
+            m_hashes.push_back(hash);
+            return getSeq();
+        }
+
+        bool BoardSync::matches(uint64_t seq, uint64_t hash) const {
+            return seq < m_hashes.size() && m_hashes[seq] == hash;
+        }
+
+        uint64_t BoardSync::cellKey(int row, int col, Common::PlayerColor color) {
+            // 칸 번호(행 우선) * 4 + (색상 - 1)
+            uint64_t index = static_cast<uint64_t>(row * Common::BOARD_SIZE + col) * 4 +
+                (static_cast<uint64_t>(color) - 1);
+            return mix64(index);
+        }
+
+        uint64_t BoardSync::computeHash(const Common::GameLogic& logic) {
+            uint64_t hash = 0;
+            for (int row = 0; row < Common::BOARD_SIZE; ++row) {
+                for (int col = 0; col < Common::BOARD_SIZE; ++col) {
+                    Common::PlayerColor color = logic.getBoardCell(row, col);
+                    if (color != Common::PlayerColor::None) {
+                        hash ^= cellKey(row, col, color);
+                    }
+                }
+            }
+            return hash;
+        }
+
+        void BoardSync::writeHash(MessageWriter& writer, uint64_t hash) {
+            static const char kHex[] = "0123456789abcdef";
+            char digits[16];
+            for (int i = 15; i >= 0; --i) {
+                digits[i] = kHex[hash & 0x0F];
+                hash >>= 4;
+            }
+            writer.raw(std::string_view(digits, sizeof(digits)));
+        }
+
+        bool BoardSync::parseHash(std::string_view text, uint64_t& hash) {
+            if (text.empty() || text.size() > 16) {
+                return false;
+            }
+            auto result = std::from_chars(text.data(), text.data() + text.size(), hash, 16);
+            return result.ec == std::errc() && result.ptr == text.data() + text.size();
+        }
+
+        void BoardSync::writePackedBoard(MessageWriter& writer, const Common::GameLogic& logic) {
+            // [0, 50): 점유 비트맵 (칸 번호 i -> 바이트 i/8의 i%8번째 비트)
+            // [50, ...): 점유된 칸 순서대로 (색상 - 1)을 2비트씩, 바이트 하위 비트부터
+            std::array<uint8_t, MAX_PACKED_BYTES> packed{};
+            size_t occupied = 0;
+            for (int index = 0; index < CELL_COUNT; ++index) {
+                Common::PlayerColor color = logic.getBoardCell(index / Common::BOARD_SIZE, index % Common::BOARD_SIZE);
+                if (color == Common::PlayerColor::None) {
+                    continue;
+                }
+                packed[index / 8] |= static_cast<uint8_t>(1u << (index % 8));
+                uint8_t colorBits = static_cast<uint8_t>((static_cast<int>(color) - 1) & 0x03);
+                packed[OCCUPANCY_BYTES + occupied / 4] |= static_cast<uint8_t>(colorBits << ((occupied % 4) * 2));
+                ++occupied;
+            }
+
+            writeBase64(writer, packed.data(), OCCUPANCY_BYTES + (occupied + 3) / 4);
+        }
+
+    } // namespace Server
+} // namespace Blokus
@@ -0,0 +1,178 @@
+#include "ChatService.h"
+#include "Session.h"
+#include "ServerMetrics.h"
+#include <spdlog/spdlog.h>
+#include <algorithm>
+
+namespace Blokus {
+    namespace Server {
+
+        // ========================================
+        // 생성자/소멸자
+        // ========================================
+
+        ChatService::ChatService(boost::asio::io_context& ioContext, const Options& options, LobbyMembersProvider provider)
+            : m_options(options)
+            , m_lobbyMembersProvider(std::move(provider))
+            , m_flushTimer(ioContext)
+        {
+            m_pending.reserve(32);
+        }
+
+        ChatService::~ChatService() {
+            stop();
+        }
+
+        void ChatService::stop() {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stopped = true;
+            m_pending.clear();
+
+            boost::system::error_code ignored;
+            m_flushTimer.cancel(ignored);
+        }
+
+        // ========================================
+        // 전송 한도 (토큰 버킷)
+        // ========================================
+
+        bool ChatService::tryConsume(const std::string& userId) {
+            auto now = TokenBucket::Clock::now();
+            double burst = static_cast<double>(std::max(1, m_options.burst));
+
+            std::lock_guard<std::mutex> lock(m_bucketsMutex);
+            auto it = m_buckets.try_emplace(userId, burst, now).first;
+            if (!it->second.tryConsume(std::max(1, m_options.ratePerSecond), burst, now)) {
+                ServerMetrics::instance().chatRateLimited.add();
+                return false;
+            }
+            return true;
+        }
+
+        size_t ChatService::pruneIdleBuckets() {
+            // 버킷이 다시 가득 찬 사용자는 새 버킷과 같으므로 제거
+            double rate = std::max(1, m_options.ratePerSecond);
+            double burst = std::max(1, m_options.burst);
+            auto now = TokenBucket::Clock::now();
+
+            std::lock_guard<std::mutex> lock(m_bucketsMutex);
+            size_t removed = 0;
+            for (auto it = m_buckets.begin(); it != m_buckets.end();) {
+                if (it->second.isRefilled(rate, burst, now)) {
+                    it = m_buckets.erase(it);
+                    ++removed;
+                }
+                else {
+                    ++it;
+                }
+            }
+            return removed;
+        }
+
+        // ========================================
+        // 로비 채팅 배치
+        // ========================================
+
+        void ChatService::publishLobby(std::string chatLine) {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (m_stopped) {
+                return;
+            }
+
+            if (m_options.historySize > 0) {
+                m_history.push_back(chatLine);
+                if (m_history.size() > m_options.historySize) {
+                    m_history.pop_front();
+                }
+            }
+
+            m_pending.push_back(std::move(chatLine));
+            ServerMetrics::instance().chatMessages.add();
+            scheduleFlushLocked();
+        }
+
+        void ChatService::scheduleFlushLocked() {
+            // 구간의 첫 메시지만 타이머를 예약, 이후 메시지는 같은 배치에 합쳐짐
+            if (m_flushScheduled) {
+                return;
+            }
+            m_flushScheduled = true;
+
+            m_flushTimer.expires_after(m_options.batchWindow);
+            m_flushTimer.async_wait([this](const boost::system::error_code& error) {
+                if (!error) {
+                    flush();
+                }
+            });
+        }
+
+        void ChatService::flush() {
+            std::vector<std::string> batch;
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_flushScheduled = false;
+                if (m_stopped || m_pending.empty()) {
+                    return;
+                }
+                batch.swap(m_pending);
+                m_pending.reserve(batch.capacity());
+            }
+
+            // 배치 전체를 줄바꿈으로 이어 수신자 모두가 공유하는 버퍼 1개로 (마지막 줄바꿈은 makeFrame이 추가)
+            size_t totalSize = 0;
+            for (const auto& line : batch) {
+                totalSize += line.size() + 1;
+            }
+            std::string joined;
+            joined.reserve(totalSize);
+            for (size_t i = 0; i < batch.size(); ++i) {
+                if (i > 0) {
+                    joined.push_back('\n');
+                }
+                joined.append(batch[i]);
+            }
+            SharedFrame frame = makeFrame(joined);
+
+            size_t sentCount = 0;
+            for (const auto& session : m_lobbyMembersProvider()) {
+                if (session && session->isActive() && session->isInLobby()) {
+                    session->sendFrame(frame);
+                    ++sentCount;
+                }
+            }
+
+            auto& metrics = ServerMetrics::instance();
+            metrics.chatBatches.add();
+            metrics.chatFramesSent.add(sentCount);
+            SPDLOG_DEBUG("📢 로비 채팅 배치 전송: 메시지 {}개 -> {}명", batch.size(), sentCount);
+        }
+
+        // ========================================
+        // 최근 기록
+        // ========================================
+
+        void ChatService::sendHistory(const SessionPtr& session) const {
+            if (!session) {
+                return;
+            }
+
+            std::string joined;
+            size_t count = 0;
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                count = m_history.size();
+                if (count == 0) {
+                    return;
+                }
+                joined = "CHAT_HISTORY:" + std::to_string(count);
+                for (const auto& line : m_history) {
+                    joined.push_back('\n');
+                    joined.append(line);
+                }
+            }
+
+            session->sendFrame(makeFrame(joined));
+        }
+
+    } // namespace Server
+} // namespace Blokus
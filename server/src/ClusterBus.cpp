@@ -0,0 +1,518 @@
+#include "ClusterBus.h"
+#include <spdlog/spdlog.h>
+#include <algorithm>
+
+namespace Blokus {
+    namespace Server {
+
+        namespace {
+            constexpr auto RECONNECT_DELAY = std::chrono::seconds(2);
+            constexpr size_t MAX_PENDING_PUBLISHES = 4096;     // 연결 전/느린 연결에서 보관할 최대 줄 수
+            constexpr size_t MAX_LINE_LENGTH = 4 * 1024 * 1024;  // node.state 스냅샷 포함
+
+            void appendEscaped(std::string& out, const std::string& field) {
+                for (char c : field) {
+                    switch (c) {
+                    case '\\': out += "\\\\"; break;
+                    case '\t': out += "\\t"; break;
+                    case '\n': out += "\\n"; break;
+                    default: out.push_back(c); break;
+                    }
+                }
+            }
+
+            bool unescapeField(const std::string& line, size_t begin, size_t end, std::string& out) {
+                out.clear();
+                out.reserve(end - begin);
+                for (size_t i = begin; i < end; ++i) {
+                    char c = line[i];
+                    if (c != '\\') {
+                        out.push_back(c);
+                        continue;
+                    }
+                    if (++i >= end) {
+                        return false;
+                    }
+                    switch (line[i]) {
+                    case '\\': out.push_back('\\'); break;
+                    case 't': out.push_back('\t'); break;
+                    case 'n': out.push_back('\n'); break;
+                    default: return false;
+                    }
+                }
+                return true;
+            }
+        }
+
+        // ========================================
+        // ClusterMessage
+        // ========================================
+
+        std::string ClusterMessage::encode() const {
+            std::string line;
+            line.reserve(source.size() + topic.size() + payload.size() + 8);
+            appendEscaped(line, source);
+            line.push_back('\t');
+            appendEscaped(line, topic);
+            line.push_back('\t');
+            appendEscaped(line, payload);
+            line.push_back('\n');
+            return line;
+        }
+
+        bool ClusterMessage::decode(const std::string& line, ClusterMessage& message) {
+            size_t end = line.size();
+            if (end > 0 && line[end - 1] == '\n') {
+                --end;
+            }
+
+            size_t first = line.find('\t');
+            if (first == std::string::npos || first >= end) {
+                return false;
+            }
+            size_t second = line.find('\t', first + 1);
+            if (second == std::string::npos || second >= end) {
+                return false;
+            }
+
+            return unescapeField(line, 0, first, message.source) &&
+                unescapeField(line, first + 1, second, message.topic) &&
+                unescapeField(line, second + 1, end, message.payload);
+        }
+
+        // ========================================
+        // InProcessClusterBus
+        // ========================================
+
+        struct InProcessClusterBus::Endpoint {
+            Endpoint(boost::asio::io_context& ioContext, std::string id)
+                : nodeId(std::move(id))
+                , strand(boost::asio::make_strand(ioContext))
+            {
+            }
+
+            const std::string nodeId;
+            boost::asio::strand<boost::asio::io_context::executor_type> strand;
+            MessageHandler handler;
+            std::atomic<bool> active{ true };
+        };
+
+        struct InProcessClusterBus::Hub {
+            std::mutex mutex;
+            std::vector<std::shared_ptr<Endpoint>> endpoints;
+        };
+
+        InProcessClusterBus::Hub& InProcessClusterBus::hub() {
+            static Hub instance;
+            return instance;
+        }
+
+        InProcessClusterBus::InProcessClusterBus(boost::asio::io_context& ioContext, std::string nodeId)
+            : m_nodeId(std::move(nodeId))
+            , m_endpoint(std::make_shared<Endpoint>(ioContext, m_nodeId))
+        {
+        }
+
+        InProcessClusterBus::~InProcessClusterBus() {
+            stop();
+        }
+
+        bool InProcessClusterBus::start(MessageHandler onMessage, ConnectedHandler onConnected) {
+            if (m_attached.exchange(true)) {
+                return true;
+            }
+            m_endpoint->handler = std::move(onMessage);
+            {
+                auto& instance = hub();
+                std::lock_guard<std::mutex> lock(instance.mutex);
+                instance.endpoints.push_back(m_endpoint);
+            }
+
+            if (onConnected) {
+                boost::asio::post(m_endpoint->strand, std::move(onConnected));
+            }
+            spdlog::info("클러스터 버스 연결 (프로세스 내부 브로커, 노드 {})", m_nodeId);
+            return true;
+        }
+
+        void InProcessClusterBus::stop() {
+            if (!m_attached.exchange(false)) {
+                return;
+            }
+            m_endpoint->active = false;
+
+            auto& instance = hub();
+            std::lock_guard<std::mutex> lock(instance.mutex);
+            instance.endpoints.erase(std::remove(instance.endpoints.begin(), instance.endpoints.end(), m_endpoint),
+                instance.endpoints.end());
+        }
+
+        void InProcessClusterBus::publish(const std::string& topic, const std::string& payload) {
+            if (!m_attached.load()) {
+                return;
+            }
+
+            auto message = std::make_shared<const ClusterMessage>(ClusterMessage{ m_nodeId, topic, payload });
+            auto& instance = hub();
+            std::lock_guard<std::mutex> lock(instance.mutex);
+            for (const auto& endpoint : instance.endpoints) {
+                if (endpoint == m_endpoint) {
+                    continue;
+                }
+                boost::asio::post(endpoint->strand, [endpoint, message]() {
+                    if (endpoint->active.load() && endpoint->handler) {
+                        endpoint->handler(*message);
+                    }
+                });
+            }
+        }
+
+        // ========================================
+        // TcpClusterBus
+        // ========================================
+
+        TcpClusterBus::TcpClusterBus(boost::asio::io_context& ioContext, std::string nodeId, std::string brokerHost, int brokerPort)
+            : m_nodeId(std::move(nodeId))
+            , m_brokerHost(std::move(brokerHost))
+            , m_brokerPort(brokerPort)
+            , m_strand(boost::asio::make_strand(ioContext))
+            , m_resolver(m_strand)
+            , m_socket(m_strand)
+            , m_reconnectTimer(m_strand)
+            , m_readBuffer(MAX_LINE_LENGTH)
+        {
+        }
+
+        TcpClusterBus::~TcpClusterBus() {
+            m_running = false;
+        }
+
+        bool TcpClusterBus::start(MessageHandler onMessage, ConnectedHandler onConnected) {
+            if (m_running.exchange(true)) {
+                return true;
+            }
+            m_onMessage = std::move(onMessage);
+            m_onConnected = std::move(onConnected);
+
+            boost::asio::post(m_strand, [self = shared_from_this()]() { self->connect(); });
+            return true;
+        }
+
+        void TcpClusterBus::stop() {
+            if (!m_running.exchange(false)) {
+                return;
+            }
+            boost::asio::post(m_strand, [self = shared_from_this()]() {
+                boost::system::error_code ignored;
+                self->m_reconnectTimer.cancel(ignored);
+                self->m_resolver.cancel();
+                self->m_socket.close(ignored);
+                self->m_connected = false;
+                self->m_writeQueue.clear();
+            });
+        }
+
+        void TcpClusterBus::publish(const std::string& topic, const std::string& payload) {
+            if (!m_running.load()) {
+                return;
+            }
+
+            auto line = ClusterMessage{ m_nodeId, topic, payload }.encode();
+            boost::asio::post(m_strand, [self = shared_from_this(), line = std::move(line)]() mutable {
+                // 연결 전에는 제한된 개수만 보관 (재접속 후 node.state 스냅샷으로 어차피 다시 맞춰짐)
+                // 맨 앞 줄은 전송 중일 수 있으므로 (async_write가 버퍼를 참조) 그다음으로 오래된 줄을 버림
+                if (self->m_writeQueue.size() >= MAX_PENDING_PUBLISHES) {
+                    auto oldest = self->m_writeQueue.begin();
+                    if (self->m_writing) {
+                        ++oldest;
+                    }
+                    if (oldest != self->m_writeQueue.end()) {
+                        self->m_writeQueue.erase(oldest);
+                    }
+                }
+                self->m_writeQueue.push_back(std::move(line));
+                if (self->m_connected.load()) {
+                    self->startWrite();
+                }
+            });
+        }
+
+        void TcpClusterBus::connect() {
+            if (!m_running.load()) {
+                return;
+            }
+
+            m_resolver.async_resolve(m_brokerHost, std::to_string(m_brokerPort),
+                [self = shared_from_this()](const boost::system::error_code& error,
+                    boost::asio::ip::tcp::resolver::results_type endpoints) {
+                    if (error) {
+                        spdlog::warn("클러스터 브로커 주소 확인 실패 ({}:{}): {}", self->m_brokerHost, self->m_brokerPort, error.message());
+                        self->scheduleReconnect();
+                        return;
+                    }
+
+                    boost::asio::async_connect(self->m_socket, endpoints,
+                        [self](const boost::system::error_code& connectError, const boost::asio::ip::tcp::endpoint&) {
+                            if (connectError) {
+                                spdlog::debug("클러스터 브로커 연결 실패 ({}:{}): {}", self->m_brokerHost, self->m_brokerPort, connectError.message());
+                                self->scheduleReconnect();
+                                return;
+                            }
+
+                            boost::system::error_code ignored;
+                            self->m_socket.set_option(boost::asio::ip::tcp::no_delay(true), ignored);
+                            self->m_connected = true;
+                            spdlog::info("클러스터 버스 연결: {}:{} (노드 {})", self->m_brokerHost, self->m_brokerPort, self->m_nodeId);
+
+                            self->startRead();
+                            if (!self->m_writeQueue.empty()) {
+                                self->startWrite();
+                            }
+                            if (self->m_onConnected) {
+                                self->m_onConnected();
+                            }
+                        });
+                });
+        }
+
+        void TcpClusterBus::scheduleReconnect() {
+            if (!m_running.load()) {
+                return;
+            }
+
+            m_reconnectTimer.expires_after(RECONNECT_DELAY);
+            m_reconnectTimer.async_wait([self = shared_from_this()](const boost::system::error_code& error) {
+                if (!error) {
+                    self->connect();
+                }
+            });
+        }
+
+        void TcpClusterBus::startRead() {
+            boost::asio::async_read_until(m_socket, m_readBuffer, '\n',
+                [self = shared_from_this()](const boost::system::error_code& error, size_t bytes) {
+                    if (!self->m_running.load()) {
+                        return;
+                    }
+                    if (error) {
+                        self->handleDisconnect(error);
+                        return;
+                    }
+
+                    std::string line(boost::asio::buffers_begin(self->m_readBuffer.data()),
+                        boost::asio::buffers_begin(self->m_readBuffer.data()) + bytes);
+                    self->m_readBuffer.consume(bytes);
+
+                    ClusterMessage message;
+                    if (!ClusterMessage::decode(line, message)) {
+                        spdlog::warn("클러스터 메시지 형식 오류 ({}바이트)", line.size());
+                    }
+                    else if (message.source != self->m_nodeId && self->m_onMessage) {
+                        self->m_onMessage(message);
+                    }
+
+                    self->startRead();
+                });
+        }
+
+        void TcpClusterBus::startWrite() {
+            if (m_writing || m_writeQueue.empty()) {
+                return;
+            }
+            m_writing = true;
+
+            boost::asio::async_write(m_socket, boost::asio::buffer(m_writeQueue.front()),
+                [self = shared_from_this()](const boost::system::error_code& error, size_t /*bytes*/) {
+                    self->m_writing = false;
+                    if (error) {
+                        self->handleDisconnect(error);
+                        return;
+                    }
+                    self->m_writeQueue.pop_front();
+                    self->startWrite();
+                });
+        }
+
+        void TcpClusterBus::handleDisconnect(const boost::system::error_code& error) {
+            if (!m_connected.exchange(false)) {
+                return;
+            }
+
+            if (m_running.load()) {
+                spdlog::warn("클러스터 버스 연결 끊김 ({}:{}): {} -> 재접속 대기", m_brokerHost, m_brokerPort, error.message());
+            }
+
+            boost::system::error_code ignored;
+            m_socket.close(ignored);
+            m_readBuffer.consume(m_readBuffer.size());
+            m_writing = false;
+            scheduleReconnect();
+        }
+
+        // ========================================
+        // ClusterBroker
+        // ========================================
+
+        struct ClusterBroker::Connection {
+            explicit Connection(boost::asio::ip::tcp::socket s)
+                : socket(std::move(s))
+                , readBuffer(MAX_LINE_LENGTH)
+            {
+            }
+
+            boost::asio::ip::tcp::socket socket;
+            boost::asio::streambuf readBuffer;
+            std::deque<std::shared_ptr<const std::string>> writeQueue;
+            bool writing = false;
+            bool closed = false;
+        };
+
+        ClusterBroker::ClusterBroker(boost::asio::io_context& ioContext)
+            : m_strand(boost::asio::make_strand(ioContext))
+            , m_acceptor(m_strand)
+        {
+        }
+
+        ClusterBroker::~ClusterBroker() {
+            // ioContext 종료 후 소멸되므로 strand를 거치지 않고 바로 정리
+            m_running = false;
+            closeAll();
+        }
+
+        bool ClusterBroker::start(const std::string& bindAddress, int port) {
+            try {
+                auto address = boost::asio::ip::make_address(bindAddress);
+                boost::asio::ip::tcp::endpoint endpoint(address, static_cast<unsigned short>(port));
+
+                m_acceptor.open(endpoint.protocol());
+                m_acceptor.set_option(boost::asio::ip::tcp::acceptor::reuse_address(true));
+                m_acceptor.bind(endpoint);
+                m_acceptor.listen();
+            }
+            catch (const std::exception& e) {
+                spdlog::error("클러스터 브로커 시작 실패 ({}:{}): {}", bindAddress, port, e.what());
+                return false;
+            }
+
+            m_running = true;
+            boost::asio::post(m_strand, [this]() { startAccept(); });
+
+            spdlog::info("클러스터 브로커 시작: {}:{}", bindAddress, port);
+            return true;
+        }
+
+        void ClusterBroker::stop() {
+            if (!m_running.exchange(false)) {
+                return;
+            }
+
+            boost::asio::post(m_strand, [this]() { closeAll(); });
+        }
+
+        void ClusterBroker::closeAll() {
+            boost::system::error_code ignored;
+            m_acceptor.close(ignored);
+            for (const auto& connection : m_connections) {
+                connection->closed = true;
+                connection->socket.close(ignored);
+            }
+            m_connections.clear();
+            m_connectionCount = 0;
+        }
+
+        size_t ClusterBroker::getConnectionCount() const {
+            return m_connectionCount.load();
+        }
+
+        void ClusterBroker::startAccept() {
+            // 모든 연결의 읽기/쓰기를 브로커 strand 하나에서 처리 (연결 목록 보호)
+            m_acceptor.async_accept(m_strand,
+                [this](const boost::system::error_code& error, boost::asio::ip::tcp::socket socket) {
+                    if (!m_running.load()) {
+                        return;
+                    }
+                    if (!error) {
+                        auto connection = std::make_shared<Connection>(std::move(socket));
+                        boost::system::error_code ignored;
+                        connection->socket.set_option(boost::asio::ip::tcp::no_delay(true), ignored);
+                        m_connections.push_back(connection);
+                        m_connectionCount = m_connections.size();
+
+                        spdlog::info("클러스터 노드 연결: {} (연결 {}개)",
+                            connection->socket.remote_endpoint(ignored).address().to_string(), m_connections.size());
+                        startRead(connection);
+                    }
+                    startAccept();
+                });
+        }
+
+        void ClusterBroker::startRead(const std::shared_ptr<Connection>& connection) {
+            boost::asio::async_read_until(connection->socket, connection->readBuffer, '\n',
+                [this, connection](const boost::system::error_code& error, size_t bytes) {
+                    if (error || !m_running.load()) {
+                        closeConnection(connection);
+                        return;
+                    }
+
+                    auto line = std::make_shared<const std::string>(
+                        boost::asio::buffers_begin(connection->readBuffer.data()),
+                        boost::asio::buffers_begin(connection->readBuffer.data()) + bytes);
+                    connection->readBuffer.consume(bytes);
+
+                    relay(connection, line);
+                    startRead(connection);
+                });
+        }
+
+        void ClusterBroker::relay(const std::shared_ptr<Connection>& from, const std::shared_ptr<const std::string>& line) {
+            for (const auto& connection : m_connections) {
+                if (connection == from || connection->closed) {
+                    continue;
+                }
+                // 계속 밀리는 노드는 끊고 재접속 시 스냅샷으로 다시 맞추게 함
+                if (connection->writeQueue.size() >= MAX_PENDING_PUBLISHES) {
+                    spdlog::warn("클러스터 노드 전송 지연으로 연결 종료 (대기 {}줄)", connection->writeQueue.size());
+                    boost::system::error_code ignored;
+                    connection->socket.close(ignored);
+                    continue;
+                }
+                connection->writeQueue.push_back(line);
+                startWrite(connection);
+            }
+        }
+
+        void ClusterBroker::startWrite(const std::shared_ptr<Connection>& connection) {
+            if (connection->writing || connection->writeQueue.empty() || connection->closed) {
+                return;
+            }
+            connection->writing = true;
+
+            boost::asio::async_write(connection->socket, boost::asio::buffer(*connection->writeQueue.front()),
+                [this, connection](const boost::system::error_code& error, size_t /*bytes*/) {
+                    connection->writing = false;
+                    if (error) {
+                        closeConnection(connection);
+                        return;
+                    }
+                    connection->writeQueue.pop_front();
+                    startWrite(connection);
+                });
+        }
+
+        void ClusterBroker::closeConnection(const std::shared_ptr<Connection>& connection) {
+            if (connection->closed) {
+                return;
+            }
+            connection->closed = true;
+            connection->writeQueue.clear();
+
+            boost::system::error_code ignored;
+            connection->socket.close(ignored);
+
+            m_connections.erase(std::remove(m_connections.begin(), m_connections.end(), connection), m_connections.end());
+            m_connectionCount = m_connections.size();
+            spdlog::info("클러스터 노드 연결 해제 (연결 {}개)", m_connections.size());
+        }
+
+    } // namespace Server
+} // namespace Blokus
@@ -0,0 +1,431 @@
+#include "ClusterManager.h"
+#include "ServerMetrics.h"
+#include <spdlog/spdlog.h>
+#include <charconv>
+#include <sstream>
+
+namespace Blokus {
+    namespace Server {
+
+        namespace {
+            // "첫단어 나머지" 분리 (나머지에는 공백이 들어갈 수 있음)
+            bool splitFirst(const std::string& text, size_t begin, std::string& head, std::string& rest) {
+                size_t space = text.find(' ', begin);
+                if (space == std::string::npos) {
+                    head = text.substr(begin);
+                    rest.clear();
+                }
+                else {
+                    head = text.substr(begin, space - begin);
+                    rest = text.substr(space + 1);
+                }
+                return !head.empty();
+            }
+
+            template<typename T>
+            bool parseNumber(const std::string& text, T& value) {
+                auto result = std::from_chars(text.data(), text.data() + text.size(), value);
+                return result.ec == std::errc() && result.ptr == text.data() + text.size();
+            }
+        }
+
+        // ========================================
+        // 생성자/소멸자
+        // ========================================
+
+        ClusterManager::ClusterManager(Options options, std::shared_ptr<ClusterBus> bus)
+            : m_options(std::move(options))
+            , m_bus(std::move(bus))
+        {
+        }
+
+        ClusterManager::~ClusterManager() {
+            stop();
+        }
+
+        bool ClusterManager::start() {
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                if (m_running) {
+                    return true;
+                }
+                m_running = true;
+            }
+
+            bool started = m_bus->start(
+                [this](const ClusterMessage& message) { handleMessage(message); },
+                [this]() {
+                    // 합류/재접속: 다른 노드의 상태를 요청하고 내 상태를 알림
+                    publishHello();
+                    publishState();
+                });
+            if (!started) {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_running = false;
+                return false;
+            }
+
+            spdlog::info("클러스터 모드 시작: 노드 {} ({}:{})", m_options.nodeId, m_options.publicHost, m_options.publicPort);
+            return true;
+        }
+
+        void ClusterManager::stop() {
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                if (!m_running) {
+                    return;
+                }
+                m_running = false;
+            }
+
+            // 다른 노드가 시간 초과를 기다리지 않고 바로 이 노드의 방/사용자를 정리하도록 알림
+            publish("node.leave", "");
+            m_bus->stop();
+            spdlog::info("클러스터 모드 종료: 노드 {}", m_options.nodeId);
+        }
+
+        // ========================================
+        // 로컬 변경 알림
+        // ========================================
+
+        void ClusterManager::claimUser(const std::string& userId) {
+            uint64_t claimedAt = nowMillis();
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_localUsers[userId] = claimedAt;
+            }
+            publish("user.online", userId + " " + std::to_string(claimedAt));
+        }
+
+        void ClusterManager::releaseUser(const std::string& userId) {
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                if (m_localUsers.erase(userId) == 0) {
+                    return;
+                }
+            }
+            publish("user.offline", userId);
+        }
+
+        void ClusterManager::publishRoomRow(int roomId, const std::string* row) {
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                if (row) {
+                    m_localRooms[roomId] = *row;
+                }
+                else if (m_localRooms.erase(roomId) == 0) {
+                    return;
+                }
+            }
+
+            if (row) {
+                publish("room.upsert", std::to_string(roomId) + " " + *row);
+            }
+            else {
+                publish("room.remove", std::to_string(roomId));
+            }
+        }
+
+        void ClusterManager::tick() {
+            PendingActions actions;
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                if (!m_running) {
+                    return;
+                }
+
+                auto now = Clock::now();
+                std::vector<std::string> expired;
+                for (const auto& [nodeId, node] : m_nodes) {
+                    if (now - node.lastSeen > m_options.nodeTimeout) {
+                        expired.push_back(nodeId);
+                    }
+                }
+                for (const auto& nodeId : expired) {
+                    spdlog::warn("클러스터 노드 응답 없음: {} ({}초) -> 방/사용자 정보 제거", nodeId, m_options.nodeTimeout.count());
+                    removeNodeLocked(nodeId, actions);
+                }
+            }
+            runActions(actions);
+
+            publishState();
+        }
+
+        // ========================================
+        // 조회
+        // ========================================
+
+        bool ClusterManager::isUserOnRemoteNode(const std::string& userId, std::string* nodeId) const {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            for (const auto& [id, node] : m_nodes) {
+                if (node.users.count(userId)) {
+                    if (nodeId) {
+                        *nodeId = id;
+                    }
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        std::optional<ClusterManager::NodeAddress> ClusterManager::findRoomOwner(int roomId) const {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            for (const auto& [id, node] : m_nodes) {
+                if (node.port > 0 && node.rooms.count(roomId)) {
+                    return NodeAddress{ id, node.host, node.port };
+                }
+            }
+            return std::nullopt;
+        }
+
+        std::vector<std::string> ClusterManager::getRemoteLobbyRows() const {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            std::vector<std::string> rows;
+            for (const auto& [id, node] : m_nodes) {
+                rows.insert(rows.end(), node.lobbyRows.begin(), node.lobbyRows.end());
+            }
+            return rows;
+        }
+
+        size_t ClusterManager::getRemoteNodeCount() const {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            return m_nodes.size();
+        }
+
+        // ========================================
+        // 수신 처리 (버스 strand에서 하나씩 호출)
+        // ========================================
+
+        void ClusterManager::handleMessage(const ClusterMessage& message) {
+            ServerMetrics::instance().clusterMessagesReceived.add();
+
+            PendingActions actions;
+            bool replyWithState = false;
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                if (!m_running || message.source == m_options.nodeId) {
+                    return;
+                }
+
+                const std::string& topic = message.topic;
+                if (topic == "node.leave") {
+                    spdlog::info("클러스터 노드 종료: {}", message.source);
+                    removeNodeLocked(message.source, actions);
+                }
+                else {
+                    bool isNew = m_nodes.find(message.source) == m_nodes.end();
+                    RemoteNode& node = touchNodeLocked(message.source);
+
+                    if (topic == "node.hello") {
+                        replyWithState = true;
+                    }
+                    else if (topic == "node.state") {
+                        applyNodeStateLocked(message.source, message.payload, actions);
+                        // 재시작 등으로 hello를 놓친 노드도 내 상태를 받도록 처음 보는 노드에는 응답
+                        replyWithState = isNew;
+                    }
+                    else if (topic == "user.online") {
+                        std::string userId, claimedText;
+                        uint64_t claimedAt = 0;
+                        if (splitFirst(message.payload, 0, userId, claimedText) && parseNumber(claimedText, claimedAt)) {
+                            node.users[userId] = claimedAt;
+                            checkUserClaimLocked(message.source, userId, claimedAt, actions);
+                        }
+                    }
+                    else if (topic == "user.offline") {
+                        node.users.erase(message.payload);
+                    }
+                    else if (topic == "room.upsert") {
+                        std::string idText, row;
+                        int roomId = 0;
+                        if (splitFirst(message.payload, 0, idText, row) && parseNumber(idText, roomId)) {
+                            node.rooms[roomId] = row;
+                            actions.roomRows.emplace_back(roomId, row);
+                        }
+                    }
+                    else if (topic == "room.remove") {
+                        int roomId = 0;
+                        if (parseNumber(message.payload, roomId) && node.rooms.erase(roomId) > 0) {
+                            actions.roomRows.emplace_back(roomId, std::nullopt);
+                        }
+                    }
+                    else {
+                        spdlog::debug("알 수 없는 클러스터 토픽: {} (노드 {})", topic, message.source);
+                    }
+                }
+            }
+
+            runActions(actions);
+            if (replyWithState) {
+                publishState();
+            }
+        }
+
+        void ClusterManager::applyNodeStateLocked(const std::string& nodeId, const std::string& payload, PendingActions& actions) {
+            RemoteNode& node = m_nodes[nodeId];
+
+            std::unordered_map<std::string, uint64_t> users;
+            std::map<int, std::string> rooms;
+            std::vector<std::string> lobbyRows;
+
+            std::istringstream stream(payload);
+            std::string line, head, rest;
+            while (std::getline(stream, line)) {
+                if (line.size() < 2 || line[1] != ' ') {
+                    continue;
+                }
+                switch (line[0]) {
+                case 'N': {
+                    int port = 0;
+                    if (splitFirst(line, 2, head, rest) && parseNumber(rest, port)) {
+                        node.host = head;
+                        node.port = port;
+                    }
+                    break;
+                }
+                case 'U': {
+                    uint64_t claimedAt = 0;
+                    if (splitFirst(line, 2, head, rest) && parseNumber(rest, claimedAt)) {
+                        users[head] = claimedAt;
+                    }
+                    break;
+                }
+                case 'R': {
+                    int roomId = 0;
+                    if (splitFirst(line, 2, head, rest) && parseNumber(head, roomId)) {
+                        rooms[roomId] = rest;
+                    }
+                    break;
+                }
+                case 'L':
+                    lobbyRows.push_back(line.substr(2));
+                    break;
+                default:
+                    break;
+                }
+            }
+
+            // 방 목록: 사라진 방은 제거, 바뀐 행만 반영
+            for (const auto& [roomId, row] : node.rooms) {
+                if (!rooms.count(roomId)) {
+                    actions.roomRows.emplace_back(roomId, std::nullopt);
+                }
+            }
+            for (const auto& [roomId, row] : rooms) {
+                auto it = node.rooms.find(roomId);
+                if (it == node.rooms.end() || it->second != row) {
+                    actions.roomRows.emplace_back(roomId, row);
+                }
+            }
+
+            // 이벤트를 놓쳤더라도 스냅샷으로 동시 로그인 경합을 다시 확인
+            for (const auto& [userId, claimedAt] : users) {
+                checkUserClaimLocked(nodeId, userId, claimedAt, actions);
+            }
+
+            node.users = std::move(users);
+            node.rooms = std::move(rooms);
+            node.lobbyRows = std::move(lobbyRows);
+        }
+
+        void ClusterManager::checkUserClaimLocked(const std::string& nodeId, const std::string& userId, uint64_t claimedAt, PendingActions& actions) {
+            auto local = m_localUsers.find(userId);
+            if (local == m_localUsers.end()) {
+                return;
+            }
+
+            // 양쪽 노드가 같은 규칙으로 판단하므로 한쪽만 세션을 내려놓음
+            bool remoteWins = claimedAt < local->second ||
+                (claimedAt == local->second && nodeId < m_options.nodeId);
+            if (!remoteWins) {
+                return;
+            }
+
+            spdlog::warn("다른 노드와 동시 로그인 경합: 사용자 {} -> 노드 {}가 먼저 로그인, 이 노드의 세션 종료", userId, nodeId);
+            m_localUsers.erase(local);
+            actions.lostUsers.emplace_back(userId, nodeId);
+        }
+
+        void ClusterManager::removeNodeLocked(const std::string& nodeId, PendingActions& actions) {
+            auto it = m_nodes.find(nodeId);
+            if (it == m_nodes.end()) {
+                return;
+            }
+            for (const auto& [roomId, row] : it->second.rooms) {
+                actions.roomRows.emplace_back(roomId, std::nullopt);
+            }
+            m_nodes.erase(it);
+            ServerMetrics::instance().clusterNodes.set(static_cast<int64_t>(m_nodes.size()));
+        }
+
+        ClusterManager::RemoteNode& ClusterManager::touchNodeLocked(const std::string& nodeId) {
+            auto [it, inserted] = m_nodes.try_emplace(nodeId);
+            it->second.lastSeen = Clock::now();
+            if (inserted) {
+                spdlog::info("클러스터 노드 합류: {} (노드 {}개)", nodeId, m_nodes.size() + 1);
+                ServerMetrics::instance().clusterNodes.set(static_cast<int64_t>(m_nodes.size()));
+            }
+            return it->second;
+        }
+
+        void ClusterManager::runActions(PendingActions& actions) {
+            if (m_roomRowSink) {
+                for (const auto& [roomId, row] : actions.roomRows) {
+                    m_roomRowSink(roomId, row ? &*row : nullptr);
+                }
+            }
+            for (const auto& [userId, winnerNodeId] : actions.lostUsers) {
+                ServerMetrics::instance().clusterLoginConflicts.add();
+                if (m_conflictHandler) {
+                    m_conflictHandler(userId, winnerNodeId);
+                }
+            }
+        }
+
+        // ========================================
+        // 발행
+        // ========================================
+
+        void ClusterManager::publish(const std::string& topic, const std::string& payload) {
+            m_bus->publish(topic, payload);
+            ServerMetrics::instance().clusterMessagesPublished.add();
+        }
+
+        void ClusterManager::publishHello() {
+            publish("node.hello", "");
+        }
+
+        void ClusterManager::publishState() {
+            publish("node.state", buildStatePayload());
+        }
+
+        std::string ClusterManager::buildStatePayload() {
+            // 로비 목록은 세션 잠금을 사용하므로 클러스터 잠금 밖에서 먼저 수집
+            std::vector<std::string> lobbyRows;
+            if (m_lobbyRosterProvider) {
+                lobbyRows = m_lobbyRosterProvider();
+            }
+
+            std::string payload = "N " + m_options.publicHost + " " + std::to_string(m_options.publicPort) + "\n";
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                for (const auto& [userId, claimedAt] : m_localUsers) {
+                    payload += "U " + userId + " " + std::to_string(claimedAt) + "\n";
+                }
+                for (const auto& [roomId, row] : m_localRooms) {
+                    payload += "R " + std::to_string(roomId) + " " + row + "\n";
+                }
+            }
+            for (const auto& row : lobbyRows) {
+                payload += "L " + row + "\n";
+            }
+            return payload;
+        }
+
+        uint64_t ClusterManager::nowMillis() {
+            return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(
+                std::chrono::system_clock::now().time_since_epoch()).count());
+        }
+
+    } // namespace Server
+} // namespace Blokus
@@ -11,6 +11,74 @@ namespace Blokus {
         int ConfigManager::serverPort;
         int ConfigManager::maxClients;
         int ConfigManager::threadPoolSize;
+        std::string ConfigManager::ioModel;
+        std::string ConfigManager::networkBackend;
+        int ConfigManager::ioUringRegisteredBuffers;
+
+        // 지표 설정
+        int ConfigManager::metricsPort;
+        std::string ConfigManager::metricsBindAddress;
+        int ConfigManager::traceSampleEvery;
+        int ConfigManager::traceBufferEvents;
+
+        // 관전 설정
+        bool ConfigManager::spectatorEnabled;
+        int ConfigManager::spectatorMaxPerRoom;
+        int ConfigManager::spectatorFanoutThreads;
+        int ConfigManager::spectatorShardSize;
+        int ConfigManager::spectatorMaxPendingFrames;
+        int ConfigManager::spectatorLogEntries;
+
+        // 세션 재개 설정
+        bool ConfigManager::resumeEnabled;
+        int ConfigManager::resumeGraceSeconds;
+        int ConfigManager::resumeReplayEvents;
+
+        // 채팅 설정
+        int ConfigManager::chatRatePerSecond;
+        int ConfigManager::chatBurst;
+        int ConfigManager::chatBatchWindowMs;
+        int ConfigManager::chatHistorySize;
+
+        // 입장 제어 설정
+        int ConfigManager::admissionIpConnectPerMinute;
+        int ConfigManager::admissionIpConnectBurst;
+        int ConfigManager::admissionMaxUnauthenticated;
+        int ConfigManager::authIdleDeadlineSeconds;
+        int ConfigManager::sessionMessageRatePerSecond;
+        int ConfigManager::sessionMessageBurst;
+        int ConfigManager::sessionMessageDropLimit;
+
+        // 프레임 압축 설정
+        bool ConfigManager::compressionEnabled;
+        int ConfigManager::compressionMinBytes;
+        int ConfigManager::compressionLevel;
+
+        // 세션 풀 설정
+        int ConfigManager::sessionPoolSize;
+
+        // 중복 로그인 설정
+        int ConfigManager::loginMaxUsersPerIp;
+
+        // 드레인 종료 설정
+        bool ConfigManager::drainOnShutdown;
+        std::string ConfigManager::drainSnapshotFile;
+        int ConfigManager::drainReconnectHintSeconds;
+        int ConfigManager::drainFlushTimeoutMs;
+        int ConfigManager::drainSnapshotMaxAgeSeconds;
+        int ConfigManager::migrationSeatGraceSeconds;
+
+        // 클러스터 설정
+        bool ConfigManager::clusterEnabled;
+        int ConfigManager::clusterNodeIndex;
+        std::string ConfigManager::clusterNodeId;
+        std::string ConfigManager::clusterPublicHost;
+        std::string ConfigManager::clusterBus;
+        std::string ConfigManager::clusterBusHost;
+        int ConfigManager::clusterBusPort;
+        bool ConfigManager::clusterBrokerListen;
+        std::string ConfigManager::clusterBrokerBindAddress;
+        int ConfigManager::clusterNodeTimeoutSeconds;
 
         // 데이터베이스 설정
         std::string ConfigManager::dbHost;
@@ -20,15 +88,34 @@ namespace Blokus {
         std::string ConfigManager::dbName;
         std::string ConfigManager::dbConnectionString;
         int ConfigManager::dbPoolSize;
+        int ConfigManager::dbExecutorThreads;
+
+        // 게임 결과 저장 큐 설정
+        int ConfigManager::gameResultBatchSize;
+        int ConfigManager::gameResultFlushIntervalMs;
+        int ConfigManager::gameResultMaxRetries;
+        std::string ConfigManager::gameResultSpillFile;
+        int ConfigManager::userStatsCacheMaxEntries;
 
         // 보안 설정
         std::string ConfigManager::jwtSecret;
         int ConfigManager::sessionTimeoutHours;
         int ConfigManager::passwordSaltRounds;
 
+        // JWT 검증 캐시 설정
+        int ConfigManager::jwtCacheMaxEntries;
+        int ConfigManager::jwksRefreshIntervalSec;
+
+        // 암호 작업 실행기 설정
+        int ConfigManager::cryptoThreads;
+        int ConfigManager::cryptoQueueLimit;
+        int ConfigManager::cryptoPerClientLimit;
+
         // 로깅 설정
         std::string ConfigManager::logLevel;
         std::string ConfigManager::logDirectory;
+        bool ConfigManager::logAsync;
+        int ConfigManager::logQueueSize;
 
         // 개발 설정
         bool ConfigManager::debugMode;
@@ -0,0 +1,174 @@
+#include "CryptoExecutor.h"
+#include <algorithm>
+
+namespace Blokus {
+    namespace Server {
+
+        // ========================================
+        // 생성자/소멸자
+        // ========================================
+
+        CryptoExecutor::CryptoExecutor(size_t threadCount, size_t maxQueueDepth, size_t maxPerClient)
+            : m_threadCount(std::max<size_t>(1, threadCount))
+            , m_maxQueueDepth(std::max<size_t>(1, maxQueueDepth))
+            , m_maxPerClient(std::max<size_t>(1, maxPerClient))
+        {
+            for (size_t i = 0; i < m_threadCount; ++i) {
+                m_workers.emplace_back(&CryptoExecutor::workerLoop, this);
+            }
+
+            spdlog::info("암호 작업 실행기 초기화 ({} 스레드, 대기열: {}, 클라이언트당: {})",
+                m_threadCount, m_maxQueueDepth, m_maxPerClient);
+        }
+
+        CryptoExecutor::~CryptoExecutor() {
+            shutdown();
+        }
+
+        void CryptoExecutor::shutdown() {
+            if (m_shouldStop.exchange(true)) {
+                return;
+            }
+
+            // 대기 중인 작업은 폐기 (종료 시점의 로그인 요청은 응답할 곳이 없음)
+            size_t dropped = 0;
+            {
+                std::lock_guard<std::mutex> lock(m_queueMutex);
+                dropped = m_queuedCount;
+                m_queues.clear();
+                m_readyClients.clear();
+                m_queuedCount = 0;
+            }
+            m_queueCv.notify_all();
+
+            for (auto& worker : m_workers) {
+                if (worker.joinable()) {
+                    worker.join();
+                }
+            }
+            m_workers.clear();
+
+            spdlog::info("암호 작업 실행기 종료 완료 (폐기된 대기 작업: {}개)", dropped);
+        }
+
+        // ========================================
+        // 작업 등록
+        // ========================================
+
+        bool CryptoExecutor::submit(const std::string& clientKey, const std::string& label, std::function<void()> task) {
+            if (m_shouldStop) {
+                return false;
+            }
+
+            {
+                std::lock_guard<std::mutex> lock(m_queueMutex);
+
+                if (m_queuedCount >= m_maxQueueDepth) {
+                    ++m_rejectedCount;
+                    spdlog::warn("암호 작업 거절: 대기열 포화 ({}/{}) - {} ({})",
+                        m_queuedCount, m_maxQueueDepth, label, clientKey);
+                    return false;
+                }
+
+                auto& queue = m_queues[clientKey];
+                if (queue.size() >= m_maxPerClient) {
+                    ++m_rejectedCount;
+                    spdlog::warn("암호 작업 거절: 클라이언트 대기 한도 초과 ({}/{}) - {} ({})",
+                        queue.size(), m_maxPerClient, label, clientKey);
+                    return false;
+                }
+
+                if (queue.empty()) {
+                    m_readyClients.push_back(clientKey);
+                }
+                queue.push_back({ std::move(task), label, std::chrono::steady_clock::now() });
+                ++m_queuedCount;
+            }
+
+            m_queueCv.notify_one();
+            return true;
+        }
+
+        // ========================================
+        // 워커
+        // ========================================
+
+        void CryptoExecutor::workerLoop() {
+            while (true) {
+                Task task;
+                {
+                    std::unique_lock<std::mutex> lock(m_queueMutex);
+                    m_queueCv.wait(lock, [this] {
+                        return m_shouldStop.load() || !m_readyClients.empty();
+                    });
+
+                    if (m_shouldStop) {
+                        break;
+                    }
+
+                    // 라운드로빈: 맨 앞 클라이언트의 작업 1개를 꺼내고, 남은 작업이 있으면 맨 뒤로 보냄
+                    std::string clientKey = std::move(m_readyClients.front());
+                    m_readyClients.pop_front();
+
+                    auto it = m_queues.find(clientKey);
+                    if (it == m_queues.end() || it->second.empty()) {
+                        continue;
+                    }
+
+                    task = std::move(it->second.front());
+                    it->second.pop_front();
+                    --m_queuedCount;
+
+                    if (it->second.empty()) {
+                        m_queues.erase(it);
+                    }
+                    else {
+                        m_readyClients.push_back(std::move(clientKey));
+                    }
+                }
+
+                auto started = std::chrono::steady_clock::now();
+                try {
+                    task.work();
+                }
+                catch (const std::exception& e) {
+                    spdlog::error("암호 작업 처리 중 예외 ({}): {}", task.label, e.what());
+                }
+                auto finished = std::chrono::steady_clock::now();
+
+                double waitMs = std::chrono::duration<double, std::milli>(started - task.enqueuedAt).count();
+                double execMs = std::chrono::duration<double, std::milli>(finished - started).count();
+                recordLatency(task.label, waitMs, execMs);
+            }
+        }
+
+        // ========================================
+        // 지표
+        // ========================================
+
+        void CryptoExecutor::recordLatency(const std::string& label, double waitMs, double execMs) {
+            {
+                std::lock_guard<std::mutex> lock(m_metricsMutex);
+                auto& stats = m_latency[label];
+                stats.count++;
+                stats.totalWaitMs += waitMs;
+                stats.totalExecMs += execMs;
+                stats.maxWaitMs = std::max(stats.maxWaitMs, waitMs);
+                stats.maxExecMs = std::max(stats.maxExecMs, execMs);
+            }
+
+            spdlog::debug("암호 작업 완료: {} (대기 {:.1f}ms, 실행 {:.1f}ms)", label, waitMs, execMs);
+        }
+
+        size_t CryptoExecutor::getQueuedCount() const {
+            std::lock_guard<std::mutex> lock(m_queueMutex);
+            return m_queuedCount;
+        }
+
+        std::unordered_map<std::string, CryptoExecutor::LatencyStats> CryptoExecutor::getLatencyStats() const {
+            std::lock_guard<std::mutex> lock(m_metricsMutex);
+            return m_latency;
+        }
+
+    } // namespace Server
+} // namespace Blokus
@@ -0,0 +1,34 @@
+#include "DatabaseExecutor.h"
+
+namespace Blokus {
+    namespace Server {
+
+        // ========================================
+        // 생성자/소멸자
+        // ========================================
+
+        DatabaseExecutor::DatabaseExecutor(std::shared_ptr<DatabaseManager> dbManager, size_t threadCount)
+            : m_dbManager(dbManager)
+            , m_threadCount(threadCount > 0 ? threadCount : 1)
+            , m_pool(m_threadCount)
+        {
+            spdlog::info("DB 비동기 실행기 초기화 ({} 스레드)", m_threadCount);
+        }
+
+        DatabaseExecutor::~DatabaseExecutor() {
+            shutdown();
+        }
+
+        void DatabaseExecutor::shutdown() {
+            if (m_isShutdown.exchange(true)) {
+                return;
+            }
+
+            // 이미 제출된 작업은 모두 끝낸 뒤 종료 (완료 핸들러는 io_context 상태에 따라 실행)
+            spdlog::info("DB 비동기 실행기 종료 중... (대기 작업: {}개)", m_pendingCount.load());
+            m_pool.join();
+            spdlog::info("DB 비동기 실행기 종료 완료");
+        }
+
+    } // namespace Server
+} // namespace Blokus
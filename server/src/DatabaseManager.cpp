@@ -1,5 +1,6 @@
 ﻿#include "DatabaseManager.h"
 #include "ConfigManager.h"
+#include "Tracing.h"
 #include <pqxx/pqxx>
 #include <spdlog/spdlog.h>
 #include <spdlog/fmt/fmt.h>
@@ -8,10 +9,154 @@
 #include <condition_variable>
 #include <chrono>
 #include <ctime>
+#include <map>
+#include <algorithm>
 
 namespace Blokus {
     namespace Server {
 
+        // ========================================
+        // Prepared Statement 등록 (커넥션 생성 시 1회, 이후 파싱/플래닝 생략)
+        // ========================================
+        namespace {
+            constexpr const char* kStmtUserByUsername = "user_by_username";
+            constexpr const char* kStmtUserByDisplayName = "user_by_display_name";
+            constexpr const char* kStmtUserById = "user_by_id";
+            constexpr const char* kStmtUsersByIds = "users_by_ids";
+            constexpr const char* kStmtUserProfileByUsername = "user_profile_by_username";
+            constexpr const char* kStmtUpdateLastLoginById = "update_last_login_by_id";
+            constexpr const char* kStmtUpdateGameStats = "update_game_stats";
+            constexpr const char* kStmtLockStatsRows = "lock_stats_rows";
+            constexpr const char* kStmtUpsertStatsDeltas = "upsert_stats_deltas";
+            constexpr const char* kStmtSelectUserSettings = "select_user_settings";
+            constexpr const char* kStmtUpsertUserSettings = "upsert_user_settings";
+
+            // 계정 조회 공통 컬럼 (readUserAccount와 순서 일치)
+            const std::string kUserAccountColumns =
+                "SELECT u.user_id, u.username, u.display_name, u.password_hash, "
+                "       COALESCE(s.total_games, 0), COALESCE(s.wins, 0), COALESCE(s.losses, 0), "
+                "       COALESCE(s.draws, 0), COALESCE(s.level, 1), COALESCE(s.experience_points, 0), "
+                "       COALESCE(s.total_score, 0), COALESCE(s.best_score, 0), "
+                "       u.is_active ";
+
+            void prepareStatements(pqxx::connection& conn) {
+                // 사용자 조회 (로그인/통계 요청/세션 동기화)
+                conn.prepare(kStmtUserByUsername,
+                    kUserAccountColumns +
+                    "FROM users u "
+                    "LEFT JOIN user_stats s ON u.user_id = s.user_id "
+                    "WHERE LOWER(u.username) = LOWER($1) AND u.is_active = true");
+                conn.prepare(kStmtUserByDisplayName,
+                    kUserAccountColumns +
+                    "FROM users u "
+                    "LEFT JOIN user_stats s ON u.user_id = s.user_id "
+                    "WHERE LOWER(u.display_name) = LOWER($1) AND u.is_active = true");
+                conn.prepare(kStmtUserById,
+                    kUserAccountColumns +
+                    "FROM users u "
+                    "LEFT JOIN user_stats s ON u.user_id = s.user_id "
+                    "WHERE u.user_id = $1 AND u.is_active = true");
+                conn.prepare(kStmtUsersByIds,
+                    kUserAccountColumns +
+                    "FROM users u "
+                    "LEFT JOIN user_stats s ON u.user_id = s.user_id "
+                    "WHERE u.user_id = ANY($1::int[]) AND u.is_active = true");
+
+                // 로그인 직후 계정 + 설정을 한 번의 왕복으로 조회
+                conn.prepare(kStmtUserProfileByUsername,
+                    kUserAccountColumns +
+                    ", us.user_id AS settings_user_id, us.theme, us.language, "
+                    "us.game_invite_notifications, us.friend_online_notifications, us.system_notifications, "
+                    "us.bgm_mute, us.bgm_volume, us.effect_mute, us.effect_volume "
+                    "FROM users u "
+                    "LEFT JOIN user_stats s ON u.user_id = s.user_id "
+                    "LEFT JOIN user_settings us ON u.user_id = us.user_id "
+                    "WHERE LOWER(u.username) = LOWER($1) AND u.is_active = true");
+
+                conn.prepare(kStmtUpdateLastLoginById,
+                    "UPDATE users SET last_login_at = CURRENT_TIMESTAMP WHERE user_id = $1");
+
+                // 게임 결과 저장
+                conn.prepare(kStmtUpdateGameStats,
+                    "UPDATE user_stats SET "
+                    "total_games = total_games + 1, "
+                    "wins = wins + CASE WHEN $2 THEN 1 ELSE 0 END, "
+                    "losses = losses + CASE WHEN NOT $2 AND NOT $3 THEN 1 ELSE 0 END, "
+                    "draws = draws + CASE WHEN $3 THEN 1 ELSE 0 END, "
+                    "total_score = total_score + $4, "
+                    "best_score = GREATEST(best_score, $4), "
+                    "current_win_streak = CASE WHEN $2 THEN current_win_streak + 1 ELSE 0 END, "
+                    "longest_win_streak = GREATEST(longest_win_streak, "
+                        "CASE WHEN $2 THEN current_win_streak + 1 ELSE current_win_streak END), "
+                    "last_played = CURRENT_TIMESTAMP, "
+                    "updated_at = CURRENT_TIMESTAMP "
+                    "WHERE user_id = $1");
+                conn.prepare(kStmtLockStatsRows,
+                    "SELECT user_id, level, experience_points, current_win_streak, longest_win_streak "
+                    "FROM user_stats WHERE user_id = ANY($1::int[]) FOR UPDATE");
+                conn.prepare(kStmtUpsertStatsDeltas,
+                    "INSERT INTO user_stats (user_id, total_games, wins, losses, total_score, best_score, "
+                    "current_win_streak, longest_win_streak, level, experience_points, last_played, updated_at) "
+                    "SELECT d.user_id, d.games, d.wins, d.losses, d.total_score, d.best_score, "
+                    "d.streak, d.longest, d.level, d.exp, CURRENT_TIMESTAMP, CURRENT_TIMESTAMP "
+                    "FROM unnest($1::int[], $2::int[], $3::int[], $4::int[], $5::int[], $6::int[], "
+                    "$7::int[], $8::int[], $9::int[], $10::int[]) "
+                    "AS d(user_id, games, wins, losses, total_score, best_score, streak, longest, level, exp) "
+                    "JOIN users u ON u.user_id = d.user_id AND u.is_active = true "
+                    "ON CONFLICT (user_id) DO UPDATE SET "
+                    "total_games = user_stats.total_games + EXCLUDED.total_games, "
+                    "wins = user_stats.wins + EXCLUDED.wins, "
+                    "losses = user_stats.losses + EXCLUDED.losses, "
+                    "total_score = user_stats.total_score + EXCLUDED.total_score, "
+                    "best_score = GREATEST(user_stats.best_score, EXCLUDED.best_score), "
+                    "current_win_streak = EXCLUDED.current_win_streak, "
+                    "longest_win_streak = EXCLUDED.longest_win_streak, "
+                    "level = EXCLUDED.level, "
+                    "experience_points = EXCLUDED.experience_points, "
+                    "last_played = EXCLUDED.last_played, "
+                    "updated_at = EXCLUDED.updated_at");
+
+                // 사용자 설정
+                conn.prepare(kStmtSelectUserSettings,
+                    "SELECT theme, language, game_invite_notifications, "
+                    "friend_online_notifications, system_notifications, "
+                    "bgm_mute, bgm_volume, effect_mute, effect_volume "
+                    "FROM user_settings WHERE user_id = $1");
+                conn.prepare(kStmtUpsertUserSettings,
+                    "INSERT INTO user_settings (user_id, theme, language, "
+                    "game_invite_notifications, friend_online_notifications, "
+                    "system_notifications, bgm_mute, bgm_volume, effect_mute, effect_volume) "
+                    "VALUES ($1, $2, $3, $4, $5, $6, $7, $8, $9, $10) "
+                    "ON CONFLICT (user_id) DO UPDATE SET "
+                    "theme = EXCLUDED.theme, language = EXCLUDED.language, "
+                    "game_invite_notifications = EXCLUDED.game_invite_notifications, "
+                    "friend_online_notifications = EXCLUDED.friend_online_notifications, "
+                    "system_notifications = EXCLUDED.system_notifications, "
+                    "bgm_mute = EXCLUDED.bgm_mute, bgm_volume = EXCLUDED.bgm_volume, "
+                    "effect_mute = EXCLUDED.effect_mute, effect_volume = EXCLUDED.effect_volume, "
+                    "updated_at = CURRENT_TIMESTAMP");
+            }
+
+            // kUserAccountColumns 순서의 행을 UserAccount로 변환
+            UserAccount readUserAccount(const pqxx::row& row) {
+                UserAccount user;
+                user.userId = row[0].as<uint32_t>();
+                user.username = row[1].as<std::string>();
+                user.displayName = row[2].is_null() ? user.username : row[2].as<std::string>();
+                user.passwordHash = row[3].as<std::string>();
+                user.totalGames = row[4].as<int>();
+                user.wins = row[5].as<int>();
+                user.losses = row[6].as<int>();
+                user.draws = row[7].as<int>();
+                user.level = row[8].as<int>();
+                user.experiencePoints = row[9].as<int>();
+                user.totalScore = row[10].as<int>();
+                user.bestScore = row[11].as<int>();
+                user.isActive = row[12].as<bool>();
+                return user;
+            }
+        }
+
         // ========================================
         // ConnectionPool 구현 (cpp에만 정의)
         // ========================================
@@ -26,6 +171,13 @@ namespace Blokus {
             size_t currentSize_;
             std::chrono::milliseconds waitTimeout_;
 
+            // 새 커넥션 생성 + 핫 경로 prepared statement 등록
+            std::unique_ptr<pqxx::connection> createConnection() {
+                auto conn = std::make_unique<pqxx::connection>(connectionString_);
+                prepareStatements(*conn);
+                return conn;
+            }
+
         public:
             ConnectionPool(const std::string& connStr, size_t size)
                 : connectionString_(connStr),
@@ -36,7 +188,7 @@ namespace Blokus {
                 spdlog::info("{}개 커넥션의 데이터베이스 풀 생성 중 (최대: {})... ", size, maxPoolSize_);
                 for (size_t i = 0; i < size; ++i) {
                     try {
-                        connections_.push(std::make_unique<pqxx::connection>(connectionString_));
+                        connections_.push(createConnection());
                         currentSize_++;
                     }
                     catch (const std::exception& e) {
@@ -48,6 +200,7 @@ namespace Blokus {
             }
 
             std::unique_ptr<pqxx::connection> getConnection() {
+                TraceSpan span("DatabaseManager::getConnection");
                 std::unique_lock<std::mutex> lock(mutex_);
 
                 // 1. 풀에 가용 커넥션이 있으면 즉시 반환
@@ -62,7 +215,7 @@ namespace Blokus {
                     spdlog::warn("풀 확장: 새 커넥션 생성 중 ({}/{})", currentSize_ + 1, maxPoolSize_);
                     currentSize_++;
                     try {
-                        return std::make_unique<pqxx::connection>(connectionString_);
+                        return createConnection();
                     } catch (const std::exception& e) {
                         currentSize_--;  // 생성 실패 시 카운터 복구
                         spdlog::error("커넥션 생성 실패: {}", e.what());
@@ -118,6 +271,32 @@ namespace Blokus {
             }
         };
 
+        // ========================================
+        // 배열 파라미터 헬퍼 (unnest/ANY 다중 행 쿼리용)
+        // ========================================
+        namespace {
+            template<typename T>
+            std::string toPgArray(const std::vector<T>& values) {
+                std::string literal = "{";
+                for (size_t i = 0; i < values.size(); ++i) {
+                    if (i > 0) literal += ",";
+                    literal += std::to_string(values[i]);
+                }
+                literal += "}";
+                return literal;
+            }
+
+            std::string toPgArray(const std::vector<bool>& values) {
+                std::string literal = "{";
+                for (size_t i = 0; i < values.size(); ++i) {
+                    if (i > 0) literal += ",";
+                    literal += values[i] ? "t" : "f";
+                }
+                literal += "}";
+                return literal;
+            }
+        }
+
         // ========================================
         // UserAccount 메서드 구현
         // ========================================
@@ -191,20 +370,13 @@ namespace Blokus {
         // ========================================
 
         std::optional<UserAccount> DatabaseManager::getUserByUsername(const std::string& username) {
+            TraceSpan span("DatabaseManager::getUserByUsername");
             if (!isInitialized_) return std::nullopt;
 
             auto conn = dbPool_->getConnection();
             pqxx::work txn(*conn);
             try {
-                auto result = txn.exec_params(
-                    "SELECT u.user_id, u.username, u.display_name, u.password_hash, "
-                    "       COALESCE(s.total_games, 0), COALESCE(s.wins, 0), COALESCE(s.losses, 0), "
-                    "       COALESCE(s.draws, 0), COALESCE(s.level, 1), COALESCE(s.experience_points, 0), "
-                    "       COALESCE(s.total_score, 0), COALESCE(s.best_score, 0), "
-                    "       u.is_active "
-                    "FROM users u "
-                    "LEFT JOIN user_stats s ON u.user_id = s.user_id "
-                    "WHERE LOWER(u.username) = LOWER($1) AND u.is_active = true",
+                auto result = txn.exec_prepared(kStmtUserByUsername,
                     username
                 );
 
@@ -243,20 +415,13 @@ namespace Blokus {
         }
 
         std::optional<UserAccount> DatabaseManager::getUserByDisplayName(const std::string& displayName) {
+            TraceSpan span("DatabaseManager::getUserByDisplayName");
             if (!isInitialized_) return std::nullopt;
 
             auto conn = dbPool_->getConnection();
             pqxx::work txn(*conn);
             try {
-                auto result = txn.exec_params(
-                    "SELECT u.user_id, u.username, u.display_name, u.password_hash, "
-                    "       COALESCE(s.total_games, 0), COALESCE(s.wins, 0), COALESCE(s.losses, 0), "
-                    "       COALESCE(s.draws, 0), COALESCE(s.level, 1), COALESCE(s.experience_points, 0), "
-                    "       COALESCE(s.total_score, 0), COALESCE(s.best_score, 0), "
-                    "       u.is_active "
-                    "FROM users u "
-                    "LEFT JOIN user_stats s ON u.user_id = s.user_id "
-                    "WHERE LOWER(u.display_name) = LOWER($1) AND u.is_active = true",
+                auto result = txn.exec_prepared(kStmtUserByDisplayName,
                     displayName
                 );
 
@@ -295,20 +460,13 @@ namespace Blokus {
         }
 
         std::optional<UserAccount> DatabaseManager::getUserById(uint32_t userId) {
+            TraceSpan span("DatabaseManager::getUserById");
             if (!isInitialized_) return std::nullopt;
 
             auto conn = dbPool_->getConnection();
             pqxx::work txn(*conn);
             try {
-                auto result = txn.exec_params(
-                    "SELECT u.user_id, u.username, u.display_name, u.password_hash, "
-                    "       COALESCE(s.total_games, 0), COALESCE(s.wins, 0), COALESCE(s.losses, 0), "
-                    "       COALESCE(s.draws, 0), COALESCE(s.level, 1), COALESCE(s.experience_points, 0), "
-                    "       COALESCE(s.total_score, 0), COALESCE(s.best_score, 0), "
-                    "       u.is_active "
-                    "FROM users u "
-                    "LEFT JOIN user_stats s ON u.user_id = s.user_id "
-                    "WHERE u.user_id = $1 AND u.is_active = true",
+                auto result = txn.exec_prepared(kStmtUserById,
                     userId
                 );
 
@@ -346,7 +504,85 @@ namespace Blokus {
             }
         }
 
+        std::vector<UserAccount> DatabaseManager::getUsersByIds(const std::vector<uint32_t>& userIds) {
+            TraceSpan span("DatabaseManager::getUsersByIds");
+            std::vector<UserAccount> users;
+            if (!isInitialized_ || userIds.empty()) return users;
+
+            auto conn = dbPool_->getConnection();
+            pqxx::work txn(*conn);
+            try {
+                auto result = txn.exec_prepared(kStmtUsersByIds,
+                    toPgArray(userIds)
+                );
+
+                users.reserve(result.size());
+                for (const auto& row : result) {
+                    users.push_back(readUserAccount(row));
+                }
+
+                txn.commit();
+                dbPool_->returnConnection(std::move(conn));
+                return users;
+
+            }
+            catch (const std::exception& e) {
+                txn.abort();
+                dbPool_->returnConnection(std::move(conn));
+                spdlog::error("getUsersByIds 오류: {}", e.what());
+                return {};
+            }
+        }
+
+        std::optional<UserProfile> DatabaseManager::getUserProfileByUsername(const std::string& username) {
+            TraceSpan span("DatabaseManager::getUserProfileByUsername");
+            if (!isInitialized_) return std::nullopt;
+
+            auto conn = dbPool_->getConnection();
+            pqxx::work txn(*conn);
+            try {
+                // 계정/통계/설정을 한 번의 prepared 쿼리로 조회 (로그인 경로 왕복 횟수 최소화)
+                auto result = txn.exec_prepared(kStmtUserProfileByUsername, username);
+
+                if (result.empty()) {
+                    txn.abort();
+                    dbPool_->returnConnection(std::move(conn));
+                    return std::nullopt;
+                }
+
+                const auto row = result[0];
+                UserProfile profile;
+                profile.account = readUserAccount(row);
+
+                if (!row["settings_user_id"].is_null()) {
+                    UserSettings settings;
+                    settings.theme = row["theme"].as<std::string>();
+                    settings.language = row["language"].as<std::string>();
+                    settings.gameInviteNotifications = row["game_invite_notifications"].as<bool>();
+                    settings.friendOnlineNotifications = row["friend_online_notifications"].as<bool>();
+                    settings.systemNotifications = row["system_notifications"].as<bool>();
+                    settings.bgmMute = row["bgm_mute"].as<bool>();
+                    settings.bgmVolume = row["bgm_volume"].as<int>();
+                    settings.effectMute = row["effect_mute"].as<bool>();
+                    settings.effectVolume = row["effect_volume"].as<int>();
+                    profile.settings = settings;
+                }
+
+                txn.commit();
+                dbPool_->returnConnection(std::move(conn));
+                return profile;
+
+            }
+            catch (const std::exception& e) {
+                txn.abort();
+                dbPool_->returnConnection(std::move(conn));
+                spdlog::error("getUserProfileByUsername 오류: {}", e.what());
+                return std::nullopt;
+            }
+        }
+
         bool DatabaseManager::createUser(const std::string& username, const std::string& passwordHash) {
+            TraceSpan span("DatabaseManager::createUser");
             if (!isInitialized_) return false;
 
             auto conn = dbPool_->getConnection();
@@ -383,6 +619,7 @@ namespace Blokus {
         }
 
         bool DatabaseManager::updateUserLastLogin(const std::string& username) {
+            TraceSpan span("DatabaseManager::updateUserLastLogin");
             if (!isInitialized_) return false;
 
             auto conn = dbPool_->getConnection();
@@ -407,13 +644,13 @@ namespace Blokus {
         }
 
         bool DatabaseManager::updateUserLastLogin(uint32_t userId) {
+            TraceSpan span("DatabaseManager::updateUserLastLogin");
             if (!isInitialized_) return false;
 
             auto conn = dbPool_->getConnection();
             pqxx::work txn(*conn);
             try {
-                auto result = txn.exec_params(
-                    "UPDATE users SET last_login_at = CURRENT_TIMESTAMP WHERE user_id = $1",
+                auto result = txn.exec_prepared(kStmtUpdateLastLoginById,
                     userId
                 );
 
@@ -431,6 +668,7 @@ namespace Blokus {
         }
 
         std::optional<UserAccount> DatabaseManager::authenticateUser(const std::string& username, const std::string& passwordHash) {
+            TraceSpan span("DatabaseManager::authenticateUser");
             if (!isInitialized_) return std::nullopt;
 
             auto conn = dbPool_->getConnection();
@@ -483,6 +721,7 @@ namespace Blokus {
         }
 
         bool DatabaseManager::isUsernameAvailable(const std::string& username) {
+            TraceSpan span("DatabaseManager::isUsernameAvailable");
             if (!isInitialized_) return false;
 
             auto conn = dbPool_->getConnection();
@@ -511,6 +750,7 @@ namespace Blokus {
         // ========================================
 
         DatabaseStats DatabaseManager::getStats() {
+            TraceSpan span("DatabaseManager::getStats");
             DatabaseStats stats = {};
             if (!isInitialized_) return stats;
 
@@ -553,26 +793,14 @@ namespace Blokus {
         // ========================================
 
         bool DatabaseManager::updateGameStats(uint32_t userId, bool won, bool draw, int score) {
+            TraceSpan span("DatabaseManager::updateGameStats");
             if (!isInitialized_) return false;
 
             auto conn = dbPool_->getConnection();
             pqxx::work txn(*conn);
             try {
                 // 직접 업데이트 방식 (PostgreSQL 함수 대신)
-                txn.exec_params(
-                    "UPDATE user_stats SET "
-                    "total_games = total_games + 1, "
-                    "wins = wins + CASE WHEN $2 THEN 1 ELSE 0 END, "
-                    "losses = losses + CASE WHEN NOT $2 AND NOT $3 THEN 1 ELSE 0 END, "
-                    "draws = draws + CASE WHEN $3 THEN 1 ELSE 0 END, "
-                    "total_score = total_score + $4, "
-                    "best_score = GREATEST(best_score, $4), "
-                    "current_win_streak = CASE WHEN $2 THEN current_win_streak + 1 ELSE 0 END, "
-                    "longest_win_streak = GREATEST(longest_win_streak, "
-                        "CASE WHEN $2 THEN current_win_streak + 1 ELSE current_win_streak END), "
-                    "last_played = CURRENT_TIMESTAMP, "
-                    "updated_at = CURRENT_TIMESTAMP "
-                    "WHERE user_id = $1",
+                txn.exec_prepared(kStmtUpdateGameStats,
                     userId, won, draw, score
                 );
 
@@ -593,6 +821,7 @@ namespace Blokus {
                                             const std::vector<int>& scores, 
                                             const std::vector<bool>& isWinner,
                                             bool isDraw) {
+            TraceSpan span("DatabaseManager::saveGameResults");
             if (!isInitialized_) return false;
             
             if (playerIds.size() != scores.size() || playerIds.size() != isWinner.size()) {
@@ -638,20 +867,7 @@ namespace Blokus {
                     }
                     
                     // 통계 업데이트
-                    txn.exec_params(
-                        "UPDATE user_stats SET "
-                        "total_games = total_games + 1, "
-                        "wins = wins + CASE WHEN $2 THEN 1 ELSE 0 END, "
-                        "losses = losses + CASE WHEN NOT $2 AND NOT $3 THEN 1 ELSE 0 END, "
-                        "draws = draws + CASE WHEN $3 THEN 1 ELSE 0 END, "
-                        "total_score = total_score + $4, "
-                        "best_score = GREATEST(best_score, $4), "
-                        "current_win_streak = CASE WHEN $2 THEN current_win_streak + 1 ELSE 0 END, "
-                        "longest_win_streak = GREATEST(longest_win_streak, "
-                            "CASE WHEN $2 THEN current_win_streak + 1 ELSE current_win_streak END), "
-                        "last_played = CURRENT_TIMESTAMP, "
-                        "updated_at = CURRENT_TIMESTAMP "
-                        "WHERE user_id = $1",
+                    txn.exec_prepared(kStmtUpdateGameStats,
                         playerIds[i], won, draw, score
                     );
                     
@@ -673,11 +889,132 @@ namespace Blokus {
             }
         }
 
+        bool DatabaseManager::saveGameResultsBatch(const std::vector<GameResultRow>& rows) {
+            TraceSpan span("DatabaseManager::saveGameResultsBatch");
+            if (!isInitialized_) return false;
+            if (rows.empty()) return true;
+
+            // 1. 유저별 델타로 합산 (배치 안 순서대로 처리해야 연승 계산이 맞음)
+            struct StatsDelta {
+                int games = 0;
+                int wins = 0;
+                int losses = 0;
+                int totalScore = 0;
+                int bestScore = 0;
+                int expGained = 0;
+                int leadingWins = 0;   // 첫 패배 전까지의 연승
+                int trailingWins = 0;  // 마지막 패배 이후의 연승
+                int longestRun = 0;    // 배치 안 최장 연승
+                bool hadLoss = false;
+            };
+
+            std::map<uint32_t, StatsDelta> deltas;
+            for (const auto& row : rows) {
+                auto& delta = deltas[row.userId];
+                delta.games++;
+                delta.totalScore += row.score;
+                delta.bestScore = std::max(delta.bestScore, row.score);
+                delta.expGained += std::max(0, row.expGained);
+
+                // 무승부 개념 없음: 공동 1등도 승리
+                if (row.won) {
+                    delta.wins++;
+                    delta.trailingWins++;
+                    if (!delta.hadLoss) {
+                        delta.leadingWins++;
+                    }
+                    delta.longestRun = std::max(delta.longestRun, delta.trailingWins);
+                }
+                else {
+                    delta.losses++;
+                    delta.hadLoss = true;
+                    delta.trailingWins = 0;
+                }
+            }
+
+            std::vector<uint32_t> allUserIds;
+            allUserIds.reserve(deltas.size());
+            for (const auto& [userId, delta] : deltas) {
+                allUserIds.push_back(userId);
+            }
+
+            auto conn = dbPool_->getConnection();
+            pqxx::work txn(*conn);
+            try {
+                // 2. 기존 통계 잠금 조회 (연승/레벨 계산 기준값)
+                struct CurrentStats {
+                    int level = 1;
+                    int exp = 0;
+                    int streak = 0;
+                    int longest = 0;
+                };
+
+                std::map<uint32_t, CurrentStats> current;
+                auto locked = txn.exec_prepared(kStmtLockStatsRows, toPgArray(allUserIds));
+                for (const auto& row : locked) {
+                    CurrentStats stats;
+                    stats.level = row["level"].as<int>();
+                    stats.exp = row["experience_points"].as<int>();
+                    stats.streak = row["current_win_streak"].as<int>();
+                    stats.longest = row["longest_win_streak"].as<int>();
+                    current[row["user_id"].as<uint32_t>()] = stats;
+                }
+
+                // 3. 유저당 1행으로 최종 값 계산 (레벨업은 소모형)
+                std::vector<uint32_t> userIds;
+                std::vector<int> games, wins, losses, totalScores, bestScores, streaks, longests, levels, exps;
+                for (const auto& [userId, delta] : deltas) {
+                    CurrentStats base = current.count(userId) ? current[userId] : CurrentStats{};
+
+                    int streak = delta.hadLoss ? delta.trailingWins : base.streak + delta.leadingWins;
+                    int longest = std::max({ base.longest, base.streak + delta.leadingWins, delta.longestRun });
+
+                    int level = base.level;
+                    int exp = base.exp + delta.expGained;
+                    while (exp >= getRequiredExpForLevel(level + 1)) {
+                        exp -= getRequiredExpForLevel(level + 1);
+                        level++;
+                    }
+
+                    userIds.push_back(userId);
+                    games.push_back(delta.games);
+                    wins.push_back(delta.wins);
+                    losses.push_back(delta.losses);
+                    totalScores.push_back(delta.totalScore);
+                    bestScores.push_back(delta.bestScore);
+                    streaks.push_back(streak);
+                    longests.push_back(longest);
+                    levels.push_back(level);
+                    exps.push_back(exp);
+                }
+
+                // 4. 유저당 단일 upsert (통계 레코드가 없는 활성 사용자는 생성)
+                txn.exec_prepared(kStmtUpsertStatsDeltas,
+                    toPgArray(userIds), toPgArray(games), toPgArray(wins), toPgArray(losses),
+                    toPgArray(totalScores), toPgArray(bestScores), toPgArray(streaks),
+                    toPgArray(longests), toPgArray(levels), toPgArray(exps)
+                );
+
+                txn.commit();
+                dbPool_->returnConnection(std::move(conn));
+                spdlog::debug("💾 게임 결과 배치 저장 완료: {}행 -> {}명", rows.size(), userIds.size());
+                return true;
+
+            }
+            catch (const std::exception& e) {
+                txn.abort();
+                dbPool_->returnConnection(std::move(conn));
+                spdlog::error("saveGameResultsBatch 오류: {}", e.what());
+                return false;
+            }
+        }
+
         // ========================================
         // 기타 필수 함수들 (간단 구현)
         // ========================================
 
         bool DatabaseManager::setUserActive(uint32_t userId, bool active) {
+            TraceSpan span("DatabaseManager::setUserActive");
             if (!isInitialized_) return false;
 
             auto conn = dbPool_->getConnection();
@@ -706,7 +1043,7 @@ namespace Blokus {
         // 경험치 및 레벨 시스템
         // ========================================
         
-        int DatabaseManager::getRequiredExpForLevel(int level) const {
+        int DatabaseManager::getRequiredExpForLevel(int level) {
             if (level <= 10) return level * 100;           // 1~10레벨: 선형 (100, 200, 300...)
             if (level <= 30) return 1000 + (level-10) * 150; // 11~30레벨: 중간 증가 (1150, 1300, 1450...)
             return 4000 + (level-30) * 200;                // 31+레벨: 큰 증가 (4200, 4400, 4600...)
@@ -725,6 +1062,7 @@ namespace Blokus {
         }
         
         bool DatabaseManager::updatePlayerExperience(uint32_t userId, int expGained) {
+            TraceSpan span("DatabaseManager::updatePlayerExperience");
             if (!isInitialized_ || expGained <= 0) return false;
 
             auto conn = dbPool_->getConnection();
@@ -777,6 +1115,7 @@ namespace Blokus {
         }
         
         bool DatabaseManager::checkAndProcessLevelUp(uint32_t userId) {
+            TraceSpan span("DatabaseManager::checkAndProcessLevelUp");
             if (!isInitialized_) return false;
 
             auto conn = dbPool_->getConnection();
@@ -853,6 +1192,7 @@ namespace Blokus {
         // ========================================
 
         std::optional<UserSettings> DatabaseManager::getUserSettings(const std::string& userId) {
+            TraceSpan span("DatabaseManager::getUserSettings");
             auto conn = dbPool_->getConnection();
             if (!conn) {
                 spdlog::error("Failed to get database connection for getUserSettings");
@@ -866,11 +1206,7 @@ namespace Blokus {
                 pqxx::work txn(*conn);
                 
                 // 사용자 설정 조회
-                auto result = txn.exec_params(
-                    "SELECT theme, language, game_invite_notifications, "
-                    "friend_online_notifications, system_notifications, "
-                    "bgm_mute, bgm_volume, effect_mute, effect_volume "
-                    "FROM user_settings WHERE user_id = $1",
+                auto result = txn.exec_prepared(kStmtSelectUserSettings,
                     userIdInt
                 );
 
@@ -889,6 +1225,7 @@ namespace Blokus {
                         defaults.effectMute, defaults.effectVolume
                     );
                     txn.commit();
+                    dbPool_->returnConnection(std::move(conn));
                     
                     spdlog::debug("Created default settings for user {}", userId);
                     return defaults;
@@ -920,6 +1257,7 @@ namespace Blokus {
         }
 
         bool DatabaseManager::updateUserSettings(const std::string& userId, const UserSettings& settings) {
+            TraceSpan span("DatabaseManager::updateUserSettings");
             if (!settings.isValid()) {
                 spdlog::error("Invalid settings provided for user {}", userId);
                 return false;
@@ -938,19 +1276,7 @@ namespace Blokus {
                 pqxx::work txn(*conn);
                 
                 // UPSERT (INSERT ... ON CONFLICT UPDATE)
-                txn.exec_params(
-                    "INSERT INTO user_settings (user_id, theme, language, "
-                    "game_invite_notifications, friend_online_notifications, "
-                    "system_notifications, bgm_mute, bgm_volume, effect_mute, effect_volume) "
-                    "VALUES ($1, $2, $3, $4, $5, $6, $7, $8, $9, $10) "
-                    "ON CONFLICT (user_id) DO UPDATE SET "
-                    "theme = EXCLUDED.theme, language = EXCLUDED.language, "
-                    "game_invite_notifications = EXCLUDED.game_invite_notifications, "
-                    "friend_online_notifications = EXCLUDED.friend_online_notifications, "
-                    "system_notifications = EXCLUDED.system_notifications, "
-                    "bgm_mute = EXCLUDED.bgm_mute, bgm_volume = EXCLUDED.bgm_volume, "
-                    "effect_mute = EXCLUDED.effect_mute, effect_volume = EXCLUDED.effect_volume, "
-                    "updated_at = CURRENT_TIMESTAMP",
+                txn.exec_prepared(kStmtUpsertUserSettings,
                     userIdInt, settings.theme, settings.language,
                     settings.gameInviteNotifications, settings.friendOnlineNotifications,
                     settings.systemNotifications, settings.bgmMute, settings.bgmVolume,
@@ -970,6 +1296,7 @@ namespace Blokus {
         }
 
         bool DatabaseManager::deleteUserSettings(const std::string& userId) {
+            TraceSpan span("DatabaseManager::deleteUserSettings");
             auto conn = dbPool_->getConnection();
             if (!conn) {
                 spdlog::error("Failed to get database connection for deleteUserSettings");
@@ -0,0 +1,111 @@
+#include "FrameCompressor.h"
+#include "ConfigManager.h"
+#include <spdlog/spdlog.h>
+
+namespace Blokus {
+    namespace Server {
+
+        namespace {
+            // 공유 사전 (deflate-d1): 큰 응답에 반복되는 메시지 접두사와 JSON 키
+            // zlib 권장대로 자주 나오는 문자열일수록 뒤쪽에 둠. 한 글자라도 바꾸면 CODEC 이름도 올릴 것
+            constexpr std::string_view kDictionaryD1 =
+                "GAME_RESULT:{\"scores\":{\"winners\":[\"myRank\":\"myScore\":\"expGained\":\"levelUp\":false,"
+                "\"newLevel\":\"gameTime\":\"gameType\":\"roomId\":\"timestamp\":\""
+                "MY_STATS_UPDATE:{USER_STATS_RESPONSE:{\"username\":\"\",\"displayName\":\"\",\"level\":"
+                ",\"totalGames\":,\"wins\":,\"losses\":,\"draws\":,\"currentExp\":,\"requiredExp\":"
+                ",\"winRate\":,\"averageScore\":,\"totalScore\":,\"bestScore\":,\"status\":\""
+                "ROOM_INFO:GAME_STATE_UPDATE:{\"players\":[{\"userId\":\"isHost\":true,\"isReady\":"
+                "\"color\":\"score\":\"remainingBlocks\":\"turnOrder\":\"turnIndex\":\"turnNumber\":"
+                "ROOM_LIST_DELTA:ROOM_LIST:LOBBY_USER_LIST::0:1:2:3:4:false:true:";
+
+            void appendBase64(std::string& out, const unsigned char* data, size_t size) {
+                static const char kAlphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+                size_t i = 0;
+                for (; i + 2 < size; i += 3) {
+                    uint32_t chunk = (data[i] << 16) | (data[i + 1] << 8) | data[i + 2];
+                    out.push_back(kAlphabet[(chunk >> 18) & 0x3F]);
+                    out.push_back(kAlphabet[(chunk >> 12) & 0x3F]);
+                    out.push_back(kAlphabet[(chunk >> 6) & 0x3F]);
+                    out.push_back(kAlphabet[chunk & 0x3F]);
+                }
+                if (i < size) {
+                    uint32_t chunk = data[i] << 16;
+                    if (i + 1 < size) {
+                        chunk |= data[i + 1] << 8;
+                    }
+                    out.push_back(kAlphabet[(chunk >> 18) & 0x3F]);
+                    out.push_back(kAlphabet[(chunk >> 12) & 0x3F]);
+                    out.push_back(i + 1 < size ? kAlphabet[(chunk >> 6) & 0x3F] : '=');
+                    out.push_back('=');
+                }
+            }
+        }
+
+        FrameCompressor::FrameCompressor(int level) {
+            // windowBits 음수 = raw deflate (zlib 헤더/체크섬 없음)
+            m_ready = deflateInit2(&m_stream, level, Z_DEFLATED, -15, 8, Z_DEFAULT_STRATEGY) == Z_OK;
+            if (!m_ready) {
+                spdlog::error("프레임 압축 컨텍스트 초기화 실패 (level {})", level);
+            }
+        }
+
+        FrameCompressor::~FrameCompressor() {
+            if (m_ready) {
+                deflateEnd(&m_stream);
+            }
+        }
+
+        std::string_view FrameCompressor::dictionary() {
+            return kDictionaryD1;
+        }
+
+        FrameCompressor& FrameCompressor::forThisThread() {
+            thread_local FrameCompressor compressor(ConfigManager::compressionLevel);
+            return compressor;
+        }
+
+        SharedFrame FrameCompressor::compress(const SharedFrame& frame) {
+            if (!m_ready || !frame || frame->size() < 2) {
+                return nullptr;
+            }
+
+            if (m_lastSource.lock() == frame) {
+                return m_lastResult;
+            }
+
+            // 마지막 줄바꿈은 압축 대상에서 제외 (받는 쪽이 줄 단위로 자른 뒤 inflate)
+            // 중간 줄바꿈(묶음 프레임)은 그대로 압축 -> inflate 결과를 다시 줄 단위로 처리
+            const size_t payloadSize = frame->size() - 1;
+
+            // 프레임마다 독립: 리셋 후 사전을 다시 설정 (컨텍스트 메모리는 재사용)
+            deflateReset(&m_stream);
+            deflateSetDictionary(&m_stream, reinterpret_cast<const Bytef*>(kDictionaryD1.data()),
+                static_cast<uInt>(kDictionaryD1.size()));
+
+            m_deflated.resize(deflateBound(&m_stream, static_cast<uLong>(payloadSize)));
+            m_stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(frame->data()));
+            m_stream.avail_in = static_cast<uInt>(payloadSize);
+            m_stream.next_out = reinterpret_cast<Bytef*>(m_deflated.data());
+            m_stream.avail_out = static_cast<uInt>(m_deflated.size());
+
+            SharedFrame result;
+            if (deflate(&m_stream, Z_FINISH) == Z_STREAM_END) {
+                size_t deflatedSize = m_deflated.size() - m_stream.avail_out;
+                size_t encodedSize = PREFIX.size() + (deflatedSize + 2) / 3 * 4 + 1;
+                if (encodedSize < frame->size()) {
+                    auto encoded = std::make_shared<std::string>();
+                    encoded->reserve(encodedSize);
+                    encoded->append(PREFIX);
+                    appendBase64(*encoded, reinterpret_cast<const unsigned char*>(m_deflated.data()), deflatedSize);
+                    encoded->push_back('\n');
+                    result = std::move(encoded);
+                }
+            }
+
+            m_lastSource = frame;
+            m_lastResult = result;
+            return result;
+        }
+
+    } // namespace Server
+} // namespace Blokus
@@ -0,0 +1,496 @@
+#include "GameResultPersister.h"
+#include "ConfigManager.h"
+#include "Session.h"
+#include "UserStatsCache.h"
+#include <spdlog/spdlog.h>
+#include <algorithm>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <random>
+#include <sstream>
+#include <unordered_map>
+
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace Blokus {
+    namespace Server {
+
+        // ========================================
+        // 생성자/소멸자
+        // ========================================
+
+        GameResultPersister::GameResultPersister(std::shared_ptr<DatabaseManager> dbManager)
+            : m_dbManager(dbManager)
+            , m_batchSize(static_cast<size_t>(std::max(1, ConfigManager::gameResultBatchSize)))
+            , m_flushInterval(std::max(10, ConfigManager::gameResultFlushIntervalMs))
+            , m_maxRetries(std::max(1, ConfigManager::gameResultMaxRetries))
+            , m_spillPath(ConfigManager::gameResultSpillFile)
+            , m_instanceId((static_cast<uint64_t>(std::random_device{}()) << 32) ^
+                static_cast<uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count()))
+        {
+        }
+
+        GameResultPersister::~GameResultPersister() {
+            shutdown();
+        }
+
+        bool GameResultPersister::initialize() {
+            if (m_isInitialized) {
+                return true;
+            }
+
+            // 이전 실행에서 DB에 반영하지 못한 결과 복구
+            size_t recovered = recoverSpilledResults();
+            if (recovered > 0) {
+                spdlog::warn("💾 미저장 게임 결과 {}건 복구 - 저장 큐에 재등록", recovered);
+            }
+
+            m_shouldStop = false;
+            m_workerThread = std::make_unique<std::thread>(&GameResultPersister::workerLoop, this);
+            m_isInitialized = true;
+
+            spdlog::info("게임 결과 저장 큐 초기화 완료 (배치: {}, 주기: {}ms, 재시도: {}회, 스필: {})",
+                m_batchSize, m_flushInterval.count(), m_maxRetries, m_spillPath);
+            return true;
+        }
+
+        void GameResultPersister::shutdown() {
+            if (!m_isInitialized) {
+                return;
+            }
+
+            spdlog::info("게임 결과 저장 큐 종료 중... (대기: {}건)", getPendingCount());
+
+            // 워커가 남은 결과를 마지막으로 저장 시도하고, 실패분은 디스크에 기록
+            m_shouldStop = true;
+            m_queueCv.notify_all();
+            if (m_workerThread && m_workerThread->joinable()) {
+                m_workerThread->join();
+            }
+            m_workerThread.reset();
+            m_isInitialized = false;
+
+            spdlog::info("게임 결과 저장 큐 종료 완료");
+        }
+
+        // ========================================
+        // 결과 등록
+        // ========================================
+
+        void GameResultPersister::enqueue(PendingGameResult result) {
+            if (result.rows.empty()) {
+                return;
+            }
+
+            // 캐시에 먼저 반영하고 접속 중인 세션도 바로 갱신 (DB 반영은 워커가 나중에 합산 처리)
+            if (m_statsCache) {
+                result.countedInCache.assign(result.rows.size(), false);
+                for (size_t i = 0; i < result.rows.size(); ++i) {
+                    auto session = i < result.sessions.size() ? result.sessions[i].lock() : nullptr;
+                    if (session && session->getUserAccount().has_value() &&
+                        session->getUserAccount()->userId == result.rows[i].userId) {
+                        // 캐시에서 축출된 사용자는 세션이 가진 값으로 다시 등록
+                        if (!m_statsCache->get(result.rows[i].userId).has_value()) {
+                            m_statsCache->put(session->getUserAccount().value());
+                        }
+                    }
+
+                    auto updated = m_statsCache->applyGameResult(result.rows[i]);
+                    result.countedInCache[i] = updated.has_value();
+                    if (updated.has_value() && session && session->isActive()) {
+                        session->updateUserAccount(updated.value());
+                    }
+                }
+                result.appliedToCache = true;
+            }
+
+            size_t pending = 0;
+            {
+                std::lock_guard<std::mutex> lock(m_queueMutex);
+                m_queue.push_back(std::move(result));
+                pending = m_queue.size();
+            }
+
+            if (pending >= m_batchSize) {
+                m_queueCv.notify_one();
+            }
+        }
+
+        void GameResultPersister::requestFlush() {
+            {
+                std::lock_guard<std::mutex> lock(m_queueMutex);
+                if (m_queue.empty()) {
+                    return;
+                }
+                m_flushRequested = true;
+            }
+            m_queueCv.notify_one();
+        }
+
+        size_t GameResultPersister::getPendingCount() const {
+            std::lock_guard<std::mutex> lock(m_queueMutex);
+            return m_queue.size();
+        }
+
+        // ========================================
+        // 워커
+        // ========================================
+
+        void GameResultPersister::workerLoop() {
+            spdlog::info("게임 결과 저장 워커 시작");
+
+            int consecutiveFailures = 0;
+            auto lastRecoveryAttempt = std::chrono::steady_clock::now();
+            const auto recoveryProbeInterval = std::chrono::seconds(60);
+
+            while (true) {
+                std::vector<PendingGameResult> batch;
+                bool stopping = false;
+
+                {
+                    std::unique_lock<std::mutex> lock(m_queueMutex);
+                    m_queueCv.wait_for(lock, m_flushInterval, [this] {
+                        return m_shouldStop.load() || m_flushRequested || m_queue.size() >= m_batchSize;
+                    });
+                    m_flushRequested = false;
+
+                    stopping = m_shouldStop.load();
+                    if (m_queue.empty() && stopping) {
+                        break;
+                    }
+
+                    size_t count = std::min(m_batchSize, m_queue.size());
+                    batch.assign(std::make_move_iterator(m_queue.begin()),
+                        std::make_move_iterator(m_queue.begin() + count));
+                    m_queue.erase(m_queue.begin(), m_queue.begin() + count);
+                }
+
+                if (batch.empty()) {
+                    // 유휴 상태: DB가 정상이거나 일정 시간이 지났으면 스필된 결과 재등록
+                    auto now = std::chrono::steady_clock::now();
+                    if (m_hasSpilledResults &&
+                        (consecutiveFailures == 0 || now - lastRecoveryAttempt >= recoveryProbeInterval)) {
+                        lastRecoveryAttempt = now;
+                        recoverSpilledResults();
+                    }
+                    continue;
+                }
+
+                if (flushBatch(batch)) {
+                    consecutiveFailures = 0;
+                    syncSessions(batch);
+                    continue;
+                }
+
+                ++consecutiveFailures;
+
+                // 재시도 한도를 넘었거나 종료 중이면 디스크에 기록, 나머지는 순서를 유지한 채 큐 앞으로 복귀
+                std::vector<PendingGameResult> retry;
+                std::vector<PendingGameResult> spill;
+                for (auto& result : batch) {
+                    if (stopping || ++result.attempts >= m_maxRetries) {
+                        spill.push_back(std::move(result));
+                    }
+                    else {
+                        retry.push_back(std::move(result));
+                    }
+                }
+
+                if (stopping) {
+                    // 종료 중 DB 장애: 남은 결과를 더 시도하지 않고 전부 기록
+                    std::lock_guard<std::mutex> lock(m_queueMutex);
+                    spill.insert(spill.end(), std::make_move_iterator(m_queue.begin()),
+                        std::make_move_iterator(m_queue.end()));
+                    m_queue.clear();
+                }
+
+                if (!spill.empty()) {
+                    spillToDisk(spill);
+                }
+
+                if (!retry.empty()) {
+                    std::lock_guard<std::mutex> lock(m_queueMutex);
+                    m_queue.insert(m_queue.begin(), std::make_move_iterator(retry.begin()),
+                        std::make_move_iterator(retry.end()));
+                }
+
+                // 지수 백오프 (최대 30초, 종료 요청 시 즉시 깨어남)
+                auto backoff = std::min(std::chrono::milliseconds(30000),
+                    std::chrono::milliseconds(500) * (1 << std::min(consecutiveFailures, 6)));
+                spdlog::warn("💾 게임 결과 저장 실패 ({}회 연속) - {}ms 후 재시도 (재시도 대기: {}건, 스필: {}건)",
+                    consecutiveFailures, backoff.count(), retry.size(), spill.size());
+
+                std::unique_lock<std::mutex> lock(m_queueMutex);
+                m_queueCv.wait_for(lock, backoff, [this] { return m_shouldStop.load(); });
+            }
+
+            spdlog::info("게임 결과 저장 워커 종료");
+        }
+
+        bool GameResultPersister::flushBatch(const std::vector<PendingGameResult>& batch) {
+            if (!m_dbManager) {
+                return false;
+            }
+
+            std::vector<GameResultRow> rows;
+            for (const auto& result : batch) {
+                rows.insert(rows.end(), result.rows.begin(), result.rows.end());
+            }
+
+            try {
+                auto start = std::chrono::steady_clock::now();
+                bool success = m_dbManager->saveGameResultsBatch(rows);
+                auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+                    std::chrono::steady_clock::now() - start).count();
+
+                if (success) {
+                    spdlog::debug("[DB_DEBUG] 게임 결과 {}판 ({}행) 배치 저장 완료 ({}ms)",
+                        batch.size(), rows.size(), elapsed);
+                }
+                return success;
+            }
+            catch (const std::exception& e) {
+                // 커넥션 풀 타임아웃 등 DatabaseManager 밖으로 전파되는 예외
+                spdlog::error("[DB_DEBUG] 게임 결과 배치 저장 중 예외: {}", e.what());
+                return false;
+            }
+        }
+
+        void GameResultPersister::syncSessions(const std::vector<PendingGameResult>& batch) {
+            // 아직 접속 중인 플레이어만 모아 한 번의 조회로 세션 계정 정보 갱신
+            std::unordered_map<uint32_t, std::vector<std::shared_ptr<Session>>> sessionsByUser;
+            std::vector<uint32_t> userIds;
+
+            for (const auto& result : batch) {
+                // 캐시에 반영된 결과는 세션도 등록 시점에 갱신됨 - 카운트를 올린 행만 dirty 표시 해제
+                if (result.appliedToCache && m_statsCache) {
+                    std::vector<GameResultRow> counted;
+                    for (size_t i = 0; i < result.rows.size() && i < result.countedInCache.size(); ++i) {
+                        if (result.countedInCache[i]) {
+                            counted.push_back(result.rows[i]);
+                        }
+                    }
+                    if (!counted.empty()) {
+                        m_statsCache->markFlushed(counted);
+                    }
+                    continue;
+                }
+
+                // 캐시를 거치지 않은 결과 (이전 실행의 스필분): 캐시에 남은 옛 통계도 DB 값으로 갱신
+                for (size_t i = 0; i < result.rows.size(); ++i) {
+                    auto session = i < result.sessions.size() ? result.sessions[i].lock() : nullptr;
+                    bool hasSession = session && session->isActive();
+                    bool isCached = m_statsCache && m_statsCache->get(result.rows[i].userId).has_value();
+                    if (!hasSession && !isCached) continue;
+
+                    auto inserted = sessionsByUser.try_emplace(result.rows[i].userId);
+                    if (inserted.second) {
+                        userIds.push_back(result.rows[i].userId);
+                    }
+                    if (hasSession) {
+                        inserted.first->second.push_back(session);
+                    }
+                }
+            }
+
+            if (userIds.empty()) {
+                return;
+            }
+
+            try {
+                auto accounts = m_dbManager->getUsersByIds(userIds);
+                for (auto account : accounts) {
+                    auto it = sessionsByUser.find(account.userId);
+                    if (it == sessionsByUser.end()) continue;
+
+                    if (m_statsCache && m_statsCache->get(account.userId).has_value()) {
+                        account = m_statsCache->put(account);
+                    }
+
+                    for (const auto& session : it->second) {
+                        session->updateUserAccount(account);
+                    }
+                    spdlog::debug("게임 결과 후 세션 동기화: {} (레벨: {}, 승:{} 패:{})",
+                        account.username, account.level, account.wins, account.losses);
+                }
+            }
+            catch (const std::exception& e) {
+                spdlog::error("게임 결과 후 세션 동기화 실패: {}", e.what());
+            }
+        }
+
+        // ========================================
+        // 디스크 스필
+        // ========================================
+
+        void GameResultPersister::spillToDisk(const std::vector<PendingGameResult>& batch) {
+            std::lock_guard<std::mutex> lock(m_spillMutex);
+
+            try {
+                std::filesystem::path path(m_spillPath);
+                if (path.has_parent_path()) {
+                    std::filesystem::create_directories(path.parent_path());
+                }
+            }
+            catch (const std::exception& e) {
+                spdlog::error("스필 디렉토리 생성 실패 ({}): {}", m_spillPath, e.what());
+            }
+
+            FILE* file = std::fopen(m_spillPath.c_str(), "a");
+            if (!file) {
+                for (const auto& result : batch) {
+                    spdlog::critical("💾 게임 결과 유실 (스필 파일 열기 실패): {}", serializeResult(result));
+                }
+                return;
+            }
+
+            for (const auto& result : batch) {
+                std::string line = serializeResult(result) + "\n";
+                std::fwrite(line.data(), 1, line.size(), file);
+            }
+
+            // 프로세스가 바로 죽더라도 기록이 남도록 디스크까지 동기화
+            std::fflush(file);
+#ifdef _WIN32
+            _commit(_fileno(file));
+#else
+            fsync(fileno(file));
+#endif
+            std::fclose(file);
+
+            m_hasSpilledResults = true;
+            m_spilledCount += batch.size();
+            spdlog::error("💾 게임 결과 {}판을 디스크에 기록: {}", batch.size(), m_spillPath);
+        }
+
+        size_t GameResultPersister::recoverSpilledResults() {
+            std::vector<PendingGameResult> recovered;
+
+            {
+                std::lock_guard<std::mutex> lock(m_spillMutex);
+
+                std::ifstream file(m_spillPath);
+                if (!file.is_open()) {
+                    m_hasSpilledResults = false;
+                    return 0;
+                }
+
+                std::string line;
+                while (std::getline(file, line)) {
+                    if (line.empty()) continue;
+
+                    auto result = deserializeResult(line);
+                    if (result.has_value()) {
+                        recovered.push_back(std::move(result.value()));
+                    }
+                    else {
+                        spdlog::error("스필 파일의 잘못된 게임 결과 무시: {}", line);
+                    }
+                }
+                file.close();
+
+                // 큐로 옮긴 뒤 실패하면 다시 스필되므로 파일은 비움
+                std::error_code ec;
+                std::filesystem::remove(m_spillPath, ec);
+                m_hasSpilledResults = false;
+            }
+
+            if (recovered.empty()) {
+                return 0;
+            }
+
+            size_t count = recovered.size();
+            {
+                std::lock_guard<std::mutex> lock(m_queueMutex);
+                for (auto& result : recovered) {
+                    m_queue.push_back(std::move(result));
+                }
+            }
+            m_queueCv.notify_one();
+
+            spdlog::info("💾 스필된 게임 결과 {}건 저장 큐에 재등록", count);
+            return count;
+        }
+
+        // 형식: 방ID|유저ID,점수,승리(0/1),경험치;유저ID,점수,승리,경험치;...|인스턴스ID,행별 캐시 카운트(0/1...)
+        // 마지막 구간은 캐시에 반영된 결과만 기록 (같은 프로세스에서 복구할 때만 사용, 없으면 반영 안 된 결과)
+        std::string GameResultPersister::serializeResult(const PendingGameResult& result) const {
+            std::ostringstream line;
+            line << result.roomId << "|";
+            for (size_t i = 0; i < result.rows.size(); ++i) {
+                const auto& row = result.rows[i];
+                if (i > 0) line << ";";
+                line << row.userId << "," << row.score << "," << (row.won ? 1 : 0) << "," << row.expGained;
+            }
+            if (result.appliedToCache) {
+                line << "|" << m_instanceId << ",";
+                for (size_t i = 0; i < result.rows.size(); ++i) {
+                    line << (i < result.countedInCache.size() && result.countedInCache[i] ? '1' : '0');
+                }
+            }
+            return line.str();
+        }
+
+        std::optional<PendingGameResult> GameResultPersister::deserializeResult(const std::string& line) const {
+            try {
+                size_t sep = line.find('|');
+                if (sep == std::string::npos) {
+                    return std::nullopt;
+                }
+
+                PendingGameResult result;
+                result.roomId = std::stoi(line.substr(0, sep));
+
+                size_t cacheSep = line.find('|', sep + 1);
+                std::string rowsText = line.substr(sep + 1, cacheSep == std::string::npos ? std::string::npos : cacheSep - sep - 1);
+
+                std::stringstream rowsStream(rowsText);
+                std::string rowText;
+                while (std::getline(rowsStream, rowText, ';')) {
+                    std::stringstream fields(rowText);
+                    std::string userId, score, won, exp;
+                    if (!std::getline(fields, userId, ',') || !std::getline(fields, score, ',') ||
+                        !std::getline(fields, won, ',') || !std::getline(fields, exp, ',')) {
+                        return std::nullopt;
+                    }
+
+                    GameResultRow row;
+                    row.userId = static_cast<uint32_t>(std::stoul(userId));
+                    row.score = std::stoi(score);
+                    row.won = (won == "1");
+                    row.expGained = std::stoi(exp);
+                    result.rows.push_back(row);
+                }
+
+                if (result.rows.empty()) {
+                    return std::nullopt;
+                }
+
+                // 이 프로세스의 캐시에 반영했던 결과만 반영 정보 복원 (재시작 후의 캐시는 이 결과를 모름)
+                if (cacheSep != std::string::npos) {
+                    std::string cacheText = line.substr(cacheSep + 1);
+                    size_t comma = cacheText.find(',');
+                    if (comma != std::string::npos &&
+                        std::stoull(cacheText.substr(0, comma)) == m_instanceId &&
+                        cacheText.size() - comma - 1 == result.rows.size()) {
+                        result.appliedToCache = true;
+                        for (size_t i = comma + 1; i < cacheText.size(); ++i) {
+                            result.countedInCache.push_back(cacheText[i] == '1');
+                        }
+                    }
+                }
+                return result;
+            }
+            catch (const std::exception&) {
+                return std::nullopt;
+            }
+        }
+
+    } // namespace Server
+} // namespace Blokus
@@ -4,6 +4,11 @@
 #include "Block.h"       // BlockFactory를 위해 추가
 #include "RoomManager.h" // RoomManager 헤더 추가
 #include "DatabaseManager.h" // DB 저장을 위해 추가
+#include "GameResultPersister.h" // 게임 결과 비동기 저장
+#include "ServerMetrics.h"
+#include "Tracing.h"
+#include "Logging.h"
+#include "ConfigManager.h"
 #include <spdlog/spdlog.h>
 #include <algorithm>
 #include <sstream>
@@ -29,6 +34,7 @@ namespace Blokus {
             , m_isPrivate(false)
             , m_password("")
             , m_maxPlayers(Common::MAX_PLAYERS)
+            , m_allowSpectators(Common::GameSettings().allowSpectators)
             , m_hasCompletedGame(false)
             , m_roomManager(roomManager)
             , m_turnTimeoutSeconds(Common::DEFAULT_TURN_TIME)  // 기본 30초 타임아웃
@@ -37,6 +43,17 @@ namespace Blokus {
             , m_stopTimeoutCheck(false)
         {
             m_players.reserve(Common::MAX_PLAYERS);
+            m_eventLogCapacity = ConfigManager::resumeEnabled
+                ? static_cast<size_t>(std::max(0, ConfigManager::resumeReplayEvents)) : 0;
+
+            // 관전 채널 생성 (팬아웃은 RoomManager의 관전 전용 스레드 풀에서 처리)
+            if (m_roomManager) {
+                m_spectators = m_roomManager->createSpectatorChannel(m_roomId);
+                if (m_spectators) {
+                    std::lock_guard<std::mutex> lock(m_playersMutex);
+                    publishSpectatorSnapshotLocked();
+                }
+            }
             
             // 타임아웃 누적 차단 시스템 초기화 (생성자에서)
             spdlog::debug("[TIMEOUT_INIT] 타임아웃 시스템 초기화 (방 {})", m_roomId);
@@ -49,8 +66,11 @@ namespace Blokus {
             cleanupTimeoutThread();
             cleanupAfkStates();
             
-            // 모든 플레이어에게 방 해체 알림
-            broadcastMessage("ROOM_DISBANDED");
+            // 모든 플레이어에게 방 해체 알림 (다음 프로세스로 이전한 방은 계속 진행되므로 제외)
+            if (!m_migratedOut) {
+                broadcastMessage("ROOM_DISBANDED");
+            }
+            closeSpectators();
             spdlog::debug("방 소멸: ID={}, Name='{}'", m_roomId, m_roomName);
         }
 
@@ -84,6 +104,8 @@ namespace Blokus {
 
             // 4. 새 PlayerInfo 객체 생성
             PlayerInfo newPlayer(session);
+            session->setDeliveredRoomSeq(m_eventSeq);  // 재개 시 입장 이전 이벤트는 재전송하지 않음
+
             // 호스트 설정 (첫 번째 플레이어가 호스트)
             if (m_players.empty() || userId == m_hostId) {
                 newPlayer.setHost(true);
@@ -128,34 +150,19 @@ namespace Blokus {
             if (wasInGame) {
                 spdlog::debug("게임 중 플레이어 이탈: {} - 즉시 패배 처리", username);
 
-                // DB에 패배 기록 저장
-                if (m_roomManager && m_roomManager->getDatabaseManager()) {
-                    auto dbManager = m_roomManager->getDatabaseManager();
+                // 저장 큐에 패배 기록 등록 (DB 왕복을 기다리지 않음)
+                auto persister = m_roomManager ? m_roomManager->getGameResultPersister() : nullptr;
+                if (persister) {
                     try {
-                        uint32_t playerId = std::stoul(userId);
-
-                        // 이탈자는 무조건 패배로 처리 (승리=false, 점수=0)
-                        std::vector<uint32_t> dropoutPlayerIds = {playerId};
-                        std::vector<int> dropoutScores = {0}; // 이탈자는 0점
-                        std::vector<bool> dropoutIsWinner = {false}; // 무조건 패배
-                        bool isDraw = false;
-
-                        bool dbSuccess = dbManager->saveGameResults(dropoutPlayerIds, dropoutScores, dropoutIsWinner, isDraw);
-                        if (dbSuccess) {
-                            spdlog::debug("이탈자 {} 패배 기록 DB 저장 완료", username);
-
-                            // 세션이 있으면 즉시 동기화
-                            if (dropoutSession) {
-                                auto updatedAccount = dbManager->getUserById(playerId);
-                                if (updatedAccount.has_value()) {
-                                    dropoutSession->updateUserAccount(updatedAccount.value());
-                                    spdlog::debug("이탈자 {} 세션 동기화 완료 (승:{} 패:{} 무:{})",
-                                               username, updatedAccount->wins, updatedAccount->losses, updatedAccount->draws);
-                                }
-                            }
-                        } else {
-                            spdlog::error("이탈자 {} 패배 기록 DB 저장 실패", username);
-                        }
+                        PendingGameResult dropout;
+                        dropout.roomId = m_roomId;
+
+                        // 이탈자는 무조건 패배로 처리 (승리=false, 점수=0, 경험치 없음)
+                        dropout.rows.push_back({ static_cast<uint32_t>(std::stoul(userId)), 0, false, 0 });
+                        dropout.sessions.push_back(dropoutSession);
+                        persister->enqueue(std::move(dropout));
+
+                        spdlog::debug("이탈자 {} 패배 기록 저장 큐 등록", username);
                     } catch (const std::exception& e) {
                         spdlog::error("이탈자 {} 처리 중 오류: {}", username, e.what());
                     }
@@ -492,6 +499,8 @@ namespace Blokus {
 
             // 게임 로직 초기화
             m_gameLogic->clearBoard();
+            m_boardSync.reset();
+            m_placementHistory.clear();
             // 게임 시작 시에는 색깔 재배정하지 않음 (기존 색깔 유지)
 
             // 턴 순서 설정 (색깔 고정 순서: 파란색 → 노란색 → 빨간색 → 초록색)
@@ -543,6 +552,7 @@ namespace Blokus {
 
             // 게임 시작 브로드캐스트 (뮤텍스 내에서 안전하게)
             broadcastMessageLocked("GAME_STARTED");
+            ServerMetrics::instance().gamesStarted.add();
             
             std::ostringstream startMsg;
             startMsg << "게임이 시작되었습니다. 현재 인원 : " << m_players.size() << "명";
@@ -568,7 +578,10 @@ namespace Blokus {
                 gameStateJson << "\"turnNumber\":" << m_gameStateManager->getTurnNumber() << ",";
                 
                 // 초기 점수 (모든 플레이어 0점)
-                gameStateJson << "\"scores\":{}}";
+                gameStateJson << "\"scores\":{},";
+
+                // 빈 보드의 동기화 기준점
+                gameStateJson << "\"boardSeq\":0,\"boardHash\":\"0000000000000000\"}";
                 
                 broadcastMessageLocked(gameStateJson.str());
             }
@@ -658,6 +671,8 @@ namespace Blokus {
             std::lock_guard<std::mutex> lock(m_playersMutex);
 
             m_gameLogic->clearBoard();
+            m_boardSync.reset();
+            m_placementHistory.clear();
             m_gameStateManager->resetGame();
             m_state = RoomState::Waiting;
 
@@ -685,24 +700,393 @@ namespace Blokus {
 
         void GameRoom::broadcastMessageLocked(const std::string& message, const std::string& excludeUserId) {
             // 뮤텍스가 이미 잠겨있다고 가정하고 실행 (데드락 방지용)
-            spdlog::debug("브로드캐스트 시작: 방 {}, 메시지: '{}', 플레이어 수: {}", 
-                m_roomId, message.substr(0, 50) + (message.length() > 50 ? "..." : ""), m_players.size());
+            broadcastFrameLocked(makeFrame(message), excludeUserId);
+        }
+
+        void GameRoom::broadcastFrameLocked(const SharedFrame& frame, const std::string& excludeUserId) {
+            // 뮤텍스가 이미 잠겨있다고 가정하고 실행 (모든 수신자가 같은 버퍼를 공유)
+            SPDLOG_DEBUG("브로드캐스트 시작: 방 {}, 메시지: '{}', 플레이어 수: {}", 
+                m_roomId, frame->substr(0, 50) + (frame->length() > 51 ? "..." : ""), m_players.size());
+
+            // 방 이벤트 순번 부여 + 재개용 로그 보관 (연결이 끊긴 좌석은 재개 시 이 로그에서 재전송)
+            uint64_t seq = ++m_eventSeq;
+            if (m_eventLogCapacity > 0) {
+                m_eventLog.push_back(RoomEvent{ seq, frame, excludeUserId });
+                if (m_eventLog.size() > m_eventLogCapacity) {
+                    m_eventLog.pop_front();
+                }
+            }
 
             int sentCount = 0;
             for (const auto& player : m_players) {
                 if (player.getUserId() != excludeUserId && player.isConnected()) {
                     try {
-                        player.sendMessage(message);
+                        player.sendFrame(frame, seq);
                         sentCount++;
                     }
                     catch (const std::exception& e) {
-                        spdlog::error("방 {} 메시지 전송 실패 (플레이어: '{}'): {}",
+                        BLOKUS_LOG_RATE_LIMITED(spdlog::level::err, 1000, "방 {} 메시지 전송 실패 (플레이어: '{}'): {}",
                             m_roomId, player.getUsername(), e.what());
                     }
                 }
             }
+
+            // 관전 채널에는 로그 추가만 하고 실제 전송은 팬아웃 스레드에서 처리 (방 뮤텍스 보유 시간 최소화)
+            if (m_spectators && m_spectators->publish(frame)) {
+                publishSpectatorSnapshotLocked();
+            }
             
-            spdlog::debug("브로드캐스트 완료: {}/{} 플레이어에게 전송", sentCount, m_players.size());
+            SPDLOG_DEBUG("브로드캐스트 완료: {}/{} 플레이어에게 전송", sentCount, m_players.size());
+        }
+
+        // ========================================
+        // 관전
+        // ========================================
+
+        SpectatorChannelPtr GameRoom::getSpectatorChannel() const {
+            std::lock_guard<std::mutex> lock(m_playersMutex);
+            return m_spectators;
+        }
+
+        void GameRoom::closeSpectators() {
+            SpectatorChannelPtr channel;
+            {
+                std::lock_guard<std::mutex> lock(m_playersMutex);
+                channel.swap(m_spectators);
+            }
+            if (channel) {
+                channel->close();
+            }
+        }
+
+        void GameRoom::publishSpectatorSnapshotLocked() {
+            // 뮤텍스가 이미 잠겨있다고 가정하고 실행 (새 관전자 / 밀린 관전자가 이후 로그를 이어 받는 기준점)
+            writeRoomSnapshotLocked("SPECTATE_SNAPSHOT:{");
+            m_spectators->publishSnapshot(m_messageWriter.frame());
+        }
+
+        void GameRoom::writeRoomSnapshotLocked(std::string_view prefix) {
+            MessageWriter& writer = m_messageWriter;
+            writer.reset(prefix);
+            writer.key("roomId").number(m_roomId).raw(',');
+            writer.key("roomName").jsonString(m_roomName).raw(',');
+            writer.key("state").number(m_state).raw(',');
+            writer.key("currentPlayer").number(m_gameStateManager->getCurrentPlayer()).raw(',');
+            writer.key("turnNumber").number(m_gameStateManager->getTurnNumber()).raw(',');
+
+            writer.key("players").raw('[');
+            bool firstPlayer = true;
+            for (const auto& player : m_players) {
+                if (!firstPlayer) writer.raw(',');
+                writer.raw('{');
+                writer.key("username").jsonString(player.getUsername()).raw(',');
+                writer.key("displayName").jsonString(player.getDisplayName()).raw(',');
+                writer.key("color").number(player.getColor()).raw(',');
+                writer.key("score").number(player.getScore());
+                writer.raw('}');
+                firstPlayer = false;
+            }
+            writer.raw("],");
+
+            // 보드: 압축 스냅샷 (BoardSync 형식) + 이후 BLOCK_PLACED를 이어 붙일 기준 순번/해시
+            writer.key("boardSeq").number(m_boardSync.getSeq()).raw(',');
+            writer.key("boardHash").raw('"');
+            BoardSync::writeHash(writer, m_boardSync.getHash());
+            writer.raw("\",");
+            writer.key("board").raw('"');
+            BoardSync::writePackedBoard(writer, *m_gameLogic);
+            writer.raw("\"}");
+        }
+
+        void GameRoom::writeBoardSnapshotLocked() {
+            MessageWriter& writer = m_messageWriter;
+            writer.reset("BOARD_SNAPSHOT:{");
+            writer.key("roomId").number(m_roomId).raw(',');
+            writer.key("seq").number(m_boardSync.getSeq()).raw(',');
+            writer.key("hash").raw('"');
+            BoardSync::writeHash(writer, m_boardSync.getHash());
+            writer.raw("\",");
+            writer.key("board").raw('"');
+            BoardSync::writePackedBoard(writer, *m_gameLogic);
+            writer.raw("\"}");
+        }
+
+        // ========================================
+        // 보드 동기화
+        // ========================================
+
+        GameRoom::BoardSyncResult GameRoom::verifyBoardSync(SessionPtr session, uint64_t seq, uint64_t hash) {
+            std::lock_guard<std::mutex> lock(m_playersMutex);
+            if (m_state != RoomState::Playing) {
+                return BoardSyncResult::NotPlaying;
+            }
+
+            if (m_boardSync.matches(seq, hash)) {
+                session->sendMessage("BOARD_SYNC_OK:" + std::to_string(m_boardSync.getSeq()));
+                return BoardSyncResult::InSync;
+            }
+
+            // 서버 누적 해시 자체가 보드와 어긋난 경우는 버그이므로 따로 기록
+            if (BoardSync::computeHash(*m_gameLogic) != m_boardSync.getHash()) {
+                spdlog::error("방 {} 보드 해시 불일치 (서버 누적 해시 오류, 순번 {})", m_roomId, m_boardSync.getSeq());
+            }
+
+            ServerMetrics::instance().boardDesyncs.add();
+            BLOKUS_LOG_RATE_LIMITED(spdlog::level::info, 1000, "방 {} 보드 어긋남 감지: '{}' (클라이언트 순번 {}, 서버 순번 {}) -> 스냅샷 전송",
+                m_roomId, session->getUsername(), seq, m_boardSync.getSeq());
+
+            writeBoardSnapshotLocked();
+            session->sendFrame(m_messageWriter.frame());
+            ServerMetrics::instance().boardSnapshotsSent.add();
+            return BoardSyncResult::Resynced;
+        }
+
+        bool GameRoom::sendBoardSnapshot(SessionPtr session) {
+            std::lock_guard<std::mutex> lock(m_playersMutex);
+            if (m_state != RoomState::Playing) {
+                return false;
+            }
+
+            writeBoardSnapshotLocked();
+            session->sendFrame(m_messageWriter.frame());
+            ServerMetrics::instance().boardSnapshotsSent.add();
+            return true;
+        }
+
+        // ========================================
+        // 세션 재개
+        // ========================================
+
+        GameRoom::ResumeOutcome GameRoom::resumePlayer(const std::string& userId, SessionPtr session, size_t& replayedCount,
+            std::optional<uint64_t> clientSeq) {
+            std::lock_guard<std::mutex> lock(m_playersMutex);
+            replayedCount = 0;
+
+            auto* player = findPlayerById(m_players, userId);
+            if (!player) {
+                return ResumeOutcome::NotInRoom;
+            }
+
+            // 클라이언트가 마지막으로 받은 이벤트 이후가 놓친 구간
+            // (순번을 보내지 않은 클라이언트는 이전 연결이 소켓까지 보낸 순번으로 대신함 - 전송 중 끊긴 이벤트는 놓칠 수 있음)
+            auto previous = player->getSession();
+            uint64_t deliveredSeq = previous ? previous->getDeliveredRoomSeq() : m_eventSeq;
+            bool clientSeqValid = !clientSeq.has_value() || clientSeq.value() <= m_eventSeq;
+            if (clientSeq.has_value() && clientSeqValid) {
+                deliveredSeq = clientSeq.value();
+            }
+            player->setSession(session);
+            session->setDeliveredRoomSeq(deliveredSeq);
+
+            // 방 뮤텍스 안에서 전송하므로 이후 브로드캐스트보다 항상 먼저 도착
+            // (이전 프로세스에서 옮겨 온 좌석은 이 방의 이벤트를 받은 적이 없으므로 항상 전체 상태,
+            //  이 방이 발행한 적 없는 순번을 보낸 클라이언트, 이전 연결에서 순번이 뒤바뀐 적이 있는 경우도 전체 상태)
+            bool canReplay = previous && clientSeqValid && !previous->hasRoomSeqReordered() && (deliveredSeq >= m_eventSeq ||
+                (!m_eventLog.empty() && m_eventLog.front().seq <= deliveredSeq + 1));
+            if (canReplay) {
+                for (const auto& event : m_eventLog) {
+                    if (event.seq > deliveredSeq && event.excludeUserId != userId) {
+                        ++replayedCount;
+                    }
+                }
+
+                session->sendMessage("SESSION_RESUMED:" + std::to_string(m_roomId) + ":" + std::to_string(replayedCount));
+                for (const auto& event : m_eventLog) {
+                    if (event.seq > deliveredSeq && event.excludeUserId != userId) {
+                        session->sendFrame(event.frame, event.seq);
+                    }
+                }
+
+                spdlog::info("방 {} 세션 재개: '{}' (놓친 이벤트 {}개 재전송)", m_roomId, player->getUsername(), replayedCount);
+                return ResumeOutcome::Replayed;
+            }
+
+            session->sendMessage("SESSION_RESUMED:" + std::to_string(m_roomId) + ":-1");
+            writeRoomSnapshotLocked("ROOM_SNAPSHOT:{");
+            session->sendFrame(m_messageWriter.frame(), m_eventSeq);
+
+            spdlog::info("방 {} 세션 재개: '{}' (놓친 구간이 로그보다 길어 전체 상태 전송)", m_roomId, player->getUsername());
+            return ResumeOutcome::Resynced;
+        }
+
+        // ========================================
+        // 무중단 배포 (방 이전)
+        // ========================================
+
+        std::string GameRoom::exportMigrationSnapshot() {
+            std::lock_guard<std::mutex> lock(m_playersMutex);
+            if (m_state != RoomState::Playing || m_migratedOut) {
+                return "";
+            }
+
+            // 이 시점 이후의 배치/타임아웃은 받지 않음 (스레드는 다음 5초 주기에 스스로 종료)
+            m_migratedOut = true;
+            m_stopTimeoutCheck = true;
+
+            auto now = std::chrono::steady_clock::now();
+            auto elapsedMs = [&now](std::chrono::steady_clock::time_point since) {
+                return static_cast<long long>(std::chrono::duration_cast<std::chrono::milliseconds>(now - since).count());
+            };
+
+            nlohmann::json snapshot;
+            snapshot["v"] = 1;
+            snapshot["roomId"] = m_roomId;
+            snapshot["roomName"] = m_roomName;
+            snapshot["hostId"] = m_hostId;
+            snapshot["private"] = m_isPrivate;   // 비밀번호는 파일에 남기지 않음 (이전된 방은 게임 중이라 입장 검사가 없음)
+            snapshot["allowSpectators"] = m_allowSpectators;
+            snapshot["turnTimeout"] = m_turnTimeoutSeconds;
+            snapshot["gameElapsedMs"] = elapsedMs(m_gameStartTime);
+
+            // 턴 상태
+            nlohmann::json turnOrder = nlohmann::json::array();
+            for (auto color : m_gameStateManager->getTurnOrder()) {
+                turnOrder.push_back(static_cast<int>(color));
+            }
+            snapshot["turnOrder"] = std::move(turnOrder);
+            snapshot["turnIndex"] = m_gameStateManager->getCurrentPlayerIndex();
+            snapshot["turnNumber"] = m_gameStateManager->getTurnNumber();
+            snapshot["turnElapsedMs"] = m_turnTimerActive.exchange(false) ? elapsedMs(m_turnStartTime) : -1LL;
+            snapshot["lastTurnTimedOut"] = m_lastTurnTimedOut;
+
+            // 좌석 (연결 상태/활동 시각은 프로세스마다 다르므로 제외)
+            nlohmann::json players = nlohmann::json::array();
+            for (const auto& player : m_players) {
+                auto entry = player.toJson();
+                entry.erase("isConnected");
+                entry.erase("lastActivity");
+                players.push_back(std::move(entry));
+            }
+            snapshot["players"] = std::move(players);
+
+            // AFK 상태: [색상, 타임아웃 횟수, 차단 여부, 검증 사용 횟수]
+            nlohmann::json afk = nlohmann::json::array();
+            for (const auto& player : m_players) {
+                auto color = player.getColor();
+                auto timeouts = m_playerTimeoutCounts.find(color);
+                auto blocked = m_playerBlockedByTimeout.find(color);
+                auto verifications = m_playerAfkVerificationCounts.find(color);
+                afk.push_back({ static_cast<int>(color),
+                    timeouts != m_playerTimeoutCounts.end() ? timeouts->second : 0,
+                    blocked != m_playerBlockedByTimeout.end() && blocked->second,
+                    verifications != m_playerAfkVerificationCounts.end() ? verifications->second : 0 });
+            }
+            snapshot["afk"] = std::move(afk);
+
+            // 보드는 배치 기록으로 전달 (새 프로세스에서 같은 규칙으로 재실행 -> 사용 블록/첫 배치 상태까지 복원)
+            nlohmann::json moves = nlohmann::json::array();
+            for (const auto& placement : m_placementHistory) {
+                moves.push_back({ static_cast<int>(placement.type), placement.position.first, placement.position.second,
+                    static_cast<int>(placement.rotation), static_cast<int>(placement.flip), static_cast<int>(placement.player) });
+            }
+            snapshot["moves"] = std::move(moves);
+
+            spdlog::info("방 {} 이전 스냅샷 생성: 플레이어 {}명, 배치 {}개, 턴 {}",
+                m_roomId, m_players.size(), m_placementHistory.size(), m_gameStateManager->getTurnNumber());
+            return snapshot.dump();
+        }
+
+        std::shared_ptr<GameRoom> GameRoom::fromMigrationSnapshot(const std::string& snapshot, RoomManager* roomManager) {
+            auto json = nlohmann::json::parse(snapshot, nullptr, false);
+            if (json.is_discarded() || !json.is_object() || json.value("v", 0) != 1) {
+                spdlog::warn("방 이전 스냅샷 형식 오류 ({}바이트)", snapshot.size());
+                return nullptr;
+            }
+
+            try {
+                auto room = std::make_shared<GameRoom>(json.at("roomId").get<int>(),
+                    json.at("roomName").get<std::string>(), json.at("hostId").get<std::string>(), roomManager);
+
+                std::lock_guard<std::mutex> lock(room->m_playersMutex);
+                if (!room->restoreMigrationSnapshotLocked(json)) {
+                    return nullptr;
+                }
+                return room;
+            }
+            catch (const std::exception& e) {
+                spdlog::warn("방 이전 스냅샷 복원 실패: {}", e.what());
+                return nullptr;
+            }
+        }
+
+        bool GameRoom::restoreMigrationSnapshotLocked(const nlohmann::json& snapshot) {
+            m_isPrivate = snapshot.value("private", false);
+            m_allowSpectators = snapshot.value("allowSpectators", m_allowSpectators);
+            m_turnTimeoutSeconds = snapshot.value("turnTimeout", static_cast<int>(Common::DEFAULT_TURN_TIME));
+
+            // 좌석: 플레이어가 다시 로그인해 resumePlayer로 세션을 붙일 때까지 세션 없이 유지
+            for (const auto& entry : snapshot.at("players")) {
+                PlayerInfo player = PlayerInfo::fromJson(entry);
+                if (player.getUserId().empty()) {
+                    continue;
+                }
+                player.updateActivity();
+                m_players.push_back(std::move(player));
+            }
+            if (m_players.empty()) {
+                spdlog::warn("방 {} 이전 스냅샷에 플레이어가 없음", m_roomId);
+                return false;
+            }
+
+            // 보드 재실행
+            m_gameLogic->clearBoard();
+            m_boardSync.reset();
+            m_placementHistory.clear();
+            for (const auto& move : snapshot.at("moves")) {
+                Common::BlockPlacement placement;
+                placement.type = static_cast<Common::BlockType>(move.at(0).get<int>());
+                placement.position = { move.at(1).get<int>(), move.at(2).get<int>() };
+                placement.rotation = static_cast<Common::Rotation>(move.at(3).get<int>());
+                placement.flip = static_cast<Common::FlipState>(move.at(4).get<int>());
+                placement.player = static_cast<Common::PlayerColor>(move.at(5).get<int>());
+
+                if (!m_gameLogic->placeBlock(placement)) {
+                    spdlog::warn("방 {} 이전 스냅샷 재실행 실패: {}번째 배치", m_roomId, m_placementHistory.size() + 1);
+                    return false;
+                }
+                m_boardSync.applyPlacement(m_gameLogic->getBlockShape(placement), placement.player);
+                m_placementHistory.push_back(placement);
+            }
+
+            // 턴 상태
+            std::vector<Common::PlayerColor> turnOrder;
+            for (const auto& color : snapshot.at("turnOrder")) {
+                turnOrder.push_back(static_cast<Common::PlayerColor>(color.get<int>()));
+            }
+            if (turnOrder.empty()) {
+                return false;
+            }
+            m_gameStateManager->restoreTurnState(turnOrder, snapshot.value("turnIndex", 0), snapshot.value("turnNumber", 1));
+
+            for (const auto& entry : snapshot.at("afk")) {
+                auto color = static_cast<Common::PlayerColor>(entry.at(0).get<int>());
+                m_playerTimeoutCounts[color] = entry.at(1).get<int>();
+                m_playerBlockedByTimeout[color] = entry.at(2).get<bool>();
+                m_playerAfkVerificationCounts[color] = entry.at(3).get<int>();
+            }
+
+            // 시간: 경과 시간만큼 되돌려 남은 턴 시간을 이어감 (재시작에 걸린 시간은 플레이어에게 돌려줌)
+            auto now = std::chrono::steady_clock::now();
+            m_gameStartTime = now - std::chrono::milliseconds(snapshot.value("gameElapsedMs", 0LL));
+            long long turnElapsedMs = snapshot.value("turnElapsedMs", -1LL);
+            m_turnStartTime = now - std::chrono::milliseconds(std::max(0LL, turnElapsedMs));
+            m_turnTimerActive.store(turnElapsedMs >= 0);
+            m_lastTurnTimedOut = snapshot.value("lastTurnTimedOut", false);
+
+            m_state = RoomState::Playing;
+            m_hasCompletedGame = false;
+            updateActivity();
+
+            m_stopTimeoutCheck = false;
+            m_timeoutCheckThread = std::thread(&GameRoom::timeoutCheckLoop, this);
+
+            if (m_spectators) {
+                publishSpectatorSnapshotLocked();
+            }
+
+            spdlog::info("방 {} 이전 복원: 플레이어 {}명, 배치 {}개, 턴 {}",
+                m_roomId, m_players.size(), m_placementHistory.size(), m_gameStateManager->getTurnNumber());
+            return true;
         }
 
         void GameRoom::sendToPlayer(const std::string& userId, const std::string& message) {
@@ -728,7 +1112,17 @@ namespace Blokus {
 
         Common::RoomInfo GameRoom::getRoomInfo() const {
             std::lock_guard<std::mutex> lock(m_playersMutex);
+            return getRoomInfoLocked();
+        }
+
+        void GameRoom::publishRoomListEntry(bool insertIfMissing) {
+            if (!m_roomManager) return;
+
+            std::lock_guard<std::mutex> lock(m_playersMutex);
+            m_roomManager->updateRoomListEntry(getRoomInfoLocked(), insertIfMissing);
+        }
 
+        Common::RoomInfo GameRoom::getRoomInfoLocked() const {
             Common::RoomInfo info;
             info.roomId = m_roomId;
             info.roomName = m_roomName;
@@ -920,48 +1314,51 @@ namespace Blokus {
                 return;
             }
 
-            // JSON 형태로 게임 상태 생성 (최적화됨 - boardState 제거)
-            std::ostringstream gameStateJson;
-            gameStateJson << "GAME_STATE_UPDATE:{";
+            // JSON 형태로 게임 상태 생성 (최적화됨 - boardState 제거, 방별 재사용 버퍼에 직렬화)
+            MessageWriter& writer = m_messageWriter;
+            writer.reset("GAME_STATE_UPDATE:{");
             
             // 현재 턴 정보
             Common::PlayerColor currentPlayer = m_gameStateManager->getCurrentPlayer();
-            gameStateJson << "\"currentPlayer\":" << static_cast<int>(currentPlayer) << ",";
-            gameStateJson << "\"turnNumber\":" << m_gameStateManager->getTurnNumber() << ",";
+            writer.key("currentPlayer").number(currentPlayer).raw(',');
+            writer.key("turnNumber").number(m_gameStateManager->getTurnNumber()).raw(',');
             
             // 플레이어 점수 정보
             auto scores = m_gameLogic->calculateScores();
-            gameStateJson << "\"scores\":{";
+            writer.key("scores").raw('{');
             bool firstScore = true;
             for (const auto& score : scores) {
-                if (!firstScore) gameStateJson << ",";
-                gameStateJson << "\"" << static_cast<int>(score.first) << "\":" << score.second;
+                if (!firstScore) writer.raw(',');
+                writer.raw('"').number(score.first).raw("\":").number(score.second);
                 firstScore = false;
             }
-            gameStateJson << "},";
+            writer.raw("},");
             
-            // 플레이어 남은 블록 개수 정보
-            gameStateJson << "\"remainingBlocks\":{";
+            // 플레이어 남은 블록 개수 정보 (사용한 블록 수로 계산, 블록 목록을 만들지 않음)
+            writer.key("remainingBlocks").raw('{');
             bool firstRemaining = true;
             for (const auto& player : m_players) {
-                if (!firstRemaining) gameStateJson << ",";
+                if (!firstRemaining) writer.raw(',');
                 
-                // 남은 블록 개수 계산 (전체 블록 수 - 사용된 블록 수)
-                auto availableBlocks = m_gameLogic->getAvailableBlocks(player.getColor());
-                int remainingCount = static_cast<int>(availableBlocks.size());
+                int remainingCount = Common::BLOCKS_PER_PLAYER - m_gameLogic->getPlacedBlockCount(player.getColor());
                 
-                gameStateJson << "\"" << static_cast<int>(player.getColor()) << "\":" << remainingCount;
+                writer.raw('"').number(player.getColor()).raw("\":").number(remainingCount);
                 firstRemaining = false;
             }
-            gameStateJson << "}";
+            writer.raw("},");
+
+            // 보드 동기화 기준점 (클라이언트가 자기 보드 해시와 비교)
+            writer.key("boardSeq").number(m_boardSync.getSeq()).raw(',');
+            writer.key("boardHash").raw('"');
+            BoardSync::writeHash(writer, m_boardSync.getHash());
+            writer.raw('"');
             
-            gameStateJson << "}";
+            writer.raw('}');
             
             // 모든 플레이어에게 브로드캐스트
-            std::string message = gameStateJson.str();
-            broadcastMessageLocked(message);
+            broadcastFrameLocked(writer.frame());
             
-            spdlog::debug("게임 상태 브로드캐스트: 방 {}, 현재 턴: {}", 
+            SPDLOG_DEBUG("게임 상태 브로드캐스트: 방 {}, 현재 턴: {}", 
                 m_roomId, static_cast<int>(currentPlayer));
         }
 
@@ -973,32 +1370,37 @@ namespace Blokus {
         void GameRoom::broadcastBlockPlacementLocked(const std::string& playerName, const Common::BlockPlacement& placement, int scoreGained) {
             // 뮤텍스가 이미 잠겨있다고 가정하고 실행 (데드락 방지용)
             
-            spdlog::debug("블록 배치 브로드캐스트 - 방 {}, 플레이어 수: {}", m_roomId, m_players.size());
+            SPDLOG_DEBUG("블록 배치 브로드캐스트 - 방 {}, 플레이어 수: {}", m_roomId, m_players.size());
             
             // 배치된 셀들의 좌표를 계산
             auto placedCells = m_gameLogic->getBlockShape(placement);
             
             // 블록 배치 알림 메시지 생성 (개선된 버전 - placedCells 포함)
-            std::ostringstream blockPlacementMsg;
-            blockPlacementMsg << "BLOCK_PLACED:{"
-                << "\"player\":\"" << playerName << "\","
-                << "\"blockType\":" << static_cast<int>(placement.type) << ","
-                << "\"position\":{\"row\":" << placement.position.first << ",\"col\":" << placement.position.second << "},"
-                << "\"rotation\":" << static_cast<int>(placement.rotation) << ","
-                << "\"flip\":" << static_cast<int>(placement.flip) << ","
-                << "\"playerColor\":" << static_cast<int>(placement.player) << ","
-                << "\"scoreGained\":" << scoreGained << ","
-                << "\"placedCells\":[";
+            MessageWriter& writer = m_messageWriter;
+            writer.reset("BLOCK_PLACED:{");
+            writer.key("player").jsonString(playerName).raw(',');
+            writer.key("blockType").number(placement.type).raw(',');
+            writer.key("position").raw('{').key("row").number(placement.position.first)
+                .raw(',').key("col").number(placement.position.second).raw("},");
+            writer.key("rotation").number(placement.rotation).raw(',');
+            writer.key("flip").number(placement.flip).raw(',');
+            writer.key("playerColor").number(placement.player).raw(',');
+            writer.key("scoreGained").number(scoreGained).raw(',');
+            writer.key("seq").number(m_boardSync.getSeq()).raw(',');
+            writer.key("hash").raw('"');
+            BoardSync::writeHash(writer, m_boardSync.getHash());
+            writer.raw("\",");
+            writer.key("placedCells").raw('[');
             
             // 배치된 셀들 좌표 추가
             for (size_t i = 0; i < placedCells.size(); ++i) {
-                if (i > 0) blockPlacementMsg << ",";
-                blockPlacementMsg << "{\"row\":" << placedCells[i].first << ",\"col\":" << placedCells[i].second << "}";
+                if (i > 0) writer.raw(',');
+                writer.raw('{').key("row").number(placedCells[i].first).raw(',').key("col").number(placedCells[i].second).raw('}');
             }
             
-            blockPlacementMsg << "]}";
+            writer.raw("]}");
             
-            broadcastMessageLocked(blockPlacementMsg.str());
+            broadcastFrameLocked(writer.frame());
             
             // 시스템 메시지로도 알림
             // 250804 : 시스템 메시지가 너무 많아서 주석 처리
@@ -1007,7 +1409,7 @@ namespace Blokus {
             // systemMsg << "SYSTEM:" << playerName << "님이 " << blockName << " 블록을 배치했습니다. (점수: +" << scoreGained << ")";
             // broadcastMessageLocked(systemMsg.str());
             
-            spdlog::debug("블록 배치 브로드캐스트: 방 {}, 플레이어 {}, 블록 타입 {}, 점유셀 {}개", 
+            SPDLOG_DEBUG("블록 배치 브로드캐스트: 방 {}, 플레이어 {}, 블록 타입 {}, 점유셀 {}개", 
                 m_roomId, playerName, static_cast<int>(placement.type), placedCells.size());
         }
 
@@ -1044,7 +1446,7 @@ namespace Blokus {
                 auto timeoutBlockIt = m_playerBlockedByTimeout.find(currentPlayer);
                 if (timeoutBlockIt != m_playerBlockedByTimeout.end() && timeoutBlockIt->second) {
                     blockedPlayerCount++;
-                    spdlog::debug("[TIMEOUT_SKIP] 플레이어 {} 타임아웃 차단 상태로 턴 자동 스킵 ({}/{})", 
+                    SPDLOG_DEBUG("[TIMEOUT_SKIP] 플레이어 {} 타임아웃 차단 상태로 턴 자동 스킵 ({}/{})", 
                                static_cast<int>(currentPlayer), blockedPlayerCount, maxPlayers);
                     
                     // 다음 플레이어로 즉시 턴 넘기기 (타이머 없이)
@@ -1081,19 +1483,19 @@ namespace Blokus {
             startTurnTimer();
             
             // 턴 변경 알림 메시지 (타이머 정보 포함)
-            std::ostringstream turnChangeMsg;
-            turnChangeMsg << "TURN_CHANGED:{"
-                << "\"newPlayer\":\"" << newPlayerName << "\","
-                << "\"playerColor\":" << static_cast<int>(currentPlayer) << ","
-                << "\"turnNumber\":" << m_gameStateManager->getTurnNumber() << ","
-                << "\"turnTimeSeconds\":" << m_turnTimeoutSeconds << ","
-                << "\"remainingTimeSeconds\":" << m_turnTimeoutSeconds << ","
-                << "\"previousTurnTimedOut\":" << (m_lastTurnTimedOut ? "true" : "false")
-                << "}";
+            MessageWriter& writer = m_messageWriter;
+            writer.reset("TURN_CHANGED:{");
+            writer.key("newPlayer").jsonString(newPlayerName).raw(',');
+            writer.key("playerColor").number(currentPlayer).raw(',');
+            writer.key("turnNumber").number(m_gameStateManager->getTurnNumber()).raw(',');
+            writer.key("turnTimeSeconds").number(m_turnTimeoutSeconds).raw(',');
+            writer.key("remainingTimeSeconds").number(m_turnTimeoutSeconds).raw(',');
+            writer.key("previousTurnTimedOut").boolean(m_lastTurnTimedOut);
+            writer.raw('}');
             
-            spdlog::debug("[TIMER_DEBUG] TURN_CHANGED 메시지 생성: {}", turnChangeMsg.str());
+            SPDLOG_DEBUG("[TIMER_DEBUG] TURN_CHANGED 메시지 생성: {}", writer.view());
             
-            broadcastMessageLocked(turnChangeMsg.str());
+            broadcastFrameLocked(writer.frame());
             
             // 시스템 메시지
             // 250804 : 시스템 메시지가 너무 많아서 주석 처리
@@ -1101,7 +1503,7 @@ namespace Blokus {
             // systemMsg << "SYSTEM:" << newPlayerName << "님의 턴입니다.";
             // broadcastMessageLocked(systemMsg.str());
             
-            spdlog::debug("턴 변경 브로드캐스트: 방 {}, 새 플레이어 {} ({})", 
+            SPDLOG_DEBUG("턴 변경 브로드캐스트: 방 {}, 새 플레이어 {} ({})", 
                 m_roomId, newPlayerName, static_cast<int>(currentPlayer));
         }
 
@@ -1286,6 +1688,8 @@ namespace Blokus {
             
             // 게임 상태 초기화
             m_gameLogic->clearBoard();
+            m_boardSync.reset();
+            m_placementHistory.clear();
             m_gameStateManager->resetGame();
             m_state = RoomState::Waiting;
             
@@ -1306,6 +1710,11 @@ namespace Blokus {
             
             // 방 정보 업데이트 브로드캐스트
             broadcastRoomInfoLocked();
+
+            // 로비 방 목록 캐시에 대기 상태 반영 (RoomManager 이벤트를 거치지 않는 자연 종료 경로)
+            if (m_roomManager) {
+                m_roomManager->updateRoomListEntry(getRoomInfoLocked());
+            }
             
             // 클라이언트에게 게임 리셋 알림
             broadcastMessageLocked("GAME_RESET");
@@ -1419,7 +1828,13 @@ namespace Blokus {
         // ========================================
 
         bool GameRoom::handleBlockPlacement(const std::string& userId, const Common::BlockPlacement& placement) {
-            std::lock_guard<std::mutex> lock(m_playersMutex);
+            TraceSpan span("GameRoom::handleBlockPlacement", m_roomId);
+
+            std::unique_lock<std::mutex> lock(m_playersMutex, std::defer_lock);
+            {
+                TraceSpan waitSpan("GameRoom::wait(m_playersMutex)", m_roomId);
+                lock.lock();
+            }
 
             // 게임이 진행 중인지 확인
             if (m_state != RoomState::Playing) {
@@ -1427,6 +1842,12 @@ namespace Blokus {
                 return false;
             }
 
+            // 새 프로세스로 이전 중인 방은 스냅샷 이후 변경을 받지 않음
+            if (m_migratedOut) {
+                spdlog::warn("블록 배치 실패: 서버 재시작으로 이전 중인 방 (방 {})", m_roomId);
+                return false;
+            }
+
             // 플레이어 찾기 (뮤텍스 내에서 직접 검색)
             auto* player = findPlayerById(m_players, userId);
             if (!player) {
@@ -1449,49 +1870,59 @@ namespace Blokus {
             }
 
             // 블록 배치 시도
-            if (!m_gameLogic->canPlaceBlock(placement)) {
-                spdlog::warn("블록 배치 실패: 게임 규칙 위반 (방 {}, 사용자 {})", m_roomId, userId);
-                return false;
-            }
+            {
+                TraceSpan placeSpan("GameLogic::canPlaceBlock+placeBlock", static_cast<int64_t>(placement.type));
+                if (!m_gameLogic->canPlaceBlock(placement)) {
+                    spdlog::warn("블록 배치 실패: 게임 규칙 위반 (방 {}, 사용자 {})", m_roomId, userId);
+                    return false;
+                }
 
-            if (!m_gameLogic->placeBlock(placement)) {
-                spdlog::warn("블록 배치 실패: 블록 배치 불가 (방 {}, 사용자 {})", m_roomId, userId);
-                return false;
+                if (!m_gameLogic->placeBlock(placement)) {
+                    spdlog::warn("블록 배치 실패: 블록 배치 불가 (방 {}, 사용자 {})", m_roomId, userId);
+                    return false;
+                }
             }
 
             // 블록 사용 상태 업데이트
             m_gameLogic->setPlayerBlockUsed(placement.player, placement.type);
 
+            // 보드 변경 순번/해시 갱신 (BLOCK_PLACED에 함께 실림)
+            m_boardSync.applyPlacement(m_gameLogic->getBlockShape(placement), placement.player);
+            m_placementHistory.push_back(placement);
+
             // 성공적으로 배치됨 - 점수 계산
             int scoreGained = Common::BlockFactory::getBlockScore(placement.type);
             
             // 턴 타이머 정지 (블록 배치 성공시)
             stopTurnTimer();
             
-            spdlog::debug("블록 배치 성공 (방 {}, 사용자 {}, 블록 타입: {}, 획득 점수: {})", 
+            SPDLOG_DEBUG("블록 배치 성공 (방 {}, 사용자 {}, 블록 타입: {}, 획득 점수: {})", 
                 m_roomId, userId, static_cast<int>(placement.type), scoreGained);
 
             // 블록 배치 알림 브로드캐스트 (뮤텍스 내에서 안전하게)
-            spdlog::debug("블록 배치 브로드캐스트 시작: 방 {}", m_roomId);
-            broadcastBlockPlacementLocked(player->getUsername(), placement, scoreGained);
+            SPDLOG_DEBUG("블록 배치 브로드캐스트 시작: 방 {}", m_roomId);
+            {
+                TraceSpan broadcastSpan("GameRoom::broadcastBlockPlacement", static_cast<int64_t>(m_players.size()));
+                broadcastBlockPlacementLocked(player->getUsername(), placement, scoreGained);
+            }
 
             // 다음 턴으로 전환
-            Common::PlayerColor previousPlayer = m_gameStateManager->getCurrentPlayer();
-            spdlog::debug("턴 전환 시작: {} -> ?", static_cast<int>(previousPlayer));
+            [[maybe_unused]] Common::PlayerColor previousPlayer = m_gameStateManager->getCurrentPlayer();
+            SPDLOG_DEBUG("턴 전환 시작: {} -> ?", static_cast<int>(previousPlayer));
             m_gameStateManager->nextTurn();
-            Common::PlayerColor newPlayer = m_gameStateManager->getCurrentPlayer();
-            spdlog::debug("턴 전환 완료: {} -> {}", static_cast<int>(previousPlayer), static_cast<int>(newPlayer));
+            [[maybe_unused]] Common::PlayerColor newPlayer = m_gameStateManager->getCurrentPlayer();
+            SPDLOG_DEBUG("턴 전환 완료: {} -> {}", static_cast<int>(previousPlayer), static_cast<int>(newPlayer));
 
             // 새 플레이어가 블록을 배치할 수 없다면 자동 턴 스킵 체크 (턴 변경 브로드캐스트 전에 실행)
-            spdlog::debug("자동 스킵 체크 시작: {}", static_cast<int>(newPlayer));
+            SPDLOG_DEBUG("자동 스킵 체크 시작: {}", static_cast<int>(newPlayer));
             processAutoSkipAfterTurnChange("블록 배치");
             
             // 자동 스킵 후의 실제 현재 플레이어 확인
             Common::PlayerColor finalPlayer = m_gameStateManager->getCurrentPlayer();
-            spdlog::debug("자동 스킵 체크 완료: {} -> {}", static_cast<int>(newPlayer), static_cast<int>(finalPlayer));
+            SPDLOG_DEBUG("자동 스킵 체크 완료: {} -> {}", static_cast<int>(newPlayer), static_cast<int>(finalPlayer));
 
             // 턴 브로드캐스트 (자동 스킵을 고려한 최종 플레이어로)
-            spdlog::debug("턴 변경: {} -> {}", static_cast<int>(previousPlayer), static_cast<int>(finalPlayer));
+            SPDLOG_DEBUG("턴 변경: {} -> {}", static_cast<int>(previousPlayer), static_cast<int>(finalPlayer));
             
             // 최종 플레이어 이름 찾기
             std::string finalPlayerName = "";
@@ -1506,27 +1937,35 @@ namespace Blokus {
             if (finalPlayerName.empty()) {
                 spdlog::warn(" 턴 브로드캐스트 실패: 플레이어 색상 {}에 해당하는 플레이어를 찾을 수 없음", static_cast<int>(finalPlayer));
             } else {
-                spdlog::debug("TURN_CHANGED 브로드캐스트: {} (색상 {})", finalPlayerName, static_cast<int>(finalPlayer));
+                SPDLOG_DEBUG("TURN_CHANGED 브로드캐스트: {} (색상 {})", finalPlayerName, static_cast<int>(finalPlayer));
+                TraceSpan broadcastSpan("GameRoom::broadcastTurnChange", static_cast<int64_t>(finalPlayer));
                 broadcastTurnChangeLocked(finalPlayer);
-                spdlog::debug(" TURN_CHANGED 브로드캐스트 완료");
+                SPDLOG_DEBUG(" TURN_CHANGED 브로드캐스트 완료");
             }
 
             // 전체 게임 상태 브로드캐스트 (뮤텍스 내에서 안전하게)
-            broadcastGameStateLocked();
+            {
+                TraceSpan broadcastSpan("GameRoom::broadcastGameState", m_roomId);
+                broadcastGameStateLocked();
+            }
 
             // 게임 종료 조건 확인: 모든 플레이어가 더 이상 블록을 배치할 수 없는 경우
-            bool gameFinished = m_gameLogic->isGameFinished();
+            bool gameFinished;
+            {
+                TraceSpan finishedSpan("GameLogic::isGameFinished", m_roomId);
+                gameFinished = m_gameLogic->isGameFinished();
+            }
             
             if (!gameFinished) {
-                spdlog::debug("⏩ [DB_DEBUG] 게임 계속 진행 - DB 저장 없음 (방 {})", m_roomId);
+                SPDLOG_DEBUG("⏩ [DB_DEBUG] 게임 계속 진행 - DB 저장 없음 (방 {})", m_roomId);
             }
             
             if (gameFinished) {
-                spdlog::debug("게임 종료 조건 충족: 모든 플레이어가 블록 배치 불가 (방 {})", m_roomId);
+                SPDLOG_DEBUG("게임 종료 조건 충족: 모든 플레이어가 블록 배치 불가 (방 {})", m_roomId);
                 
                 // 최종 점수 계산
                 auto finalScores = m_gameLogic->calculateScores();
-                spdlog::debug("최종 점수 계산 완료: {}명의 플레이어 (방 {})", finalScores.size(), m_roomId);
+                SPDLOG_DEBUG("최종 점수 계산 완료: {}명의 플레이어 (방 {})", finalScores.size(), m_roomId);
                 
                 // 승자 결정 (가장 높은 점수를 가진 플레이어)
                 Common::PlayerColor winner = Common::PlayerColor::None;
@@ -1534,7 +1973,7 @@ namespace Blokus {
                 std::vector<Common::PlayerColor> winners; // 동점자 처리
                 
                 for (const auto& score : finalScores) {
-                    spdlog::debug("플레이어 점수: 색상={}, 점수={} (방 {})", 
+                    SPDLOG_DEBUG("플레이어 점수: 색상={}, 점수={} (방 {})", 
                                static_cast<int>(score.first), score.second, m_roomId);
                     if (score.second > highestScore) {
                         highestScore = score.second;
@@ -1546,20 +1985,20 @@ namespace Blokus {
                     }
                 }
                 
-                spdlog::debug("승자 결정 완료: {}명의 승자, 최고 점수={} (방 {})", winners.size(), highestScore, m_roomId);
+                SPDLOG_DEBUG("승자 결정 완료: {}명의 승자, 최고 점수={} (방 {})", winners.size(), highestScore, m_roomId);
 
                 // 게임 결과를 DB에 저장 (브로드캐스트 전에 먼저 처리)
-                spdlog::debug("[DB_DEBUG] 게임 결과 DB 저장 시작 - 방 {}, 플레이어 {}명, 승자 {}명",
+                SPDLOG_DEBUG("[DB_DEBUG] 게임 결과 DB 저장 시작 - 방 {}, 플레이어 {}명, 승자 {}명",
                            m_roomId, finalScores.size(), winners.size());
                 saveGameResultsToDatabase(finalScores, winners);
-                spdlog::debug("[DB_DEBUG] 게임 결과 DB 저장 호출 완료 - 방 {}", m_roomId);
+                SPDLOG_DEBUG("[DB_DEBUG] 게임 결과 DB 저장 호출 완료 - 방 {}", m_roomId);
 
                 // DB/세션 업데이트 완료 후 게임 결과 브로드캐스트
                 broadcastGameResultLocked(finalScores, winners);
                 
                 // 게임 종료 처리는 플레이어 응답 후에 수행하므로 여기서는 하지 않음
             } else if (m_gameStateManager->getGameState() == Common::GameState::Finished) {
-                spdlog::debug("게임 상태가 Finished로 변경되어 게임 종료 처리 (방 {})", m_roomId);
+                SPDLOG_DEBUG("게임 상태가 Finished로 변경되어 게임 종료 처리 (방 {})", m_roomId);
                 endGameLocked();
             }
 
@@ -1569,8 +2008,8 @@ namespace Blokus {
         bool GameRoom::skipPlayerTurn(const std::string& userId) {
             std::lock_guard<std::mutex> lock(m_playersMutex);
 
-            // 게임이 진행 중인지 확인
-            if (m_state != RoomState::Playing) {
+            // 게임이 진행 중인지 확인 (이전 중인 방 제외)
+            if (m_state != RoomState::Playing || m_migratedOut) {
                 return false;
             }
 
@@ -1580,19 +2019,19 @@ namespace Blokus {
             }
 
             // 턴 스킵
-            spdlog::debug("수동 턴 스킵 (방 {}, 사용자 {})", m_roomId, userId);
+            SPDLOG_DEBUG("수동 턴 스킵 (방 {}, 사용자 {})", m_roomId, userId);
             
             Common::PlayerColor previousPlayer = m_gameStateManager->getCurrentPlayer();
             m_gameStateManager->skipTurn();
-            Common::PlayerColor newPlayer = m_gameStateManager->getCurrentPlayer();
+            [[maybe_unused]] Common::PlayerColor newPlayer = m_gameStateManager->getCurrentPlayer();
             
             // 자동 턴 스킵 체크 (새로운 플레이어도 블록을 배치할 수 없다면)
-            spdlog::debug("수동 스킵 후 자동 스킵 체크 시작: {}", static_cast<int>(newPlayer));
+            SPDLOG_DEBUG("수동 스킵 후 자동 스킵 체크 시작: {}", static_cast<int>(newPlayer));
             processAutoSkipAfterTurnChange("수동 스킵");
             
             // 자동 스킵 후의 최종 플레이어 확인
             Common::PlayerColor finalPlayer = m_gameStateManager->getCurrentPlayer();
-            spdlog::debug("수동 스킵 후 자동 스킵 체크 완료: {} -> {}", static_cast<int>(newPlayer), static_cast<int>(finalPlayer));
+            SPDLOG_DEBUG("수동 스킵 후 자동 스킵 체크 완료: {} -> {}", static_cast<int>(newPlayer), static_cast<int>(finalPlayer));
             
             // 턴 변경 브로드캐스트 (자동 스킵을 고려한 최종 플레이어로)
             if (finalPlayer != previousPlayer) {
@@ -1628,14 +2067,21 @@ namespace Blokus {
 
         void GameRoom::processAutoSkipAfterTurnChange(const std::string& skipReason) {
             // 뮤텍스가 이미 잠겨있다고 가정하고 실행
+            TraceSpan span("GameRoom::processAutoSkipAfterTurnChange", m_roomId);
             int autoSkipCount = 0;
             int maxAutoSkips = m_players.size(); // 최대 플레이어 수만큼만 스킵 허용
             bool shouldCheckAutoSkip = true;
             
             while (shouldCheckAutoSkip && m_state == RoomState::Playing && autoSkipCount < maxAutoSkips) {
                 Common::PlayerColor checkPlayer = m_gameStateManager->getCurrentPlayer();
+
+                bool canPlace;
+                {
+                    TraceSpan checkSpan("GameLogic::canPlayerPlaceAnyBlock", static_cast<int64_t>(checkPlayer));
+                    canPlace = m_gameLogic->canPlayerPlaceAnyBlock(checkPlayer);
+                }
                 
-                if (m_gameLogic->canPlayerPlaceAnyBlock(checkPlayer)) {
+                if (canPlace) {
                     // 현재 플레이어가 블록을 배치할 수 있으면 중단
                     shouldCheckAutoSkip = false;
                 } else {
@@ -1652,7 +2098,7 @@ namespace Blokus {
                         }
                     }
                     
-                    spdlog::debug("{} 후 자동 턴 스킵 {}/{}: {} (색상 {})님이 더 이상 배치할 블록이 없음", 
+                    SPDLOG_DEBUG("{} 후 자동 턴 스킵 {}/{}: {} (색상 {})님이 더 이상 배치할 블록이 없음", 
                         skipReason, autoSkipCount, maxAutoSkips, playerName, static_cast<int>(checkPlayer));
                     
                     // 자동 턴 스킵 알림 메시지 (최초 1번만)
@@ -1663,11 +2109,11 @@ namespace Blokus {
                     }
                     
                     // 턴 넘기기
-                    Common::PlayerColor prevPlayer = checkPlayer;
+                    [[maybe_unused]] Common::PlayerColor prevPlayer = checkPlayer;
                     m_gameStateManager->nextTurn();
-                    Common::PlayerColor nextPlayer = m_gameStateManager->getCurrentPlayer();
+                    [[maybe_unused]] Common::PlayerColor nextPlayer = m_gameStateManager->getCurrentPlayer();
                     
-                    spdlog::debug("자동 턴 전환: {} -> {}", static_cast<int>(prevPlayer), static_cast<int>(nextPlayer));
+                    SPDLOG_DEBUG("자동 턴 전환: {} -> {}", static_cast<int>(prevPlayer), static_cast<int>(nextPlayer));
                     
                     // NOTE: 턴 변경 브로드캐스트는 호출자(handleBlockPlacement)에서 처리하므로 여기서는 제거
                     // 대신 게임 상태만 브로드캐스트
@@ -1675,7 +2121,7 @@ namespace Blokus {
                     
                     // 모든 플레이어가 한 번씩 스킵되었으면 게임 종료
                     if (autoSkipCount >= maxAutoSkips) {
-                        spdlog::debug("{} 후 모든 활성 플레이어가 스킵됨, 게임 종료 (방 {})", skipReason, m_roomId);
+                        SPDLOG_DEBUG("{} 후 모든 활성 플레이어가 스킵됨, 게임 종료 (방 {})", skipReason, m_roomId);
                         shouldCheckAutoSkip = false;
                         break;
                     }
@@ -1684,7 +2130,7 @@ namespace Blokus {
             
             // CRITICAL: 모든 활성 플레이어가 스킵되었으면 게임 종료
             if (autoSkipCount >= maxAutoSkips) {
-                spdlog::debug("{} 후 게임 종료 조건 충족: 모든 활성 플레이어가 블록 배치 불가 (방 {})", skipReason, m_roomId);
+                SPDLOG_DEBUG("{} 후 게임 종료 조건 충족: 모든 활성 플레이어가 블록 배치 불가 (방 {})", skipReason, m_roomId);
                 terminateGameLocked(skipReason + " - 모든 플레이어 블록 배치 불가");
             }
         }
@@ -1697,21 +2143,16 @@ namespace Blokus {
             }
             
             auto dbManager = m_roomManager->getDatabaseManager();
-            if (!dbManager) {
+            auto persister = m_roomManager->getGameResultPersister();
+            if (!dbManager || !persister) {
                 spdlog::warn("DatabaseManager가 없어 게임 결과를 DB에 저장할 수 없습니다 (방 {})", m_roomId);
                 return;
             }
             
             try {
-                // 플레이어 정보 수집 (게임 통계용)
-                std::vector<uint32_t> playerIds;
-                std::vector<int> scores;
-                std::vector<bool> isWinner;
-                
-                // 경험치용 별도 컬렉션 (게임 완료자만)
-                std::vector<uint32_t> completedPlayerIds;
-                std::vector<int> completedScores;
-                std::vector<bool> completedIsWinner;
+                // 플레이어 결과 수집 - 실제 DB 저장과 세션 동기화는 저장 큐 워커에서 배치로 처리
+                PendingGameResult result;
+                result.roomId = m_roomId;
                 
                 for (const auto& scoreEntry : finalScores) {
                     Common::PlayerColor color = scoreEntry.first;
@@ -1723,26 +2164,19 @@ namespace Blokus {
                             // 사용자 ID를 uint32_t로 변환
                             try {
                                 uint32_t userId = std::stoul(player.getUserId());
-                                playerIds.push_back(userId);
-                                scores.push_back(score);
                                 
-                                // 승자인지 확인
+                                // 새로운 로직: 공동 우승자도 승리로 처리, 무승부 개념 제거
                                 bool won = std::find(winners.begin(), winners.end(), color) != winners.end();
-                                isWinner.push_back(won);
                                 
-                                // 게임 완료자인지 확인 (현재 연결되어 있는 플레이어만)
+                                // 게임 완료자(현재 연결되어 있는 플레이어)에게만 경험치 지급
                                 bool completedGame = player.isConnected() && player.isValid();
-                                if (completedGame) {
-                                    completedPlayerIds.push_back(userId);
-                                    completedScores.push_back(score);
-                                    completedIsWinner.push_back(won);
-                                    spdlog::debug("게임 완료 플레이어 {}({}) 게임 결과: 점수={}, 승리={}", 
-                                               player.getUsername(), userId, score, won);
-                                } else {
-                                    spdlog::debug("게임 미완료 플레이어 {}({}) - 경험치 없음", 
-                                               player.getUsername(), userId);
-                                }
+                                int expGained = completedGame ? dbManager->calculateExperienceGain(won, score, true) : 0;
                                 
+                                result.rows.push_back({ userId, score, won, expGained });
+                                result.sessions.push_back(player.getSession());
+                                
+                                spdlog::debug("게임 결과 수집: {}({}) 점수={}, 승리={}, 경험치=+{}", 
+                                           player.getUsername(), userId, score, won, expGained);
                                 break;
                             }
                             catch (const std::exception& e) {
@@ -1752,88 +2186,16 @@ namespace Blokus {
                     }
                 }
                 
-                if (!playerIds.empty()) {
-                    // 새로운 로직: 공동 우승자도 승리로 처리, 무승부 개념 제거
-                    bool isDraw = false; // 무승부 개념 제거
-
-                    // DB에 게임 결과 저장 (모든 플레이어)
-                    bool success = dbManager->saveGameResults(playerIds, scores, isWinner, isDraw);
-                    if (success) {
-                        spdlog::info("[DB_DEBUG] 방 {} 게임 결과가 DB에 성공적으로 저장되었습니다", m_roomId);
-
-                        // 모든 남은 플레이어의 세션 정보 동기화 (승/패 통계 즉시 반영)
-                        for (const auto& player : m_players) {
-                            auto session = player.getSession();
-                            if (session) {
-                                try {
-                                    uint32_t playerId = std::stoul(player.getUserId());
-                                    auto updatedAccount = dbManager->getUserById(playerId);
-                                    if (updatedAccount.has_value()) {
-                                        session->updateUserAccount(updatedAccount.value());
-                                        spdlog::debug("게임 결과 후 세션 동기화: {} (승:{} 패:{} 무:{})",
-                                                   player.getUsername(),
-                                                   updatedAccount->wins,
-                                                   updatedAccount->losses,
-                                                   updatedAccount->draws);
-                                    }
-                                } catch (const std::exception& e) {
-                                    spdlog::error("플레이어 {} 세션 동기화 실패: {}", player.getUsername(), e.what());
-                                }
-                            }
-                        }
-
-                        // 게임 완료자에게만 경험치 지급
-                        if (!completedPlayerIds.empty()) {
-                            for (size_t i = 0; i < completedPlayerIds.size(); ++i) {
-                                int expGained = dbManager->calculateExperienceGain(
-                                    completedIsWinner[i], completedScores[i], true);
-                                
-                                if (expGained > 0) {
-                                    bool expSuccess = dbManager->updatePlayerExperience(
-                                        completedPlayerIds[i], expGained);
-                                    
-                                    if (expSuccess) {
-                                        spdlog::debug("플레이어 {} 경험치 획득: +{}", 
-                                                   completedPlayerIds[i], expGained);
-                                        
-                                        // 세션 정보 동기화: DB 업데이트 후 세션의 UserAccount 정보도 갱신
-                                        for (const auto& player : m_players) {
-                                            if (player.getUserId() == std::to_string(completedPlayerIds[i])) {
-                                                auto session = player.getSession();
-                                                if (session) {
-                                                    // DB에서 최신 사용자 정보 조회
-                                                    auto updatedAccount = dbManager->getUserById(completedPlayerIds[i]);
-                                                    if (updatedAccount.has_value()) {
-                                                        session->updateUserAccount(updatedAccount.value());
-                                                        spdlog::debug("세션 정보 동기화 완료: {} (레벨: {}, 경험치: {})", 
-                                                                     player.getUsername(), 
-                                                                     updatedAccount->level, 
-                                                                     updatedAccount->experiencePoints);
-                                                    }
-                                                }
-                                                break;
-                                            }
-                                        }
-                                    } else {
-                                        spdlog::error("플레이어 {} 경험치 업데이트 실패", 
-                                                    completedPlayerIds[i]);
-                                    }
-                                }
-                            }
-                            spdlog::debug("방 {} 경험치 지급 완료 ({}/{}명)", 
-                                       m_roomId, completedPlayerIds.size(), playerIds.size());
-                        } else {
-                            spdlog::warn("게임 완료자가 없어 경험치 지급 없음 (방 {})", m_roomId);
-                        }
-                    } else {
-                        spdlog::error("[DB_DEBUG] 방 {} 게임 결과 DB 저장 실패", m_roomId);
-                    }
+                if (!result.rows.empty()) {
+                    size_t playerCount = result.rows.size();
+                    persister->enqueue(std::move(result));
+                    spdlog::info("[DB_DEBUG] 방 {} 게임 결과 저장 큐 등록 ({}명)", m_roomId, playerCount);
                 } else {
                     spdlog::warn("[DB_DEBUG] 저장할 플레이어 데이터가 없습니다 (방 {})", m_roomId);
                 }
                 
             } catch (const std::exception& e) {
-                spdlog::error("[DB_DEBUG] 게임 결과 DB 저장 중 예외 발생 (방 {}): {}", m_roomId, e.what());
+                spdlog::error("[DB_DEBUG] 게임 결과 저장 큐 등록 중 예외 발생 (방 {}): {}", m_roomId, e.what());
             }
         }
 
@@ -1842,22 +2204,33 @@ namespace Blokus {
         // ========================================
 
         void GameRoom::startTurnTimer() {
+            if (m_migratedOut) {
+                return;
+            }
             if (m_state != RoomState::Playing) {
                 spdlog::warn("[TIMER_DEBUG] 턴 타이머 시작 실패: 게임 중이 아님 (방 {}, 상태: {})", m_roomId, static_cast<int>(m_state));
                 return; // 게임 중이 아니면 타이머 시작하지 않음
             }
 
-            m_turnStartTime = std::chrono::steady_clock::now();
+            // 이전 턴이 진행 중이었으면 그 턴의 소요 시간 기록
+            auto now = std::chrono::steady_clock::now();
+            if (m_turnTimerActive.load()) {
+                ServerMetrics::instance().turnDuration.recordDuration(now - m_turnStartTime);
+            }
+
+            m_turnStartTime = now;
             m_turnTimerActive.store(true);
             m_lastTurnTimedOut = false;  // 새 턴이므로 타임아웃 플래그 리셋
             
-            spdlog::debug("[TIMER_DEBUG] 턴 타이머 시작: 방 {}, 제한시간 {}초, 현재 플레이어: {}", 
+            SPDLOG_DEBUG("[TIMER_DEBUG] 턴 타이머 시작: 방 {}, 제한시간 {}초, 현재 플레이어: {}", 
                 m_roomId, m_turnTimeoutSeconds, static_cast<int>(m_gameStateManager->getCurrentPlayer()));
         }
 
         void GameRoom::stopTurnTimer() {
-            m_turnTimerActive.store(false);
-            spdlog::debug("턴 타이머 정지: 방 {}", m_roomId);
+            if (m_turnTimerActive.exchange(false)) {
+                ServerMetrics::instance().turnDuration.recordDuration(std::chrono::steady_clock::now() - m_turnStartTime);
+            }
+            SPDLOG_DEBUG("턴 타이머 정지: 방 {}", m_roomId);
         }
 
         bool GameRoom::checkTurnTimeout() {
@@ -1872,7 +2245,7 @@ namespace Blokus {
         }
 
         void GameRoom::handleTurnTimeout() {
-            if (!m_turnTimerActive.load() || m_state != RoomState::Playing) {
+            if (!m_turnTimerActive.load() || m_state != RoomState::Playing || m_migratedOut) {
                 return;
             }
 
@@ -6,9 +6,32 @@
 #include "DatabaseManager.h"
 #include "ConfigManager.h"
 #include "VersionManager.h"
+#include "GameResultPersister.h"
+#include "DatabaseExecutor.h"
+#include "UserStatsCache.h"
+#include "CryptoExecutor.h"
+#include "RegisteredBufferPool.h"
+#include "IoContextPool.h"
+#include "ServerMetrics.h"
+#include "MetricsEndpoint.h"
+#include "SessionResumeRegistry.h"
+#include "ClusterBus.h"
+#include "ClusterManager.h"
+#include "RoomMigrationStore.h"
+#include "ChatService.h"
+#include "AdmissionController.h"
+#include "BlockPool.h"
+#include "Tracing.h"
+#include "Logging.h"
 #include <spdlog/spdlog.h>
 #include <chrono>
+#include <csignal>
+#include <future>
 #include <functional>
+#include <algorithm>
+#ifdef __linux__
+#include <sys/socket.h>
+#endif
 
 using boost::asio::ip::tcp;
 
@@ -49,6 +72,8 @@ namespace Blokus::Server {
                 spdlog::error("설정 초기화 실패");
                 return false;
             }
+            Tracer::configure(ConfigManager::traceSampleEvery,
+                static_cast<size_t>(std::max(0, ConfigManager::traceBufferEvents)));
 
             // 2. 데이터베이스 초기화
             if (!initializeDatabase()) {
@@ -68,14 +93,28 @@ namespace Blokus::Server {
                 return false;
             }
 
-            // 5. 통계 초기화
-            {
-                std::lock_guard<std::mutex> lock(statsMutex_);
-                stats_.serverStartTime = std::chrono::system_clock::now();
-                stats_.currentConnections = 0;
-                stats_.totalConnectionsToday = 0;
-                stats_.peakConcurrentConnections = 0;
-            }
+            // 5. 지표 수집 콜백 (스크레이프 시점에 다른 컴포넌트의 현재 값을 채움)
+            ServerMetrics::instance().startTime = std::chrono::system_clock::now();
+            ServerMetrics::instance().setCollector([this](ServerMetrics& metrics) {
+                if (roomManager_) {
+                    metrics.activeRooms.set(static_cast<int64_t>(roomManager_->getRoomCount()));
+                    metrics.playersInRooms.set(static_cast<int64_t>(roomManager_->getTotalPlayers()));
+                }
+                if (authService_) {
+                    metrics.authenticatedSessions.set(static_cast<int64_t>(authService_->getActiveSessionCount()));
+                }
+                if (databaseExecutor_) {
+                    metrics.dbPendingJobs.set(static_cast<int64_t>(databaseExecutor_->getPendingCount()));
+                }
+                metrics.logMessagesDropped.set(static_cast<int64_t>(Logging::getDroppedCount()));
+
+                const BlockPool& sessionPool = Session::getSessionPool();
+                metrics.sessionPoolReused.set(static_cast<int64_t>(sessionPool.reusedCount()));
+                metrics.sessionPoolAllocated.set(static_cast<int64_t>(sessionPool.allocatedCount()));
+                const BlockPool& readBufferSlabs = Session::getReadBufferSlabs();
+                metrics.readBufferSlabsReused.set(static_cast<int64_t>(readBufferSlabs.reusedCount()));
+                metrics.readBufferSlabsAllocated.set(static_cast<int64_t>(readBufferSlabs.allocatedCount()));
+            });
 
             spdlog::info("GameServer 초기화 완료");
             return true;
@@ -101,7 +140,12 @@ namespace Blokus::Server {
         spdlog::debug(" [DEBUG] work_guard 생성 완료");
 
         // 스레드 풀 생성
+        // 코어별 모드에서는 세션 I/O를 코어 스레드가 맡고, ioContext_는 타이머/제어용 스레드 1개로 실행
         int threadCount = ConfigManager::threadPoolSize;
+        if (ioContextPool_) {
+            ioContextPool_->start();
+            threadCount = 1;
+        }
         spdlog::info("스레드 풀 크기: {}", threadCount);
 
         threadPool_.reserve(threadCount);
@@ -117,12 +161,42 @@ namespace Blokus::Server {
         }
 
         // 연결 수락 시작
-        startAccepting();
+        if (!shardAcceptors_.empty()) {
+            for (size_t i = 0; i < shardAcceptors_.size(); ++i) {
+                startShardAccepting(i);
+            }
+        }
+        else {
+            startAccepting();
+        }
 
         // 하트비트 및 정리 타이머 시작
         startHeartbeatTimer();
         startCleanupTimer();
 
+        // 종료 시그널 (Ctrl+C, SIGTERM은 설정에 따라 드레인 종료)
+        // asio가 시그널을 받아 일반 핸들러로 넘겨주므로 여기서는 락/로깅을 써도 안전
+        signals_ = std::make_unique<boost::asio::signal_set>(ioContext_, SIGINT, SIGTERM);
+        signals_->async_wait([this](const boost::system::error_code& error, int signalNumber) {
+            if (error) {
+                return;
+            }
+            requestShutdown(signalNumber == SIGTERM && ConfigManager::drainOnShutdown);
+            });
+
+        // 지표 엔드포인트 (실패해도 게임 서비스는 계속)
+        if (ConfigManager::metricsPort > 0) {
+            metricsEndpoint_ = std::make_unique<MetricsEndpoint>(ioContext_);
+            if (!metricsEndpoint_->start(ConfigManager::metricsBindAddress, ConfigManager::metricsPort)) {
+                metricsEndpoint_.reset();
+            }
+        }
+
+        // 클러스터 (실패하면 단일 노드로 계속 서비스)
+        if (ConfigManager::clusterEnabled && !startCluster()) {
+            spdlog::warn("클러스터 모드 시작 실패 - 단일 노드로 실행");
+        }
+
         spdlog::info("GameServer가 {}:{} 에서 클라이언트 연결을 대기합니다",
             "0.0.0.0", ConfigManager::serverPort);
     }
@@ -140,6 +214,15 @@ namespace Blokus::Server {
             boost::system::error_code ec;
             acceptor_.close(ec);
         }
+        if (metricsEndpoint_) {
+            metricsEndpoint_->stop();
+        }
+        if (signals_) {
+            boost::system::error_code ec;
+            signals_->cancel(ec);
+        }
+        ServerMetrics::instance().setCollector(nullptr);
+        stopCluster();
 
         // 2. 서비스들 정리
         cleanupServices();
@@ -170,15 +253,143 @@ namespace Blokus::Server {
         }
 
         // 6. IO 컨텍스트 종료
+        for (auto& acceptor : shardAcceptors_) {
+            boost::system::error_code ec;
+            acceptor->close(ec);
+        }
+        if (ioContextPool_) {
+            ioContextPool_->stop();
+        }
         ioContext_.stop();
 
-        // 7. 스레드 풀 정리는 run() 메서드에서 처리됨
-        // 여기서는 threadPool_ 컨테이너만 정리
+        // 7. 스레드 풀 정리 (stop()은 run()을 실행한 스레드나 소멸자에서만 호출되므로 풀 스레드가 아님)
+        for (auto& thread : threadPool_) {
+            if (thread.joinable() && thread.get_id() != std::this_thread::get_id()) {
+                thread.join();
+            }
+        }
         threadPool_.clear();
 
         spdlog::info("GameServer 종료 완료");
     }
 
+    void GameServer::drain() {
+        if (!running_.load() || draining_.exchange(true)) {
+            return;
+        }
+
+        spdlog::info("GameServer 드레인 종료 시작");
+
+        // 1. 새로운 연결 차단 (기존 연결은 안내 메시지를 보낼 때까지 유지)
+        {
+            boost::system::error_code ec;
+            if (acceptor_.is_open()) {
+                acceptor_.close(ec);
+            }
+            for (auto& acceptor : shardAcceptors_) {
+                acceptor->close(ec);
+            }
+        }
+
+        // 2. 로그인한 모든 클라이언트에 재접속 안내 (방/게임 중인 사용자는 다시 로그인하면 같은 좌석으로 복귀)
+        std::string hint = "SERVER_DRAINING:" + std::to_string(std::max(0, ConfigManager::drainReconnectHintSeconds));
+        std::vector<std::shared_ptr<Session>> notified;
+        {
+            std::lock_guard<std::mutex> lock(sessionsMutex_);
+            for (const auto& [sessionId, session] : sessions_) {
+                if (session && session->isActive() && session->isAuthenticated()) {
+                    session->sendMessage(hint);
+                    notified.push_back(session);
+                }
+            }
+        }
+
+        // 3. 진행 중인 방을 다음 프로세스로 넘김 (내보낸 방은 이후 배치/타임아웃을 받지 않음)
+        size_t migrated = 0;
+        if (roomManager_) {
+            auto snapshots = roomManager_->exportPlayingRooms();
+            if (!snapshots.empty()) {
+                RoomMigrationStore store(ConfigManager::drainSnapshotFile);
+                if (store.save(snapshots)) {
+                    migrated = snapshots.size();
+                    ServerMetrics::instance().roomsMigratedOut.add(migrated);
+                }
+            }
+        }
+
+        spdlog::info("드레인: 재접속 안내 {}명, 이전한 방 {}개", notified.size(), migrated);
+
+        // 4. 안내 메시지가 모든 송신 큐에서 나갈 때까지 (최대 DRAIN_FLUSH_TIMEOUT_MS) 기다린 뒤 종료
+        size_t unflushed = waitForSendQueues(notified,
+            std::chrono::milliseconds(std::max(0, ConfigManager::drainFlushTimeoutMs)));
+        if (unflushed > 0) {
+            spdlog::warn("드레인: 송신 큐를 비우지 못한 세션 {}개 (제한 시간 {}ms)", unflushed, ConfigManager::drainFlushTimeoutMs);
+        }
+        stop();
+    }
+
+    namespace {
+        // 드레인 송신 큐 확인 (ioContext_ 타이머로 주기 확인, 다 비었거나 기한이 지나면 남은 세션 수 전달)
+        struct SendQueueFlushWait : std::enable_shared_from_this<SendQueueFlushWait> {
+            SendQueueFlushWait(boost::asio::io_context& io, std::vector<std::shared_ptr<Session>> targets,
+                std::chrono::steady_clock::time_point until)
+                : timer(io), sessions(std::move(targets)), deadline(until) {}
+
+            size_t countPending() const {
+                return static_cast<size_t>(std::count_if(sessions.begin(), sessions.end(),
+                    [](const std::shared_ptr<Session>& session) {
+                        return session->isActive() && session->getPendingMessageCount() > 0;
+                    }));
+            }
+
+            void poll() {
+                size_t pending = countPending();
+                if (pending == 0 || std::chrono::steady_clock::now() >= deadline) {
+                    done.set_value(pending);
+                    return;
+                }
+                timer.expires_after(std::chrono::milliseconds(20));
+                timer.async_wait([self = shared_from_this()](const boost::system::error_code& error) {
+                    if (error) {
+                        self->done.set_value(self->countPending());
+                        return;
+                    }
+                    self->poll();
+                });
+            }
+
+            boost::asio::steady_timer timer;
+            std::vector<std::shared_ptr<Session>> sessions;
+            std::chrono::steady_clock::time_point deadline;
+            std::promise<size_t> done;
+        };
+    }
+
+    size_t GameServer::waitForSendQueues(const std::vector<std::shared_ptr<Session>>& sessions,
+        std::chrono::milliseconds timeout) {
+        auto wait = std::make_shared<SendQueueFlushWait>(ioContext_, sessions, std::chrono::steady_clock::now() + timeout);
+        auto result = wait->done.get_future();
+        boost::asio::post(ioContext_, [wait]() { wait->poll(); });
+
+        // io 스레드가 멈춰 타이머가 돌지 않는 경우에도 제한 시간 + 여유 뒤에는 진행
+        if (result.wait_for(timeout + std::chrono::milliseconds(500)) != std::future_status::ready) {
+            return wait->countPending();
+        }
+        return result.get();
+    }
+
+    void GameServer::requestShutdown(bool drainFirst) {
+        {
+            std::lock_guard<std::mutex> lock(shutdownMutex_);
+            if (shutdownRequested_) {
+                return;
+            }
+            shutdownRequested_ = true;
+            drainRequested_ = drainFirst;
+        }
+        shutdownCv_.notify_all();
+    }
+
     void GameServer::run() {
         spdlog::debug(" [DEBUG] run() 메서드 시작");
 
@@ -194,16 +405,27 @@ namespace Blokus::Server {
         spdlog::info("서버가 실행 중입니다. Ctrl+C로 종료하세요");
         spdlog::debug(" [DEBUG] 메인 스레드에서 대기 중...");
 
+        // 종료 요청이 올 때까지 대기한 뒤 이 스레드에서 드레인/종료 수행
+        bool drainFirst = false;
+        {
+            std::unique_lock<std::mutex> lock(shutdownMutex_);
+            shutdownCv_.wait(lock, [this] { return shutdownRequested_ || !running_.load(); });
+            drainFirst = drainRequested_;
+        }
+
         try {
-            for (auto& thread : threadPool_) {
-                if (thread.joinable()) {
-                    thread.join();
-                }
+            if (drainFirst) {
+                spdlog::info("서버 드레인 종료 수행");
+                drain();
+            }
+            else {
+                spdlog::info("서버 종료 수행");
+                stop();
             }
             spdlog::debug(" [DEBUG] 모든 스레드 종료 완료");
         }
         catch (const std::exception& e) {
-            spdlog::error("스레드 대기 중 예외: {}", e.what());
+            spdlog::error("서버 종료 중 예외: {}", e.what());
         }
 
         spdlog::debug(" [DEBUG] run() 메서드 종료");
@@ -314,16 +536,11 @@ namespace Blokus::Server {
         const std::string& sessionId = session->getSessionId();
         sessions_[sessionId] = session;
 
-        // 통계 업데이트 (스레드 안전)
+        // 통계 업데이트 (잠금 없는 카운터)
         {
-            std::lock_guard<std::mutex> statsLock(statsMutex_);
-            stats_.currentConnections++;
-            stats_.totalConnectionsToday++;
-
-            // 피크 연결 수 업데이트
-            if (stats_.currentConnections > stats_.peakConcurrentConnections) {
-                stats_.peakConcurrentConnections = stats_.currentConnections;
-            }
+            auto& metrics = ServerMetrics::instance();
+            metrics.connectionsAccepted.add();
+            metrics.connectionsPeak.updateMax(metrics.connectionsCurrent.add(1));
         }
 
         spdlog::debug("새 세션 추가: {} (총 연결: {})",
@@ -368,12 +585,7 @@ namespace Blokus::Server {
             sessions_.erase(it);
 
             // 통계 업데이트
-            {
-                std::lock_guard<std::mutex> statsLock(statsMutex_);
-                if (stats_.currentConnections > 0) {
-                    stats_.currentConnections--;
-                }
-            }
+            ServerMetrics::instance().connectionsCurrent.add(-1);
 
             spdlog::debug("세션 제거: {} (남은 연결: {})",
                 sessionId, getCurrentConnections());
@@ -491,6 +703,12 @@ namespace Blokus::Server {
             }
             spdlog::info("AuthenticationService 초기화 완료");
 
+            // Argon2 해싱/검증 전용 실행기 (I/O 스레드 점유 방지)
+            cryptoExecutor_ = std::make_unique<CryptoExecutor>(
+                static_cast<size_t>(std::max(1, ConfigManager::cryptoThreads)),
+                static_cast<size_t>(std::max(1, ConfigManager::cryptoQueueLimit)),
+                static_cast<size_t>(std::max(1, ConfigManager::cryptoPerClientLimit)));
+
             // RoomManager 초기화
             roomManager_ = std::make_unique<RoomManager>();
             if (!roomManager_) {
@@ -500,8 +718,60 @@ namespace Blokus::Server {
             
             // RoomManager에 DatabaseManager 설정
             roomManager_->setDatabaseManager(databaseManager_);
+            if (ConfigManager::clusterEnabled) {
+                // 노드마다 방 ID 대역을 나눠 다른 노드의 방과 ID가 겹치지 않게 함
+                roomManager_->setRoomIdBase(1001 + std::max(0, ConfigManager::clusterNodeIndex) * ClusterManager::ROOM_ID_STRIDE);
+            }
             spdlog::info("RoomManager 초기화 완료 (DB 연결 포함)");
 
+            // DB 비동기 실행기 초기화 (DB 없이 실행 시 생략)
+            if (databaseManager_) {
+                databaseExecutor_ = std::make_unique<DatabaseExecutor>(
+                    databaseManager_, static_cast<size_t>(std::max(1, ConfigManager::dbExecutorThreads)));
+            }
+
+            // 게임 결과 비동기 저장 큐 + 사용자 통계 캐시 초기화 (DB 없이 실행 시 생략)
+            if (databaseManager_) {
+                userStatsCache_ = std::make_shared<UserStatsCache>(
+                    databaseManager_, static_cast<size_t>(std::max(1, ConfigManager::userStatsCacheMaxEntries)));
+
+                gameResultPersister_ = std::make_shared<GameResultPersister>(databaseManager_);
+                gameResultPersister_->setUserStatsCache(userStatsCache_);
+                if (!gameResultPersister_->initialize()) {
+                    spdlog::error("GameResultPersister 초기화 실패");
+                    return false;
+                }
+                roomManager_->setGameResultPersister(gameResultPersister_);
+            }
+
+            // 세션 재개 (연결이 끊긴 방/게임 좌석을 유예 시간 동안 보류)
+            if (ConfigManager::resumeEnabled) {
+                resumeRegistry_ = std::make_unique<SessionResumeRegistry>(
+                    std::chrono::seconds(std::max(1, ConfigManager::resumeGraceSeconds)));
+                spdlog::info("세션 재개 활성화 (유예 시간: {}초)", ConfigManager::resumeGraceSeconds);
+            }
+
+            // 이전 프로세스가 드레인 종료하며 넘긴 방 (게임 결과 저장 큐 설정 후 복원)
+            restoreMigratedRooms();
+
+            // 채팅 (로비 채팅은 짧은 구간 단위로 모아 수신자마다 프레임 1개로 전송)
+            ChatService::Options chatOptions;
+            chatOptions.ratePerSecond = std::max(1, ConfigManager::chatRatePerSecond);
+            chatOptions.burst = std::max(1, ConfigManager::chatBurst);
+            chatOptions.batchWindow = std::chrono::milliseconds(std::max(1, ConfigManager::chatBatchWindowMs));
+            chatOptions.historySize = static_cast<size_t>(std::max(0, ConfigManager::chatHistorySize));
+            chatService_ = std::make_unique<ChatService>(ioContext_, chatOptions, [this]() {
+                return getActualLobbyUsers();
+            });
+
+            // 입장 제어 (개발 모드는 같은 IP에서 봇을 여러 개 띄우므로 IP 한도 없음)
+            AdmissionController::Options admissionOptions;
+            admissionOptions.ipConnectPerMinute = std::max(1, ConfigManager::admissionIpConnectPerMinute);
+            admissionOptions.ipConnectBurst = std::max(1, ConfigManager::admissionIpConnectBurst);
+            admissionOptions.maxUnauthenticated = static_cast<size_t>(std::max(1, ConfigManager::admissionMaxUnauthenticated));
+            admissionOptions.limitIpRate = !ConfigManager::debugMode;
+            admissionController_ = std::make_unique<AdmissionController>(admissionOptions);
+
             // VersionManager 초기화
             versionManager_ = std::make_unique<VersionManager>();
             spdlog::info("VersionManager 초기화 완료");
@@ -518,13 +788,52 @@ namespace Blokus::Server {
     bool GameServer::initializeNetwork() {
         try {
             tcp::endpoint endpoint(tcp::v4(), ConfigManager::serverPort);
-            acceptor_.open(endpoint.protocol());
-            acceptor_.set_option(tcp::acceptor::reuse_address(true));
-            acceptor_.bind(endpoint);
-            acceptor_.listen(boost::asio::socket_base::max_listen_connections);
 
-            spdlog::info("네트워크 초기화 완료 - {}:{}",
-                endpoint.address().to_string(), endpoint.port());
+            // I/O 모델: per_core = 코어마다 io_context 1개 (세션 고정), shared = io_context 1개를 스레드 풀이 공유
+            if (ConfigManager::ioModel == "per_core") {
+                ioContextPool_ = std::make_unique<IoContextPool>(
+                    static_cast<size_t>(std::max(1, ConfigManager::threadPoolSize)));
+                openShardAcceptors(endpoint);
+            }
+
+            // 공유 모드, 또는 SO_REUSEPORT를 쓸 수 없는 경우 단일 리스너 (코어별 모드면 수락 후 코어에 분배)
+            if (shardAcceptors_.empty()) {
+                acceptor_.open(endpoint.protocol());
+                acceptor_.set_option(tcp::acceptor::reuse_address(true));
+                acceptor_.bind(endpoint);
+                acceptor_.listen(boost::asio::socket_base::max_listen_connections);
+            }
+
+            // 네트워크 백엔드: asio 리액터는 빌드 시 결정, 등록 버퍼 사용 여부는 런타임 설정
+            const std::string compiledBackend = RegisteredBufferPool::compiledBackend();
+            const std::string& requestedBackend = ConfigManager::networkBackend;
+            if (requestedBackend == "io_uring" && compiledBackend != "io_uring") {
+                spdlog::warn("io_uring 미지원 빌드 - epoll 사용 (BLOKUS_ENABLE_IO_URING=ON 빌드 필요)");
+            }
+            else if (requestedBackend == "epoll" && compiledBackend == "io_uring") {
+                spdlog::warn("io_uring 빌드는 소켓 리액터를 바꿀 수 없음 - 등록 버퍼만 비활성화");
+            }
+
+            if (compiledBackend == "io_uring" && requestedBackend != "epoll" &&
+                ConfigManager::ioUringRegisteredBuffers > 0) {
+                // 등록 버퍼는 io_uring 인스턴스(io_context)마다 따로 등록해야 함
+                size_t coreCount = ioContextPool_ ? ioContextPool_->size() : 1;
+                size_t slotsPerCore = std::max<size_t>(1, static_cast<size_t>(ConfigManager::ioUringRegisteredBuffers) / coreCount);
+                for (size_t i = 0; i < coreCount; ++i) {
+                    readBufferPools_.push_back(std::make_shared<RegisteredBufferPool>(
+                        ioContextPool_ ? ioContextPool_->context(i) : ioContext_, slotsPerCore, Session::MAX_MESSAGE_LENGTH));
+                }
+            }
+
+            size_t registeredSlots = 0;
+            for (const auto& pool : readBufferPools_) {
+                registeredSlots += pool->isRegistered() ? pool->capacity() : 0;
+            }
+
+            spdlog::info("네트워크 초기화 완료 - {}:{} (백엔드: {}, 등록 버퍼: {}, I/O 모델: {} x{}, 리스너: {})",
+                endpoint.address().to_string(), endpoint.port(), compiledBackend, registeredSlots,
+                ioContextPool_ ? "per_core" : "shared", ioContextPool_ ? ioContextPool_->size() : 1,
+                shardAcceptors_.empty() ? "단일" : "SO_REUSEPORT");
             return true;
         }
         catch (const std::exception& e) {
@@ -537,19 +846,83 @@ namespace Blokus::Server {
     // 네트워크 처리
     // ========================================
 
+    bool GameServer::openShardAcceptors(const tcp::endpoint& endpoint) {
+#if defined(__linux__) && defined(SO_REUSEPORT)
+        using reuse_port = boost::asio::detail::socket_option::boolean<SOL_SOCKET, SO_REUSEPORT>;
+
+        try {
+            // 코어마다 같은 포트에 리스너를 열고 커널이 연결을 분산 (수락한 코어에 세션 고정)
+            for (size_t i = 0; i < ioContextPool_->size(); ++i) {
+                auto acceptor = std::make_unique<tcp::acceptor>(ioContextPool_->context(i));
+                acceptor->open(endpoint.protocol());
+                acceptor->set_option(tcp::acceptor::reuse_address(true));
+                acceptor->set_option(reuse_port(true));
+                acceptor->bind(endpoint);
+                acceptor->listen(boost::asio::socket_base::max_listen_connections);
+                shardAcceptors_.push_back(std::move(acceptor));
+            }
+            return true;
+        }
+        catch (const std::exception& e) {
+            spdlog::warn("SO_REUSEPORT 리스너 생성 실패, 단일 리스너 사용: {}", e.what());
+            shardAcceptors_.clear();
+            return false;
+        }
+#else
+        (void)endpoint;
+        return false;
+#endif
+    }
+
     void GameServer::startAccepting() {
         if (!running_.load()) {
             return;
         }
 
-        auto newSession = std::make_shared<Session>(tcp::socket(ioContext_), this);
+        if (ioContextPool_) {
+            // 새 소켓을 라운드로빈으로 고른 코어의 io_context에 바로 생성
+            size_t coreIndex = ioContextPool_->nextIndex();
+            acceptor_.async_accept(ioContextPool_->context(coreIndex),
+                [this, coreIndex](const boost::system::error_code& error, tcp::socket socket) {
+                    auto newSession = Session::create(std::move(socket), this);
+                    newSession->setCoreIndex(static_cast<int>(coreIndex));
+                    handleNewConnection(newSession, error);
+                    startAccepting();
+                });
+            return;
+        }
+
+        auto newSession = Session::create(tcp::socket(ioContext_), this);
 
         acceptor_.async_accept(newSession->getSocket(),
             [this, newSession](const boost::system::error_code& error) {
                 handleNewConnection(newSession, error);
+                startAccepting();
+            });
+    }
+
+    void GameServer::startShardAccepting(size_t coreIndex) {
+        if (!running_.load() || coreIndex >= shardAcceptors_.size()) {
+            return;
+        }
+
+        shardAcceptors_[coreIndex]->async_accept(
+            [this, coreIndex](const boost::system::error_code& error, tcp::socket socket) {
+                auto newSession = Session::create(std::move(socket), this);
+                newSession->setCoreIndex(static_cast<int>(coreIndex));
+                handleNewConnection(newSession, error);
+                startShardAccepting(coreIndex);
             });
     }
 
+    std::shared_ptr<RegisteredBufferPool> GameServer::getReadBufferPool(int coreIndex) const {
+        if (readBufferPools_.empty()) {
+            return nullptr;
+        }
+        size_t index = coreIndex < 0 ? 0 : static_cast<size_t>(coreIndex);
+        return index < readBufferPools_.size() ? readBufferPools_[index] : nullptr;
+    }
+
     void GameServer::handleNewConnection(std::shared_ptr<Session> session,
         const boost::system::error_code& error) {
         if (!running_.load()) {
@@ -565,8 +938,23 @@ namespace Blokus::Server {
                 if (getCurrentConnections() >= ConfigManager::maxClients) {
                     spdlog::warn("최대 연결 수 초과, 연결 거부: {}", remoteAddr);
                     session->stop();
+                    return;
+                }
+
+                // 입장 제어 (세션 시작 전에 거부하므로 읽기/메시지 처리 비용 없음)
+                auto decision = admissionController_
+                    ? admissionController_->admit(session->getRemoteIP())
+                    : AdmissionController::Decision::Admitted;
+                if (decision != AdmissionController::Decision::Admitted) {
+                    spdlog::debug("입장 제어로 연결 거부 ({}): {}",
+                        decision == AdmissionController::Decision::IpRateLimited ? "IP 연결 속도" : "미인증 세션 수",
+                        remoteAddr);
+                    session->stop();
                 }
                 else {
+                    if (admissionController_) {
+                        session->holdAdmissionSlot();
+                    }
                     addSession(session);
                     session->start();
                 }
@@ -579,8 +967,7 @@ namespace Blokus::Server {
             spdlog::error("연결 수락 오류: {}", error.message());
         }
 
-        // 다음 연결 대기
-        startAccepting();
+        // 다음 연결 대기는 호출한 리스너 쪽에서 이어서 등록
     }
 
     // ========================================
@@ -595,10 +982,14 @@ namespace Blokus::Server {
         bool wasInRoom = false;
         bool wasInGame = false;
         int roomId = -1;
+        int spectatingRoomId = -1;
+        std::shared_ptr<Session> session;
         {
             std::lock_guard<std::mutex> lock(sessionsMutex_);
             auto it = sessions_.find(sessionId);
             if (it != sessions_.end()) {
+                session = it->second;
+                spectatingRoomId = it->second->getSpectatingRoomId();
                 username = it->second->getUsername();
                 userId = it->second->getUserId();
                 wasInLobby = it->second->isInLobby();
@@ -610,6 +1001,33 @@ namespace Blokus::Server {
             }
         }
         
+        // 관전 중이던 방의 관전 채널에서 제거 (방 뮤텍스 사용 안 함)
+        if (spectatingRoomId >= 0 && roomManager_) {
+            if (auto room = roomManager_->getRoom(spectatingRoomId)) {
+                if (auto channel = room->getSpectatorChannel()) {
+                    channel->removeViewer(sessionId);
+                }
+            }
+        }
+
+        // 세션 재개로 새 연결이 좌석을 넘겨받은 경우 방 퇴장 / 로비 알림 없음
+        if (session && session->isSuperseded()) {
+            spdlog::debug("재개된 이전 세션 종료: {} ({})", sessionId, username);
+            return;
+        }
+
+        // 방/게임 중 연결 끊김은 좌석을 유예 시간 동안 보류 (resume:토큰으로 재개하지 않으면 expireResumeSeats에서 퇴장)
+        if (resumeRegistry_ && !userId.empty()) {
+            if ((wasInRoom || wasInGame) && session && resumeRegistry_->park(userId, sessionId, roomId)) {
+                // 유예 중 같은 계정의 새 로그인이 중복 로그인으로 막히지 않도록 추적에서만 제외
+                session->releaseActiveRegistration();
+                spdlog::info("방 {} 좌석 보류: {} ({}초 동안 재개 대기)", roomId, username,
+                    resumeRegistry_->getGraceWindow().count());
+                return;
+            }
+            resumeRegistry_->revoke(userId);
+        }
+
         //  데드락 방지: 잠금 해제 후 방 정리 (데드락 위험 제거)
         if ((wasInRoom || wasInGame) && !userId.empty() && roomManager_) {
             try {
@@ -625,6 +1043,11 @@ namespace Blokus::Server {
             }
         }
         
+        // 로그아웃한 사용자의 미반영 게임 결과는 주기를 기다리지 않고 바로 DB에 반영
+        if (!userId.empty() && gameResultPersister_) {
+            gameResultPersister_->requestFlush();
+        }
+
         // 로비 브로드캐스트 (잠금 없는 작업)
         if (wasInLobby && !username.empty()) {
             try {
@@ -647,12 +1070,7 @@ namespace Blokus::Server {
     }
 
     void GameServer::onSessionMessage(const std::string& sessionId, const std::string& message) {
-        // 통계 업데이트
-        {
-            std::lock_guard<std::mutex> lock(statsMutex_);
-            stats_.messagesReceived++;
-        }
-
+        // 수신 통계는 Session::handleRead에서 집계
         spdlog::debug("세션 {}에서 메시지 수신: {}", sessionId,
             message.length() > 50 ? message.substr(0, 50) + "..." : message);
     }
@@ -679,6 +1097,32 @@ namespace Blokus::Server {
         }
     }
     
+    std::vector<std::string> GameServer::collectLocalLobbyRows() const {
+        std::vector<std::string> rows;
+        for (const auto& lobbySession : getLobbyUsers()) {
+            if (lobbySession && lobbySession->isActive() && !lobbySession->getUsername().empty()) {
+                rows.push_back(lobbySession->getUsername() + "," + lobbySession->getDisplayName() + "," +
+                    std::to_string(lobbySession->getUserLevel()) + "," + lobbySession->getUserStatusString());
+            }
+        }
+        return rows;
+    }
+
+    std::string GameServer::buildLobbyUserListMessage() const {
+        auto rows = collectLocalLobbyRows();
+        if (clusterManager_) {
+            auto remoteRows = clusterManager_->getRemoteLobbyRows();
+            rows.insert(rows.end(), remoteRows.begin(), remoteRows.end());
+        }
+
+        std::string message = "LOBBY_USER_LIST:" + std::to_string(rows.size());
+        for (const auto& row : rows) {
+            message += ':';
+            message += row;
+        }
+        return message;
+    }
+
     void GameServer::broadcastLobbyUserListPeriodically() {
         try {
             auto lobbyUsers = getLobbyUsers();
@@ -688,23 +1132,7 @@ namespace Blokus::Server {
             }
             
             // LOBBY_USER_LIST 메시지 생성
-            std::ostringstream response;
-            response << "LOBBY_USER_LIST:" << lobbyUsers.size();
-            
-            int validUserCount = 0;
-            for (const auto& lobbySession : lobbyUsers) {
-                if (lobbySession && lobbySession->isActive() && !lobbySession->getUsername().empty()) {
-                    std::string username = lobbySession->getUsername();
-                    std::string displayName = lobbySession->getDisplayName();
-                    int userLevel = lobbySession->getUserLevel();
-                    std::string userStatus = lobbySession->getUserStatusString();
-                    
-                    response << ":" << username << "," << displayName << "," << userLevel << "," << userStatus;
-                    validUserCount++;
-                }
-            }
-            
-            std::string message = response.str();
+            std::string message = buildLobbyUserListMessage();
             
             // 모든 로비 사용자에게 브로드캐스트
             int sentCount = 0;
@@ -750,6 +1178,19 @@ namespace Blokus::Server {
         heartbeatTimer_->async_wait([this](const boost::system::error_code& error) {
             if (!error && running_.load()) {
                 cleanupSessions();
+                expireResumeSeats();
+                if (roomManager_) {
+                    roomManager_->expireMigratedSeats(std::chrono::steady_clock::now()); // 돌아오지 않은 복원 좌석
+                }
+                if (chatService_) {
+                    chatService_->pruneIdleBuckets();
+                }
+                if (admissionController_) {
+                    admissionController_->pruneIdleBuckets();
+                }
+                if (clusterManager_) {
+                    clusterManager_->tick(); // 노드 상태 발행 + 응답 없는 노드 정리
+                }
                 broadcastLobbyUserListPeriodically(); // 주기적 로비 사용자 목록 브로드캐스트
                 logServerStats(); // 통계 로그
                 handleHeartbeat(); // 다음 하트비트 예약
@@ -806,12 +1247,7 @@ namespace Blokus::Server {
                     it = sessions_.erase(it);
 
                     // 통계 업데이트
-                    {
-                        std::lock_guard<std::mutex> statsLock(statsMutex_);
-                        if (stats_.currentConnections > 0) {
-                            stats_.currentConnections--;
-                        }
-                    }
+                    ServerMetrics::instance().connectionsCurrent.add(-1);
                 }
                 else {
                     // 타임아웃 체크 - 게임 중인 세션은 더 짧은 타임아웃 적용
@@ -839,6 +1275,11 @@ namespace Blokus::Server {
                         info.wasInRoom = it->second->isInRoom();
                         info.wasInGame = it->second->isInGame();
                         info.roomId = -1;
+
+                        // 응답 없는 연결은 좌석을 보류하지 않고 바로 정리
+                        if (resumeRegistry_ && !info.userId.empty()) {
+                            resumeRegistry_->revoke(info.userId);
+                        }
                         if (info.wasInRoom || info.wasInGame) {
                             info.roomId = it->second->getCurrentRoomId();
                         }
@@ -847,12 +1288,7 @@ namespace Blokus::Server {
                         it = sessions_.erase(it);
 
                         // 통계 업데이트
-                        {
-                            std::lock_guard<std::mutex> statsLock(statsMutex_);
-                            if (stats_.currentConnections > 0) {
-                                stats_.currentConnections--;
-                            }
-                        }
+                        ServerMetrics::instance().connectionsCurrent.add(-1);
                         
                         spdlog::debug(" [ASYNC_CLEANUP] 타임아웃 세션 {} 비동기 정리 예약", sessionId);
                     }
@@ -904,9 +1340,179 @@ namespace Blokus::Server {
         }
     }
 
+    // ========================================
+    // 세션 재개
+    // ========================================
+
+    std::string GameServer::issueResumeToken(const std::shared_ptr<Session>& session) {
+        if (!resumeRegistry_ || !session || !session->isAuthenticated()) {
+            return "";
+        }
+
+        // 유예 중이던 이전 좌석을 재개하지 않고 새로 로그인한 경우 이전 좌석은 바로 정리
+        std::optional<SessionResumeRegistry::Ticket> replaced;
+        std::string token = resumeRegistry_->issue(session, &replaced);
+        if (replaced && replaced->roomId >= 0 && roomManager_) {
+            spdlog::info("새 로그인으로 방 {} 보류 좌석 정리: {}", replaced->roomId, replaced->username);
+            roomManager_->leaveRoom(replaced->roomId, replaced->userId);
+        }
+        return token;
+    }
+
+    void GameServer::expireResumeSeats() {
+        if (!resumeRegistry_) {
+            return;
+        }
+
+        auto expired = resumeRegistry_->collectExpired();
+        for (const auto& ticket : expired) {
+            ServerMetrics::instance().sessionResumeExpired.add();
+            if (ticket.roomId < 0 || !roomManager_) {
+                continue;
+            }
+
+            try {
+                spdlog::info("방 {} 보류 좌석 만료로 퇴장: {}", ticket.roomId, ticket.username);
+                roomManager_->leaveRoom(ticket.roomId, ticket.userId);
+            }
+            catch (const std::exception& e) {
+                spdlog::error(" 보류 좌석 정리 중 오류 ({}): {}", ticket.username, e.what());
+            }
+        }
+
+        // 보류 중 게임 결과가 있었다면 주기를 기다리지 않고 반영
+        if (!expired.empty() && gameResultPersister_) {
+            gameResultPersister_->requestFlush();
+        }
+    }
+
+    void GameServer::restoreMigratedRooms() {
+        if (!roomManager_) {
+            return;
+        }
+
+        RoomMigrationStore store(ConfigManager::drainSnapshotFile);
+        auto snapshots = store.consume(std::chrono::seconds(std::max(1, ConfigManager::drainSnapshotMaxAgeSeconds)));
+        if (snapshots.empty()) {
+            return;
+        }
+
+        auto seatGrace = std::chrono::seconds(std::max(1, ConfigManager::migrationSeatGraceSeconds));
+        size_t restored = 0;
+        for (const auto& snapshot : snapshots) {
+            if (roomManager_->restoreRoom(snapshot, seatGrace)) {
+                ++restored;
+            }
+        }
+
+        ServerMetrics::instance().roomsMigratedIn.add(restored);
+        spdlog::info("이전 프로세스의 진행 중인 방 복원: {}/{}개 (재접속 유예: {}초)",
+            restored, snapshots.size(), seatGrace.count());
+    }
+
+    // ========================================
+    // 클러스터 모드
+    // ========================================
+
+    bool GameServer::startCluster() {
+        // 중계 서버를 이 노드가 함께 띄우는 경우 (외부 메시지 브로커 대신)
+        if (ConfigManager::clusterBrokerListen && ConfigManager::clusterBus == "tcp") {
+            clusterBroker_ = std::make_unique<ClusterBroker>(ioContext_);
+            if (!clusterBroker_->start(ConfigManager::clusterBrokerBindAddress, ConfigManager::clusterBusPort)) {
+                clusterBroker_.reset();
+                return false;
+            }
+        }
+
+        std::shared_ptr<ClusterBus> bus;
+        if (ConfigManager::clusterBus == "inproc") {
+            bus = std::make_shared<InProcessClusterBus>(ioContext_, ConfigManager::clusterNodeId);
+        }
+        else {
+            bus = std::make_shared<TcpClusterBus>(ioContext_, ConfigManager::clusterNodeId,
+                ConfigManager::clusterBusHost, ConfigManager::clusterBusPort);
+        }
+
+        ClusterManager::Options options;
+        options.nodeId = ConfigManager::clusterNodeId;
+        options.publicHost = ConfigManager::clusterPublicHost;
+        options.publicPort = ConfigManager::serverPort;
+        options.nodeTimeout = std::chrono::seconds(std::max(1, ConfigManager::clusterNodeTimeoutSeconds));
+        clusterManager_ = std::make_unique<ClusterManager>(std::move(options), std::move(bus));
+
+        clusterManager_->setRoomRowSink([this](int roomId, const std::string* row) {
+            if (roomManager_) {
+                roomManager_->applyRemoteRoomListRow(roomId, row);
+            }
+        });
+        clusterManager_->setConflictHandler([this](const std::string& userId, const std::string& winnerNodeId) {
+            dropSessionForRemoteLogin(userId, winnerNodeId);
+        });
+        clusterManager_->setLobbyRosterProvider([this]() {
+            return collectLocalLobbyRows();
+        });
+
+        // 로컬 방 목록 변경을 다른 노드로 전달 (방 목록 락 안에서 호출되므로 발행만 수행)
+        ClusterManager* cluster = clusterManager_.get();
+        roomManager_->setRoomListListener([cluster](int roomId, const std::string* row) {
+            cluster->publishRoomRow(roomId, row);
+        });
+
+        if (!clusterManager_->start()) {
+            roomManager_->setRoomListListener(nullptr);
+            clusterManager_.reset();
+            clusterBroker_.reset();
+            return false;
+        }
+        return true;
+    }
+
+    void GameServer::stopCluster() {
+        if (roomManager_) {
+            roomManager_->setRoomListListener(nullptr);
+        }
+        // 세션 소멸 시 releaseUser 호출이 남아 있으므로 객체는 서버 소멸 시까지 유지 (stop 이후 발행은 무시됨)
+        if (clusterManager_) {
+            clusterManager_->stop();
+        }
+        if (clusterBroker_) {
+            clusterBroker_->stop();
+        }
+    }
+
+    void GameServer::dropSessionForRemoteLogin(const std::string& userId, const std::string& winnerNodeId) {
+        std::shared_ptr<Session> target;
+        {
+            std::lock_guard<std::mutex> lock(sessionsMutex_);
+            for (const auto& [sessionId, session] : sessions_) {
+                if (session && session->getUserId() == userId) {
+                    target = session;
+                    break;
+                }
+            }
+        }
+        if (!target) {
+            return;
+        }
+
+        spdlog::warn("다른 노드({})의 동시 로그인에 밀려 세션 종료: {} (사용자: {})", winnerNodeId, target->getSessionId(), userId);
+        target->sendMessage("ERROR:DUPLICATE_USER_DIFFERENT_IP:해당 계정이 이미 다른 위치에서 로그인되어 있습니다");
+        // 전송 큐가 비워질 기회를 준 뒤 종료 (버스 strand를 막지 않도록 io_context로 넘김)
+        boost::asio::post(ioContext_, [target]() {
+            target->stop();
+        });
+    }
+
     void GameServer::cleanupServices() {
         spdlog::info("서비스 리소스 정리 시작");
 
+        // CryptoExecutor 정리 (실행 중인 작업이 AuthenticationService를 참조하므로 먼저 종료)
+        if (cryptoExecutor_) {
+            cryptoExecutor_->shutdown();
+            cryptoExecutor_.reset();
+            spdlog::info("CryptoExecutor 정리 완료");
+        }
+
         // AuthenticationService 정리
         if (authService_) {
             authService_->shutdown();
@@ -914,13 +1520,36 @@ namespace Blokus::Server {
             spdlog::info("AuthenticationService 정리 완료");
         }
 
+        // 채팅 배치 타이머 정리
+        if (chatService_) {
+            chatService_->stop();
+        }
+
         // RoomManager 정리
         if (roomManager_) {
-            roomManager_->broadcastToAllRooms("SERVER_SHUTDOWN");
+            // 드레인 종료면 이미 SERVER_DRAINING으로 재접속을 안내함
+            if (!draining_.load()) {
+                roomManager_->broadcastToAllRooms("SERVER_SHUTDOWN");
+            }
             roomManager_.reset();
             spdlog::info("RoomManager 정리 완료");
         }
 
+        // DatabaseExecutor 정리 (제출된 DB 작업 완료 대기)
+        if (databaseExecutor_) {
+            databaseExecutor_->shutdown();
+            databaseExecutor_.reset();
+            spdlog::info("DatabaseExecutor 정리 완료");
+        }
+
+        // GameResultPersister 정리 (DB 종료 전에 남은 결과 저장, 실패분은 디스크 기록)
+        if (gameResultPersister_) {
+            gameResultPersister_->shutdown();
+            gameResultPersister_.reset();
+            spdlog::info("GameResultPersister 정리 완료");
+        }
+        userStatsCache_.reset();
+
         // DatabaseManager 정리
         if (databaseManager_) {
             databaseManager_->shutdown();
@@ -931,25 +1560,68 @@ namespace Blokus::Server {
         spdlog::info("서비스 리소스 정리 완료");
     }
 
+    int GameServer::getCurrentConnections() const {
+        return static_cast<int>(ServerMetrics::instance().connectionsCurrent.value());
+    }
+
+    ServerStats GameServer::getStats() const {
+        auto& metrics = ServerMetrics::instance();
+
+        ServerStats stats;
+        stats.currentConnections = static_cast<int>(metrics.connectionsCurrent.value());
+        stats.totalConnectionsToday = static_cast<int>(metrics.connectionsAccepted.value());
+        stats.peakConcurrentConnections = static_cast<int>(metrics.connectionsPeak.value());
+        stats.activeRooms = roomManager_ ? static_cast<int>(roomManager_->getRoomCount()) : 0;
+        stats.totalGamesToday = static_cast<int>(metrics.gamesStarted.value());
+        stats.messagesReceived = metrics.messagesReceived.value();
+        stats.messagesSent = metrics.messagesSent.value();
+        stats.bytesReceived = metrics.bytesReceived.value();
+        stats.bytesSent = metrics.bytesSent.value();
+        stats.serverStartTime = metrics.startTime;
+        stats.lastStatsUpdate = std::chrono::system_clock::now();
+        return stats;
+    }
+
     void GameServer::logServerStats() {
-        std::lock_guard<std::mutex> lock(statsMutex_);
+        auto& metrics = ServerMetrics::instance();
 
         size_t roomCount = roomManager_ ? roomManager_->getRoomCount() : 0;
         size_t playersInRooms = roomManager_ ? roomManager_->getTotalPlayers() : 0;
         size_t activeAuthSessions = authService_ ? authService_->getActiveSessionCount() : 0;
 
         auto now = std::chrono::system_clock::now();
-        auto uptime = std::chrono::duration_cast<std::chrono::seconds>(now - stats_.serverStartTime).count();
+        auto uptime = std::chrono::duration_cast<std::chrono::seconds>(now - metrics.startTime).count();
 
         spdlog::debug("=== 서버 통계 ===");
-        spdlog::debug("현재 연결: {}", stats_.currentConnections);
+        spdlog::debug("현재 연결: {}", metrics.connectionsCurrent.value());
         spdlog::debug("인증된 세션: {}", activeAuthSessions);
-        spdlog::debug("총 연결 수: {}", stats_.totalConnectionsToday);
-        spdlog::debug("피크 연결: {}", stats_.peakConcurrentConnections);
+        spdlog::debug("총 연결 수: {}", metrics.connectionsAccepted.value());
+        spdlog::debug("피크 연결: {}", metrics.connectionsPeak.value());
         spdlog::debug("활성 방 수: {}", roomCount);
         spdlog::debug("방 내 플레이어: {}", playersInRooms);
-        spdlog::debug("처리된 메시지: {}", stats_.messagesReceived);
+        spdlog::debug("처리된 메시지: 수신 {} / 송신 {} ({} / {} bytes)",
+            metrics.messagesReceived.value(), metrics.messagesSent.value(),
+            metrics.bytesReceived.value(), metrics.bytesSent.value());
+        const Histogram& moveTime = metrics.messageHandleTime(MessageType::GameMove);
+        spdlog::debug("게임 이동 처리 p50/p99: {}us / {}us ({}건)",
+            moveTime.percentile(0.50), moveTime.percentile(0.99), moveTime.count());
+        spdlog::debug("DB 작업 p50/p99: {}us / {}us, 턴 p50: {}ms",
+            metrics.dbQueryTime.percentile(0.50), metrics.dbQueryTime.percentile(0.99),
+            metrics.turnDuration.percentile(0.50) / 1000);
         spdlog::debug("업타임: {}초 ({}분)", uptime, uptime / 60);
+        if (cryptoExecutor_) {
+            spdlog::debug("암호 작업 대기: {} (거절 누적: {})",
+                cryptoExecutor_->getQueuedCount(), cryptoExecutor_->getRejectedCount());
+            for (const auto& [label, latency] : cryptoExecutor_->getLatencyStats()) {
+                spdlog::debug("  {}: {}회, 평균 대기 {:.1f}ms / 실행 {:.1f}ms, 최대 대기 {:.1f}ms / 실행 {:.1f}ms",
+                    label, latency.count, latency.avgWaitMs(), latency.avgExecMs(),
+                    latency.maxWaitMs, latency.maxExecMs);
+            }
+        }
+        if (ioContextPool_) {
+            spdlog::debug("I/O 코어: {}개 (코어 간 전달 누적: {}, 배출 호출: {})",
+                ioContextPool_->size(), ioContextPool_->getCrossCorePosts(), ioContextPool_->getDrainWakeups());
+        }
         spdlog::debug("================");
     }
 
@@ -957,43 +1629,72 @@ namespace Blokus::Server {
     // 중복 로그인 차단 관련 함수들 구현
     // ========================================
 
-    bool GameServer::registerActiveSession(const std::string& userIP, const std::string& userID) {
-        std::lock_guard<std::mutex> lock(activeSessionsMutex_);
+    namespace {
+        GameServer::DuplicateType toDuplicateType(ActiveLoginIndex::ClaimResult result) {
+            switch (result) {
+                case ActiveLoginIndex::ClaimResult::SameUserSameIp: return GameServer::DuplicateType::SAME_USER_IP;
+                case ActiveLoginIndex::ClaimResult::SameUserDiffIp: return GameServer::DuplicateType::SAME_USER_DIFF_IP;
+                case ActiveLoginIndex::ClaimResult::IpLimitReached: return GameServer::DuplicateType::DIFF_USER_SAME_IP;
+                default: return GameServer::DuplicateType::NONE;
+            }
+        }
+    }
+
+    size_t GameServer::getMaxUsersPerIp() const {
+        // 개발 환경(다중 봇 부하 테스트)에서는 IP 상한 없음
+        if (ConfigManager::debugMode) return 0;
+        return static_cast<size_t>(std::max(0, ConfigManager::loginMaxUsersPerIp));
+    }
 
-        // 이미 활성화된 IP나 사용자 ID인지 확인
-        if (!ConfigManager::debugMode && activeIPs_.count(userIP) || activeUserIDs_.count(userID)) {
-            spdlog::warn("중복 로그인 시도 차단: IP={}, UserID={}", userIP, userID);
-            return false;
+    bool GameServer::findRemoteLogin(const std::string& userIP, const std::string& userID) const {
+        // 클러스터 모드: 다른 노드에 로그인된 사용자 (IP 상한은 노드별로만 적용)
+        std::string remoteNodeId;
+        if (!ConfigManager::debugMode && clusterManager_ && clusterManager_->isUserOnRemoteNode(userID, &remoteNodeId)) {
+            spdlog::info("중복 로그인 감지: 다른 노드({})에 로그인된 사용자 - IP={}, UserID={}", remoteNodeId, userIP, userID);
+            return true;
+        }
+        return false;
+    }
+
+    GameServer::DuplicateType GameServer::registerActiveSession(const std::string& userIP, const std::string& userID) {
+        if (findRemoteLogin(userIP, userID)) {
+            return DuplicateType::SAME_USER_DIFF_IP;
         }
 
-        // 활성 세션으로 등록
-        activeIPs_.insert(userIP);
-        activeUserIDs_.insert(userID);
-        ipToUserMap_[userIP] = userID;
+        // 검사와 등록을 한 번에 (같은 계정의 동시 로그인 중 하나만 성공)
+        DuplicateType duplicateType = toDuplicateType(activeLogins_.claim(userID, userIP, getMaxUsersPerIp()));
+        if (duplicateType != DuplicateType::NONE) {
+            spdlog::info("중복 로그인 차단: IP={}, UserID={}, 유형={}", userIP, userID, static_cast<int>(duplicateType));
+            return duplicateType;
+        }
+
+        // 다른 노드에 로그인 사실 알림 (동시 로그인 경합은 ClusterManager가 판정)
+        if (clusterManager_) {
+            clusterManager_->claimUser(userID);
+        }
 
         spdlog::debug("활성 세션 등록: IP={}, UserID={}", userIP, userID);
-        return true;
+        return DuplicateType::NONE;
     }
 
     void GameServer::unregisterActiveSession(const std::string& userIP, const std::string& userID) {
-        std::lock_guard<std::mutex> lock(activeSessionsMutex_);
+        if (!activeLogins_.release(userID, userIP)) {
+            return;  // 이미 해제되었거나 다른 연결이 다시 등록한 사용자
+        }
 
-        // 활성 세션에서 제거
-        activeIPs_.erase(userIP);
-        activeUserIDs_.erase(userID);
-        ipToUserMap_.erase(userIP);
+        if (clusterManager_) {
+            clusterManager_->releaseUser(userID);
+        }
 
         spdlog::debug("활성 세션 해제: IP={}, UserID={}", userIP, userID);
     }
 
     bool GameServer::isIPActive(const std::string& userIP) const {
-        std::lock_guard<std::mutex> lock(activeSessionsMutex_);
-        return activeIPs_.count(userIP) > 0;
+        return activeLogins_.getUserCountForIp(userIP) > 0;
     }
 
     bool GameServer::isUserActive(const std::string& userID) const {
-        std::lock_guard<std::mutex> lock(activeSessionsMutex_);
-        return activeUserIDs_.count(userID) > 0;
+        return activeLogins_.containsUser(userID);
     }
 
     bool GameServer::isDuplicateLogin(const std::string& userIP, const std::string& userID) const {
@@ -1003,54 +1704,23 @@ namespace Blokus::Server {
     GameServer::DuplicateType GameServer::checkDuplicateType(const std::string& userIP, const std::string& userID) const {
         // 개발 환경에서는 중복 로그인 허용
         if (ConfigManager::debugMode) return DuplicateType::NONE;
-        std::lock_guard<std::mutex> lock(activeSessionsMutex_);
-
-        bool ipExists = activeIPs_.count(userIP) > 0;
-        bool userExists = activeUserIDs_.count(userID) > 0;
 
-        if (!ipExists && !userExists) {
-            return DuplicateType::NONE;  // 중복 없음
-        }
-
-        if (ipExists && userExists) {
-            // IP와 사용자 모두 존재 - 매핑 확인
-            auto it = ipToUserMap_.find(userIP);
-            if (it != ipToUserMap_.end() && it->second == userID) {
-                spdlog::info("중복 로그인 감지: 같은 사용자가 같은 IP에서 재로그인 - IP={}, UserID={}", userIP, userID);
-                return DuplicateType::SAME_USER_IP;
-            } else {
-                spdlog::info("중복 로그인 감지: 복합 상황 - IP={}, UserID={}", userIP, userID);
-                return DuplicateType::DIFF_USER_SAME_IP;  // 보수적 접근
-            }
-        }
-
-        if (userExists && !ipExists) {
-            spdlog::info("중복 로그인 감지: 같은 사용자가 다른 IP에서 로그인 - IP={}, UserID={}", userIP, userID);
+        if (findRemoteLogin(userIP, userID)) {
             return DuplicateType::SAME_USER_DIFF_IP;
         }
-
-        if (ipExists && !userExists) {
-            spdlog::info("중복 로그인 감지: 다른 사용자가 같은 IP에서 로그인 - IP={}, UserID={}", userIP, userID);
-            return DuplicateType::DIFF_USER_SAME_IP;
-        }
-
-        return DuplicateType::NONE;
+        return toDuplicateType(activeLogins_.peek(userID, userIP, getMaxUsersPerIp()));
     }
 
     std::vector<std::string> GameServer::getActiveIPs() const {
-        std::lock_guard<std::mutex> lock(activeSessionsMutex_);
-        return std::vector<std::string>(activeIPs_.begin(), activeIPs_.end());
+        return activeLogins_.getIps();
     }
 
     std::vector<std::string> GameServer::getActiveUserIDs() const {
-        std::lock_guard<std::mutex> lock(activeSessionsMutex_);
-        return std::vector<std::string>(activeUserIDs_.begin(), activeUserIDs_.end());
+        return activeLogins_.getUserIds();
     }
 
     size_t GameServer::getActiveSessionCount() const {
-        std::lock_guard<std::mutex> lock(activeSessionsMutex_);
-        // activeIPs_와 activeUserIDs_의 크기는 같아야 함
-        return activeIPs_.size();
+        return activeLogins_.size();
     }
 
 } // namespace Blokus::Server
\ No newline at end of file
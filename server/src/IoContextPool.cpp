@@ -0,0 +1,129 @@
+#include "IoContextPool.h"
+#include <spdlog/spdlog.h>
+#include <algorithm>
+
+namespace Blokus {
+    namespace Server {
+
+        namespace {
+            thread_local int t_coreIndex = -1;
+        }
+
+        // ========================================
+        // 생성자/소멸자
+        // ========================================
+
+        IoContextPool::IoContextPool(size_t count) {
+            count = std::max<size_t>(1, count);
+            m_cores.reserve(count);
+            for (size_t i = 0; i < count; ++i) {
+                m_cores.push_back(std::make_unique<Core>());
+            }
+        }
+
+        IoContextPool::~IoContextPool() {
+            stop();
+        }
+
+        // ========================================
+        // 시작/종료
+        // ========================================
+
+        void IoContextPool::start() {
+            if (m_running.exchange(true)) {
+                return;
+            }
+
+            for (size_t i = 0; i < m_cores.size(); ++i) {
+                Core& core = *m_cores[i];
+                core.workGuard = std::make_unique<boost::asio::executor_work_guard<boost::asio::io_context::executor_type>>(
+                    boost::asio::make_work_guard(core.io));
+
+                core.thread = std::thread([&core, i]() {
+                    t_coreIndex = static_cast<int>(i);
+                    try {
+                        core.io.run();
+                    }
+                    catch (const std::exception& e) {
+                        spdlog::error("I/O 코어 {} 예외: {}", i, e.what());
+                    }
+                    t_coreIndex = -1;
+                });
+            }
+
+            spdlog::info("코어별 io_context 시작 ({}개)", m_cores.size());
+        }
+
+        void IoContextPool::stop() {
+            if (!m_running.exchange(false)) {
+                return;
+            }
+
+            for (auto& core : m_cores) {
+                core->workGuard.reset();
+                core->io.stop();
+            }
+
+            for (auto& core : m_cores) {
+                if (!core->thread.joinable()) {
+                    continue;
+                }
+                // 코어 스레드 자신이 종료를 호출한 경우 join 불가
+                if (core->thread.get_id() == std::this_thread::get_id()) {
+                    core->thread.detach();
+                }
+                else {
+                    core->thread.join();
+                }
+            }
+
+            spdlog::info("코어별 io_context 종료 (코어 간 전달: {}건, 배출 호출: {}회)",
+                m_crossCorePosts.load(), m_drainWakeups.load());
+        }
+
+        // ========================================
+        // 코어 간 작업 전달
+        // ========================================
+
+        void IoContextPool::post(size_t index, Task task) {
+            Core& core = *m_cores[index % m_cores.size()];
+            core.inbox.push(std::move(task));
+            ++m_crossCorePosts;
+            scheduleDrain(core);
+        }
+
+        int IoContextPool::currentIndex() {
+            return t_coreIndex;
+        }
+
+        void IoContextPool::scheduleDrain(Core& core) {
+            // 이미 배출 예정이면 큐에 넣기만 하고 끝 (io_context 락/깨우기 생략)
+            if (core.drainScheduled.exchange(true)) {
+                return;
+            }
+
+            ++m_drainWakeups;
+            boost::asio::post(core.io, [this, &core]() {
+                drain(core);
+            });
+        }
+
+        void IoContextPool::drain(Core& core) {
+            while (auto task = core.inbox.pop()) {
+                try {
+                    (*task)();
+                }
+                catch (const std::exception& e) {
+                    spdlog::error("코어 간 작업 처리 중 예외: {}", e.what());
+                }
+            }
+
+            // 플래그를 내린 뒤 다시 확인: 그 사이 push한 생산자가 배출을 예약하지 못했을 수 있음
+            core.drainScheduled.store(false);
+            if (!core.inbox.empty()) {
+                scheduleDrain(core);
+            }
+        }
+
+    } // namespace Server
+} // namespace Blokus
@@ -3,10 +3,12 @@
 #include <jwt-cpp/jwt.h>
 #include <cpr/cpr.h>
 #include <nlohmann/json.hpp>
+#include <openssl/sha.h>
 #include <thread>
 #include <regex>
 #include <vector>
 #include <cstdint>
+#include <unordered_set>
 
 namespace Blokus
 {
@@ -69,8 +71,15 @@ namespace Blokus
             m_shouldStop = true;
             stopBackgroundRefresh();
 
-            std::lock_guard<std::mutex> lock(m_keysMutex);
-            m_cachedKeys.clear();
+            {
+                std::lock_guard<std::mutex> lock(m_keysMutex);
+                m_cachedKeys.clear();
+            }
+            {
+                std::lock_guard<std::mutex> lock(m_tokenCacheMutex);
+                m_tokenCache.clear();
+                m_tokenLru.clear();
+            }
 
             m_isInitialized = false;
             spdlog::info("JwtVerifier 종료 완료");
@@ -85,6 +94,16 @@ namespace Blokus
 
             try
             {
+                // 이미 검증한 토큰이면 서명 검증 생략 (재접속 시 RSA 검증 비용 제거)
+                const std::string digest = tokenDigest(token);
+                if (auto cachedClaims = lookupVerifiedToken(digest))
+                {
+                    JwtVerificationResult cached(true);
+                    cached.claims = std::move(cachedClaims);
+                    spdlog::debug("JWT 검증 캐시 적중 - sub: {}", cached.claims->sub);
+                    return cached;
+                }
+
                 // 토큰에서 kid 추출
                 auto kidOpt = extractKidFromToken(token);
                 if (!kidOpt)
@@ -99,9 +118,9 @@ namespace Blokus
                 auto keyOpt = getKey(kid);
                 if (!keyOpt)
                 {
-                    // 캐시 새로고침 후 재시도
-                    spdlog::info("키를 찾을 수 없음, JWKS 캐시 새로고침 중... kid: {}", kid);
-                    if (refreshJwksCache())
+                    // 키 교체 가능성: 백그라운드 워커에 새로고침을 요청하고 잠시만 대기 (직접 HTTP 요청하지 않음)
+                    spdlog::info("키를 찾을 수 없음, JWKS 새로고침 요청... kid: {}", kid);
+                    if (requestRefreshAndWait(std::chrono::milliseconds(2000)))
                     {
                         keyOpt = getKey(kid);
                     }
@@ -113,7 +132,12 @@ namespace Blokus
                 }
 
                 // JWT 토큰 검증
-                return verifyTokenWithKey(token, *keyOpt);
+                auto result = verifyTokenWithKey(token, *keyOpt);
+                if (result.success && result.claims)
+                {
+                    storeVerifiedToken(digest, *result.claims);
+                }
+                return result;
             }
             catch (const std::exception &e)
             {
@@ -141,6 +165,9 @@ namespace Blokus
                     return false;
                 }
 
+                // 더 이상 게시되지 않는 키로 검증된 토큰은 캐시에서 제거
+                purgeTokensForMissingKeys();
+
                 spdlog::debug("JWKS 캐시 새로고침 완료 - 키 개수: {}", getCachedKeyCount());
                 return true;
             }
@@ -163,6 +190,17 @@ namespace Blokus
             {
                 spdlog::debug("JWKS 페치 중: {}", m_jwksUrl);
 
+                if (m_jwksFetcher)
+                {
+                    auto body = m_jwksFetcher(m_jwksUrl);
+                    if (!body || body->empty())
+                    {
+                        spdlog::error("JWKS 페치 실패 - 페처 응답 없음");
+                        return std::nullopt;
+                    }
+                    return body;
+                }
+
                 auto response = cpr::Get(
                     cpr::Url{m_jwksUrl},
                     cpr::Timeout{5000}, // 5초 타임아웃
@@ -204,9 +242,8 @@ namespace Blokus
                     return false;
                 }
 
-                std::lock_guard<std::mutex> lock(m_keysMutex);
-                m_cachedKeys.clear();
-
+                // 새 키 목록을 따로 만든 뒤 교체 (파싱 실패 시 기존 키 유지)
+                std::unordered_map<std::string, JwksKey> keys;
                 auto now = std::chrono::system_clock::now();
 
                 for (const auto &keyJson : jwks["keys"])
@@ -229,8 +266,8 @@ namespace Blokus
                             continue;
                         }
 
-                        m_cachedKeys[key.kid] = std::move(key);
                         spdlog::debug("키 캐시됨: kid={}, alg={}", key.kid, key.alg);
+                        keys[key.kid] = std::move(key);
                     }
                     catch (const std::exception &e)
                     {
@@ -239,9 +276,17 @@ namespace Blokus
                     }
                 }
 
+                if (keys.empty())
+                {
+                    spdlog::error("JWKS에 사용 가능한 키가 없음 - 기존 키 유지");
+                    return false;
+                }
+
+                std::lock_guard<std::mutex> lock(m_keysMutex);
+                m_cachedKeys = std::move(keys);
                 m_lastCacheUpdate = now;
                 spdlog::debug("JWKS 파싱 완료 - 총 {} 개 키 캐시됨", m_cachedKeys.size());
-                return !m_cachedKeys.empty();
+                return true;
             }
             catch (const std::exception &e)
             {
@@ -561,7 +606,12 @@ namespace Blokus
 
         void JwtVerifier::stopBackgroundRefresh()
         {
-            m_shouldStop = true;
+            {
+                std::lock_guard<std::mutex> lock(m_refreshMutex);
+                m_shouldStop = true;
+            }
+            m_refreshCv.notify_all();
+
             if (m_refreshThread && m_refreshThread->joinable())
             {
                 m_refreshThread->join();
@@ -571,34 +621,177 @@ namespace Blokus
 
         void JwtVerifier::backgroundRefreshWorker()
         {
-            spdlog::info("JWKS 백그라운드 새로고침 워커 시작");
+            spdlog::info("JWKS 백그라운드 새로고침 워커 시작 (주기: {}초)", m_refreshInterval.count());
 
-            while (!m_shouldStop)
+            while (true)
             {
-                try
+                bool onDemand = false;
                 {
-                    // 5분마다 체크
-                    std::this_thread::sleep_for(std::chrono::minutes(5));
+                    std::unique_lock<std::mutex> lock(m_refreshMutex);
+                    m_refreshCv.wait_for(lock, m_refreshInterval, [this]
+                                         { return m_shouldStop.load() || m_refreshRequested; });
 
                     if (m_shouldStop)
                         break;
 
-                    // 캐시가 만료되었으면 새로고침
-                    if (!isKeyCacheValid())
-                    {
-                        spdlog::debug("JWKS 캐시 만료, 백그라운드 새로고침 실행");
-                        refreshJwksCache();
-                    }
+                    onDemand = m_refreshRequested;
+                    m_refreshRequested = false;
+                }
+
+                bool refreshed = false;
+                try
+                {
+                    // 주기마다 재검증, 실패해도 기존 키로 계속 검증 (stale-while-revalidate)
+                    refreshed = refreshJwksCache();
                 }
                 catch (const std::exception &e)
                 {
                     spdlog::error("백그라운드 새로고침 오류: {}", e.what());
-                    // 오류가 발생해도 계속 실행
                 }
+
+                if (!refreshed)
+                {
+                    spdlog::warn("JWKS 새로고침 실패 ({}) - 기존 키 {}개 유지{}",
+                                 onDemand ? "요청" : "주기", getCachedKeyCount(),
+                                 isKeyCacheValid() ? "" : " (만료된 키 사용 중)");
+                }
+
+                {
+                    std::lock_guard<std::mutex> lock(m_refreshMutex);
+                    ++m_refreshGeneration;
+                }
+                m_refreshCv.notify_all();
             }
 
             spdlog::info("JWKS 백그라운드 새로고침 워커 종료");
         }
 
+        bool JwtVerifier::requestRefreshAndWait(std::chrono::milliseconds timeout)
+        {
+            std::unique_lock<std::mutex> lock(m_refreshMutex);
+            if (m_shouldStop || !m_refreshThread)
+            {
+                return false;
+            }
+
+            // 존재하지 않는 kid로 JWKS 서버를 두드리지 못하도록 요청 간격 제한
+            auto now = std::chrono::steady_clock::now();
+            if (!m_refreshRequested)
+            {
+                if (now - m_lastOnDemandRefresh < m_minOnDemandRefreshInterval)
+                {
+                    return false;
+                }
+                m_refreshRequested = true;
+                m_lastOnDemandRefresh = now;
+                m_refreshCv.notify_all();
+            }
+
+            uint64_t generation = m_refreshGeneration;
+            return m_refreshCv.wait_for(lock, timeout, [this, generation]
+                                        { return m_shouldStop.load() || m_refreshGeneration != generation; }) &&
+                   !m_shouldStop;
+        }
+
+        // ========================================
+        // 검증 완료 토큰 캐시
+        // ========================================
+
+        std::optional<JwtClaims> JwtVerifier::lookupVerifiedToken(const std::string &digest)
+        {
+            std::lock_guard<std::mutex> lock(m_tokenCacheMutex);
+
+            auto it = m_tokenCache.find(digest);
+            if (it == m_tokenCache.end())
+            {
+                return std::nullopt;
+            }
+
+            // 만료(유예 포함)된 토큰은 제거 후 정상 검증 경로로
+            auto now = std::chrono::system_clock::now();
+            const auto &claims = it->second.claims;
+            if (claims.exp + m_gracePeriod < now)
+            {
+                m_tokenLru.erase(it->second.lruIt);
+                m_tokenCache.erase(it);
+                return std::nullopt;
+            }
+            if (claims.nbf > now + m_gracePeriod)
+            {
+                return std::nullopt;
+            }
+
+            m_tokenLru.splice(m_tokenLru.begin(), m_tokenLru, it->second.lruIt);
+            ++m_tokenCacheHits;
+            return claims;
+        }
+
+        void JwtVerifier::storeVerifiedToken(const std::string &digest, const JwtClaims &claims)
+        {
+            if (m_tokenCacheCapacity == 0)
+            {
+                return;
+            }
+
+            std::lock_guard<std::mutex> lock(m_tokenCacheMutex);
+
+            auto it = m_tokenCache.find(digest);
+            if (it != m_tokenCache.end())
+            {
+                it->second.claims = claims;
+                m_tokenLru.splice(m_tokenLru.begin(), m_tokenLru, it->second.lruIt);
+                return;
+            }
+
+            m_tokenLru.push_front(digest);
+            m_tokenCache[digest] = VerifiedTokenEntry{claims, m_tokenLru.begin()};
+
+            while (m_tokenCache.size() > m_tokenCacheCapacity)
+            {
+                m_tokenCache.erase(m_tokenLru.back());
+                m_tokenLru.pop_back();
+            }
+        }
+
+        void JwtVerifier::purgeTokensForMissingKeys()
+        {
+            std::unordered_set<std::string> kids;
+            {
+                std::lock_guard<std::mutex> lock(m_keysMutex);
+                for (const auto &[kid, key] : m_cachedKeys)
+                {
+                    kids.insert(kid);
+                }
+            }
+
+            std::lock_guard<std::mutex> lock(m_tokenCacheMutex);
+            for (auto it = m_tokenCache.begin(); it != m_tokenCache.end();)
+            {
+                if (kids.count(it->second.claims.kid) == 0)
+                {
+                    m_tokenLru.erase(it->second.lruIt);
+                    it = m_tokenCache.erase(it);
+                }
+                else
+                {
+                    ++it;
+                }
+            }
+        }
+
+        size_t JwtVerifier::getCachedTokenCount() const
+        {
+            std::lock_guard<std::mutex> lock(m_tokenCacheMutex);
+            return m_tokenCache.size();
+        }
+
+        std::string JwtVerifier::tokenDigest(const std::string &token)
+        {
+            // 토큰 원문 대신 SHA-256 다이제스트를 키로 보관
+            unsigned char hash[SHA256_DIGEST_LENGTH];
+            SHA256(reinterpret_cast<const unsigned char *>(token.data()), token.size(), hash);
+            return std::string(reinterpret_cast<const char *>(hash), SHA256_DIGEST_LENGTH);
+        }
+
     } // namespace Server
 } // namespace Blokus
\ No newline at end of file
@@ -0,0 +1,86 @@
+#include "Logging.h"
+#include <spdlog/async.h>
+#include <spdlog/sinks/stdout_color_sinks.h>
+
+namespace Blokus {
+    namespace Server {
+
+        namespace {
+            const char* const kLogPattern = "[%Y-%m-%d %H:%M:%S] [%l] [%t] %v";
+
+            int64_t steadyNowNanos() {
+                return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    std::chrono::steady_clock::now().time_since_epoch()).count();
+            }
+        }
+
+        // ========================================
+        // Logging
+        // ========================================
+
+        void Logging::initialize(const std::string& level, bool async, size_t queueSize) {
+            auto sink = std::make_shared<spdlog::sinks::stdout_color_sink_mt>();
+            std::shared_ptr<spdlog::logger> logger;
+
+            if (async) {
+                spdlog::init_thread_pool(queueSize, 1);
+                logger = std::make_shared<spdlog::async_logger>("blokus", sink, spdlog::thread_pool(),
+                    spdlog::async_overflow_policy::overrun_oldest);
+            }
+            else {
+                logger = std::make_shared<spdlog::logger>("blokus", sink);
+            }
+
+            logger->set_pattern(kLogPattern);
+            logger->set_level(parseLevel(level));
+            // 경고 이상은 바로 내보냄 (비동기 모드에서는 flush 요청도 큐를 통해 순서대로 처리)
+            logger->flush_on(spdlog::level::warn);
+
+            spdlog::set_default_logger(logger);
+            spdlog::flush_every(std::chrono::seconds(1));
+
+            spdlog::info("로깅 초기화: {} 모드 (레벨: {}{})", async ? "비동기" : "동기", level,
+                async ? ", 큐 " + std::to_string(queueSize) : "");
+        }
+
+        void Logging::shutdown() {
+            // 비동기 큐에 남은 로그를 모두 출력한 뒤 스레드 풀 종료
+            spdlog::shutdown();
+        }
+
+        spdlog::level::level_enum Logging::parseLevel(const std::string& level) {
+            if (level == "trace") return spdlog::level::trace;
+            if (level == "debug") return spdlog::level::debug;
+            if (level == "info") return spdlog::level::info;
+            if (level == "warn") return spdlog::level::warn;
+            if (level == "error") return spdlog::level::err;
+            if (level == "off") return spdlog::level::off;
+            return spdlog::level::info;     // 기본값
+        }
+
+        size_t Logging::getDroppedCount() {
+            auto pool = spdlog::thread_pool();
+            return pool ? pool->overrun_counter() : 0;
+        }
+
+        // ========================================
+        // LogRateLimiter
+        // ========================================
+
+        bool LogRateLimiter::tryAcquire(uint64_t& suppressed) {
+            int64_t now = steadyNowNanos();
+            int64_t nextAllowed = m_nextAllowedNs.load(std::memory_order_relaxed);
+
+            // 구간 안이거나 다른 스레드가 먼저 통과한 경우 생략 건수만 증가
+            if (now < nextAllowed ||
+                !m_nextAllowedNs.compare_exchange_strong(nextAllowed, now + m_intervalNs, std::memory_order_relaxed)) {
+                m_suppressed.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            }
+
+            suppressed = m_suppressed.exchange(0, std::memory_order_relaxed);
+            return true;
+        }
+
+    } // namespace Server
+} // namespace Blokus
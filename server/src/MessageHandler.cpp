@@ -5,13 +5,24 @@
 #include "GameServer.h"
 #include "DatabaseManager.h"
 #include "VersionManager.h"
+#include "DatabaseExecutor.h"
+#include "UserStatsCache.h"
+#include "CryptoExecutor.h"
+#include "SessionResumeRegistry.h"
+#include "ClusterManager.h"
 #include "ServerTypes.h"
+#include "ServerMetrics.h"
+#include "ChatService.h"
+#include "FrameCompressor.h"
+#include "Tracing.h"
+#include "Logging.h"
 #include <spdlog/spdlog.h>
 #include <sstream>
 #include <algorithm>
 #include <iomanip>
 #include <ctime>
 #include <cstdio>
+#include <charconv>
 
 namespace Blokus::Server
 {
@@ -23,77 +34,68 @@ namespace Blokus::Server
     MessageHandler::MessageHandler(Session *session, RoomManager *roomManager, AuthenticationService *authService, DatabaseManager *databaseManager, GameServer *gameServer, VersionManager *versionManager)
         : session_(session), roomManager_(roomManager), authService_(authService), databaseManager_(databaseManager), gameServer_(gameServer), versionManager_(versionManager)
     {
-        //  enum 기반 핸들러 등록
-        handlers_[MessageType::Ping] = [this](const auto &params)
-        { handlePing(params); };
-
-        // 인증 관련
-        handlers_[MessageType::Auth] = [this](const auto &params)
-        { handleAuth(params); };
-        handlers_[MessageType::Register] = [this](const auto &params)
-        { handleRegister(params); };
-        handlers_[MessageType::Guest] = [this](const auto &params)
-        { handleLoginGuest(params); };
-        handlers_[MessageType::Logout] = [this](const auto &params)
-        { handleLogout(params); };
-        handlers_[MessageType::Validate] = [this](const auto &params)
-        { handleSessionValidate(params); };
-
-        // 방 관련
-        handlers_[MessageType::RoomCreate] = [this](const auto &params)
-        { handleCreateRoom(params); };
-        handlers_[MessageType::RoomJoin] = [this](const auto &params)
-        { handleJoinRoom(params); };
-        handlers_[MessageType::RoomLeave] = [this](const auto &params)
-        { handleLeaveRoom(params); };
-        handlers_[MessageType::RoomList] = [this](const auto &params)
-        { handleRoomList(params); };
-        handlers_[MessageType::RoomReady] = [this](const auto &params)
-        { handlePlayerReady(params); };
-        handlers_[MessageType::RoomStart] = [this](const auto &params)
-        { handleStartGame(params); };
-        handlers_[MessageType::RoomTransferHost] = [this](const auto &params)
-        { handleTransferHost(params); };
-
-        // 로비 관련
-        handlers_[MessageType::LobbyEnter] = [this](const auto &params)
-        { handleLobbyEnter(params); };
-        handlers_[MessageType::LobbyLeave] = [this](const auto &params)
-        { handleLobbyLeave(params); };
-        handlers_[MessageType::LobbyList] = [this](const auto &params)
-        { handleLobbyList(params); };
-
-        // 사용자 정보 관련
-        handlers_[MessageType::UserStats] = [this](const auto &params)
-        { handleGetUserStats(params); };
-
-        // 사용자 설정 관련
-        handlers_[MessageType::UserSettings] = [this](const auto &params)
-        { handleUserSettings(params); };
-
-        // 버전 관련
-        handlers_[MessageType::VersionCheck] = [this](const auto &params)
-        { handleVersionCheck(params); };
-
-        // 게임 관련
-        handlers_[MessageType::GameMove] = [this](const auto &params)
-        { handleGameMove(params); };
-        // handlers_[MessageType::GameResultResponse] 제거됨 - 즉시 초기화 방식으로 변경
-
-        // 기본 기능
-        handlers_[MessageType::Chat] = [this](const auto &params)
-        { handleChat(params); };
-        
-        // AFK 검증 메시지 처리 (임시로 Chat 타입 재활용)
-        // 실제 메시지는 "AFK_VERIFY" 형태로 전송
-
-        spdlog::debug("MessageHandler 생성: 세션 {} (핸들러 수: {})",
-                      session_ ? session_->getSessionId() : "nullptr", handlers_.size());
+        SPDLOG_DEBUG("MessageHandler 생성: 세션 {}", session_ ? session_->getSessionId() : "nullptr");
     }
 
     MessageHandler::~MessageHandler()
     {
-        spdlog::debug("MessageHandler 소멸");
+        SPDLOG_DEBUG("MessageHandler 소멸");
+    }
+
+    // ========================================
+    // 핸들러 테이블 (모든 세션이 공유, 최초 사용 시 한 번 생성)
+    // ========================================
+
+    const MessageHandler::HandlerTable &MessageHandler::handlerTable()
+    {
+        static const HandlerTable table = {
+            {MessageType::Ping, &MessageHandler::handlePing},
+
+            // 인증 관련
+            {MessageType::Auth, &MessageHandler::handleAuth},
+            {MessageType::Register, &MessageHandler::handleRegister},
+            {MessageType::Guest, &MessageHandler::handleLoginGuest},
+            {MessageType::Logout, &MessageHandler::handleLogout},
+            {MessageType::Validate, &MessageHandler::handleSessionValidate},
+            {MessageType::Resume, &MessageHandler::handleSessionResume},
+
+            // 방 관련
+            {MessageType::RoomCreate, &MessageHandler::handleCreateRoom},
+            {MessageType::RoomJoin, &MessageHandler::handleJoinRoom},
+            {MessageType::RoomLeave, &MessageHandler::handleLeaveRoom},
+            {MessageType::RoomList, &MessageHandler::handleRoomList},
+            {MessageType::RoomReady, &MessageHandler::handlePlayerReady},
+            {MessageType::RoomStart, &MessageHandler::handleStartGame},
+            {MessageType::RoomTransferHost, &MessageHandler::handleTransferHost},
+            {MessageType::RoomSpectate, &MessageHandler::handleSpectateRoom},
+            {MessageType::RoomSpectateLeave, &MessageHandler::handleSpectateLeave},
+
+            // 로비 관련
+            {MessageType::LobbyEnter, &MessageHandler::handleLobbyEnter},
+            {MessageType::LobbyLeave, &MessageHandler::handleLobbyLeave},
+            {MessageType::LobbyList, &MessageHandler::handleLobbyList},
+
+            // 사용자 정보 관련
+            {MessageType::UserStats, &MessageHandler::handleGetUserStats},
+
+            // 사용자 설정 관련
+            {MessageType::UserSettings, &MessageHandler::handleUserSettings},
+
+            // 버전 관련
+            {MessageType::VersionCheck, &MessageHandler::handleVersionCheck},
+
+            // 게임 관련
+            {MessageType::GameMove, &MessageHandler::handleGameMove},
+            {MessageType::GameSync, &MessageHandler::handleGameSync},
+            // GameResultResponse 제거됨 - 즉시 초기화 방식으로 변경
+
+            // 기본 기능
+            {MessageType::Chat, &MessageHandler::handleChat}
+
+            // AFK 검증 메시지 처리 (임시로 Chat 타입 재활용)
+            // 실제 메시지는 "AFK_VERIFY" 형태로 전송
+        };
+        return table;
     }
 
     // ========================================
@@ -108,11 +110,14 @@ namespace Blokus::Server
             return;
         }
 
+        // 샘플링된 메시지만 추적 (하위 스팬과 DB 작업이 같은 추적 id로 묶임)
+        auto traceSpan = TraceSpan::root("MessageHandler::handleMessage");
+
         try
         {
             // ping 메시지는 로깅하지 않음 (너무 빈번함)
             if (rawMessage != "ping") {
-                spdlog::debug("📨 메시지 수신 ({}): {}, 현재 상태: {}",
+                SPDLOG_DEBUG("📨 메시지 수신 ({}): {}, 현재 상태: {}",
                               session_->getSessionId(),
                               rawMessage.length() > 100 ? rawMessage.substr(0, 100) + "..." : rawMessage, (int)session_->getState());
             }
@@ -128,11 +133,17 @@ namespace Blokus::Server
             }
 
             // 기존 텍스트 기반 메시지 처리
-            auto [messageType, params] = parseMessage(rawMessage);
+            std::pair<MessageType, std::vector<std::string>> parsed;
+            {
+                TraceSpan parseSpan("MessageHandler::parseMessage");
+                parsed = parseMessage(rawMessage);
+            }
+            auto& [messageType, params] = parsed;
+            traceSpan.setArg(static_cast<int64_t>(messageType));
 
             // ping 메시지 파싱 결과도 로깅하지 않음
             if (messageType != MessageType::Ping) {
-                spdlog::debug("파싱 결과: {} ({})",
+                SPDLOG_DEBUG("파싱 결과: {} ({})",
                               messageTypeToString(messageType), static_cast<int>(messageType));
             }
 
@@ -144,15 +155,22 @@ namespace Blokus::Server
             }
 
             // 핸들러 실행
-            auto it = handlers_.find(messageType);
-            if (it != handlers_.end())
+            const auto &handlers = handlerTable();
+            auto it = handlers.find(messageType);
+            if (it != handlers.end())
             {
-                it->second(params);
+                TraceSpan dispatchSpan("MessageHandler::dispatch", static_cast<int64_t>(messageType));
+                auto handleStart = std::chrono::steady_clock::now();
+                (this->*(it->second))(params);
+                ServerMetrics::instance().messageHandleTime(messageType).recordDuration(
+                    std::chrono::steady_clock::now() - handleStart);
             }
             else
             {
-                spdlog::warn("알 수 없는 메시지 타입: {} (원본: {})",
-                             messageTypeToString(messageType), rawMessage);
+                // 클라이언트가 임의로 보낼 수 있으므로 호출 위치별 빈도 제한
+                BLOKUS_LOG_RATE_LIMITED(spdlog::level::warn, 1000, "알 수 없는 메시지 타입: {} (원본: {})",
+                             messageTypeToString(messageType),
+                             rawMessage.length() > 100 ? rawMessage.substr(0, 100) + "..." : rawMessage);
                 sendError("알 수 없는 명령어입니다");
             }
         }
@@ -181,7 +199,7 @@ namespace Blokus::Server
             (unsigned char)commandStr[1] == 0xBB && 
             (unsigned char)commandStr[2] == 0xBF) {
             commandStr = commandStr.substr(3);
-            spdlog::debug("DEBUG: UTF-8 BOM removed from commandStr");
+            SPDLOG_DEBUG("DEBUG: UTF-8 BOM removed from commandStr");
         }
 
         // room:xxx, game:xxx 형태 처리
@@ -234,10 +252,46 @@ namespace Blokus::Server
 
     void MessageHandler::sendError(const std::string &errorMessage)
     {
-        spdlog::debug("📤 에러 응답 전송: {}", errorMessage);
+        SPDLOG_DEBUG("📤 에러 응답 전송: {}", errorMessage);
         sendTextMessage("ERROR:" + errorMessage);
     }
 
+    template <typename Work, typename Handler>
+    void MessageHandler::runDatabaseTask(Work work, Handler handler)
+    {
+        if (!databaseManager_)
+        {
+            spdlog::warn("DatabaseManager가 없어 DB 작업을 실행할 수 없습니다");
+            return;
+        }
+
+        auto executor = gameServer_ ? gameServer_->getDatabaseExecutor() : nullptr;
+        if (!executor)
+        {
+            // 실행기가 없으면 기존처럼 현재 스레드에서 처리
+            handler(work(*databaseManager_));
+            return;
+        }
+
+        // 세션이 살아 있는 동안만 핸들러 실행 (MessageHandler는 Session이 소유)
+        auto self = session_->shared_from_this();
+        executor->execute(std::move(work), session_->getSocket().get_executor(),
+            [self, handler = std::move(handler)](auto result) mutable
+            {
+                if (!self->isActive())
+                    return;
+
+                try
+                {
+                    handler(std::move(result));
+                }
+                catch (const std::exception &e)
+                {
+                    spdlog::error("DB 작업 완료 처리 중 예외 ({}): {}", self->getSessionId(), e.what());
+                }
+            });
+    }
+
     // ========================================
     // 인증 관련 핸들러들
     // ========================================
@@ -262,6 +316,12 @@ namespace Blokus::Server
             return;
         }
 
+        if (authInProgress_)
+        {
+            sendError("이미 인증을 처리 중입니다");
+            return;
+        }
+
         AuthResult result;
 
         // 모바일 클라이언트 전용 JWT 인증 (mobile_jwt)  
@@ -291,8 +351,53 @@ namespace Blokus::Server
             // 기존 username/password 인증
             std::string username = params[0];
             std::string password = params[1];
-            result = authService_->loginUser(username, password);
             spdlog::debug("사용자명/비밀번호 인증 시도: {}", username);
+
+            // Argon2 검증은 암호 작업 실행기에서 처리 (I/O 스레드 점유 방지)
+            auto cryptoExecutor = gameServer_ ? gameServer_->getCryptoExecutor() : nullptr;
+            if (cryptoExecutor)
+            {
+                struct PendingLogin
+                {
+                    AuthResult result;
+                    std::optional<UserProfile> profile;
+                    bool profileLoaded = false;
+                };
+
+                authInProgress_ = true;
+                auto self = session_->shared_from_this();
+                bool accepted = cryptoExecutor->execute(session_->getRemoteIP(), "argon2_verify",
+                    [authService = authService_, dbManager = databaseManager_, username, password]()
+                    {
+                        PendingLogin login;
+                        login.result = authService->loginUser(username, password);
+                        if (login.result.success && dbManager)
+                        {
+                            // 같은 워커에서 계정 + 설정까지 미리 조회
+                            login.profile = dbManager->getUserProfileByUsername(login.result.username);
+                            login.profileLoaded = true;
+                        }
+                        return login;
+                    },
+                    session_->getSocket().get_executor(),
+                    [this, self](PendingLogin login)
+                    {
+                        authInProgress_ = false;
+                        if (!self->isActive())
+                            return;
+
+                        completeAuth(login.result, login.profile ? &login.profile.value() : nullptr, login.profileLoaded);
+                    });
+
+                if (!accepted)
+                {
+                    authInProgress_ = false;
+                    sendError("SERVER_BUSY:로그인 요청이 많습니다. 잠시 후 다시 시도해주세요");
+                }
+                return;
+            }
+
+            result = authService_->loginUser(username, password);
         }
         else
         {
@@ -300,6 +405,11 @@ namespace Blokus::Server
             return;
         }
 
+        completeAuth(result, nullptr, false);
+    }
+
+    void MessageHandler::completeAuth(const AuthResult &result, const UserProfile *preloadedProfile, bool profileLoaded)
+    {
         if (result.success)
         {
             // 중복 로그인 검증 포함된 인증 시도
@@ -310,15 +420,32 @@ namespace Blokus::Server
                 return;
             }
 
-            // DB에서 사용자 계정 정보를 불러와 세션에 저장
+            // DB에서 사용자 계정 + 설정을 한 번에 불러와 세션에 저장 (암호 작업 워커에서 미리 조회했으면 재사용)
+            std::optional<UserProfile> userProfile;
+            if (preloadedProfile)
+            {
+                userProfile = *preloadedProfile;
+            }
             if (databaseManager_)
             {
-                auto userAccount = databaseManager_->getUserByUsername(result.username);
-                if (userAccount.has_value())
+                if (!profileLoaded)
                 {
-                    session_->setUserAccount(userAccount.value());
+                    userProfile = databaseManager_->getUserProfileByUsername(result.username);
+                }
+                if (userProfile.has_value())
+                {
+                    // 아직 DB에 반영되지 않은 게임 결과가 있으면 캐시의 통계가 우선
+                    if (auto statsCache = gameServer_ ? gameServer_->getUserStatsCache() : nullptr)
+                    {
+                        userProfile->account = statsCache->put(userProfile->account);
+                    }
+                    session_->setUserAccount(userProfile->account);
+                    if (userProfile->settings.has_value())
+                    {
+                        session_->setUserSettings(userProfile->settings.value());
+                    }
                     spdlog::debug("💾 사용자 계정 정보 로드 완료: {} (레벨: {}, 경험치: {})",
-                                  result.username, userAccount->level, userAccount->experiencePoints);
+                                  result.username, userProfile->account.level, userProfile->account.experiencePoints);
                 }
                 else
                 {
@@ -327,45 +454,41 @@ namespace Blokus::Server
             }
 
             // 완전한 사용자 정보를 ':' 구분자 형태로 전송 (기존 프로토콜 준수)
-            auto userAccountFromDB = databaseManager_->getUserByUsername(result.username);
-            if (databaseManager_ && userAccountFromDB.has_value()) {
+            if (userProfile.has_value()) {
+                const auto &account = userProfile->account;
                 // ':' 구분자 기반 프로토콜로 사용자 정보 전송
                 std::ostringstream userInfoStream;
                 userInfoStream << "AUTH_SUCCESS:" << result.username << ":" << result.sessionToken 
-                    << ":" << userAccountFromDB->displayName
-                    << ":" << userAccountFromDB->level
-                    << ":" << userAccountFromDB->totalGames
-                    << ":" << userAccountFromDB->wins
-                    << ":" << userAccountFromDB->losses
-                    << ":" << userAccountFromDB->totalScore
-                    << ":" << userAccountFromDB->bestScore
-                    << ":" << userAccountFromDB->experiencePoints;
+                    << ":" << account.displayName
+                    << ":" << account.level
+                    << ":" << account.totalGames
+                    << ":" << account.wins
+                    << ":" << account.losses
+                    << ":" << account.totalScore
+                    << ":" << account.bestScore
+                    << ":" << account.experiencePoints;
                 sendResponse(userInfoStream.str());
             } else {
                 // 폴백: 기본 정보만 전송 (0으로 초기화)
                 sendResponse("AUTH_SUCCESS:" + result.username + ":" + result.sessionToken + ":" + result.username + ":1:0:0:0:0:0:0");
             }
+            sendResumeToken();
 
             // 로그인 성공 시 자동으로 로비에 입장되므로 다른 사용자들에게 브로드캐스트
             broadcastLobbyUserJoined(result.username);
 
-            // 로그인 완료 후 즉시 로비 정보 전송 (사용자 목록 + 방 목록 + 사용자 통계)
+            // 로그인 완료 후 즉시 로비 정보 전송 (사용자 목록 + 방 목록 + 최근 채팅 + 사용자 통계)
             sendLobbyUserList();
             sendRoomList();
+            sendChatHistory();
 
             // 로그인 시 사용자 통계 정보 자동 전송
-            try
-            {
-                std::string statsResponse = generateUserStatsResponse();
-                sendResponse(statsResponse);
-                spdlog::debug(" 로그인 후 사용자 통계 전송 완료: '{}'", result.username);
-            }
-            catch (const std::exception &e)
-            {
-                spdlog::warn("로그인 후 사용자 통계 전송 실패: {}", e.what());
-            }
+            sendMyStats();
 
             spdlog::info(" 로그인 성공: {} ({}) - 로비 진입 및 정보 전송 완료", result.username, session_->getSessionId());
+
+            // 서버 재시작 전에 진행 중이던 게임이 있으면 같은 좌석으로 복귀
+            rejoinMigratedSeat();
         }
         else
         {
@@ -410,8 +533,33 @@ namespace Blokus::Server
             password = params[1];
         }
 
-        auto result = authService_->registerUser(username, password);
+        // Argon2 해싱은 암호 작업 실행기에서 처리 (I/O 스레드 점유 방지)
+        auto cryptoExecutor = gameServer_ ? gameServer_->getCryptoExecutor() : nullptr;
+        if (cryptoExecutor)
+        {
+            auto self = session_->shared_from_this();
+            bool accepted = cryptoExecutor->execute(session_->getRemoteIP(), "argon2_hash",
+                [authService = authService_, username, password]()
+                { return authService->registerUser(username, password); },
+                session_->getSocket().get_executor(),
+                [this, self, username](RegisterResult result)
+                {
+                    if (self->isActive())
+                        completeRegister(username, result);
+                });
+
+            if (!accepted)
+            {
+                sendError("SERVER_BUSY:회원가입 요청이 많습니다. 잠시 후 다시 시도해주세요");
+            }
+            return;
+        }
+
+        completeRegister(username, authService_->registerUser(username, password));
+    }
 
+    void MessageHandler::completeRegister(const std::string &username, const RegisterResult &result)
+    {
         if (result.success)
         {
             sendResponse("REGISTER_SUCCESS:" + username);
@@ -470,25 +618,20 @@ namespace Blokus::Server
             }
 
             sendResponse("GUEST_LOGIN_SUCCESS:" + result.username + ":" + result.sessionToken);
+            sendResumeToken();
 
             // 게스트 로그인 성공 시 자동으로 로비에 입장되므로 다른 사용자들에게 브로드캐스트
             broadcastLobbyUserJoined(result.username);
 
-            // 게스트 로그인 완료 후 즉시 로비 정보 전송 (사용자 목록 + 방 목록 + 사용자 통계)
+            // 게스트 로그인 완료 후 즉시 로비 정보 전송 (사용자 목록 + 방 목록 + 최근 채팅 + 사용자 통계)
             sendLobbyUserList();
             sendRoomList();
+            sendChatHistory();
 
             // 게스트 로그인 시 사용자 통계 정보 자동 전송
-            try
-            {
-                std::string statsResponse = generateUserStatsResponse();
-                sendResponse(statsResponse);
-                spdlog::debug(" 게스트 로그인 후 사용자 통계 전송 완료: '{}'", result.username);
-            }
-            catch (const std::exception &e)
-            {
-                spdlog::warn("게스트 로그인 후 사용자 통계 전송 실패: {}", e.what());
-            }
+            sendMyStats();
+
+            rejoinMigratedSeat();
         }
         else
         {
@@ -506,6 +649,12 @@ namespace Blokus::Server
 
         std::string username = session_->getUsername();
 
+        // 로그아웃한 세션은 재개 대상이 아님
+        if (auto *registry = gameServer_ ? gameServer_->getResumeRegistry() : nullptr)
+        {
+            registry->revoke(session_->getUserId());
+        }
+
         // 인증 상태 완전 초기화
         session_->clearAuthentication();
 
@@ -540,12 +689,190 @@ namespace Blokus::Server
         }
     }
 
+    void MessageHandler::handleSessionResume(const std::vector<std::string> &params)
+    {
+        auto *registry = gameServer_ ? gameServer_->getResumeRegistry() : nullptr;
+        if (!registry)
+        {
+            sendError("RESUME_FAILED:세션 재개를 사용할 수 없습니다");
+            return;
+        }
+
+        if (session_->isAuthenticated())
+        {
+            sendError("RESUME_FAILED:이미 로그인된 세션입니다");
+            return;
+        }
+
+        if (params.empty())
+        {
+            sendError("사용법: resume:재개토큰[:마지막방이벤트순번]");
+            return;
+        }
+
+        // 마지막으로 받은 방 이벤트 순번 (room-seq를 협상한 클라이언트만 보냄, 잘못된 값은 없는 것으로 처리)
+        std::optional<uint64_t> clientSeq;
+        if (params.size() >= 2 && !params[1].empty())
+        {
+            try
+            {
+                clientSeq = std::stoull(params[1]);
+            }
+            catch (const std::exception &)
+            {
+                clientSeq.reset();
+            }
+        }
+
+        // 1. 토큰 확인 (1회용, 만료/폐기된 토큰이면 클라이언트는 일반 로그인으로 진행)
+        auto ticket = registry->claim(params[0]);
+        if (!ticket)
+        {
+            sendError("RESUME_FAILED:재개 토큰이 없거나 만료되었습니다");
+            return;
+        }
+
+        // 2. 서버가 아직 끊김을 감지하지 못한 이전 연결이면 방 퇴장 없이 넘겨받음
+        auto previous = ticket->previousSession.lock();
+        int roomId = ticket->roomId;
+        if (previous)
+        {
+            if (!ticket->parked && (previous->isInRoom() || previous->isInGame()))
+            {
+                roomId = previous->getCurrentRoomId();
+            }
+            previous->markSuperseded();
+            previous->releaseActiveRegistration();
+        }
+
+        // 3. 인증 정보 복원 (DB/JWT 재검증 없음)
+        std::string errorMessage;
+        if (!session_->setAuthenticated(ticket->userId, ticket->username, &errorMessage))
+        {
+            if (roomId >= 0 && roomManager_)
+            {
+                roomManager_->leaveRoom(roomId, ticket->userId);
+            }
+            if (previous)
+            {
+                previous->stop();
+            }
+            sendError(errorMessage.empty() ? "RESUME_FAILED:세션을 재개할 수 없습니다" : errorMessage);
+            return;
+        }
+        if (ticket->account.has_value())
+        {
+            session_->setUserAccount(ticket->account.value());
+        }
+        if (ticket->settings.has_value())
+        {
+            session_->setUserSettings(ticket->settings.value());
+        }
+        sendResumeToken();
+
+        // 4. 방 좌석 재개 (방 뮤텍스 안에서 SESSION_RESUMED + 놓친 이벤트 전송)
+        bool resumedInRoom = false;
+        auto room = (roomId >= 0 && roomManager_) ? roomManager_->getRoom(roomId) : nullptr;
+        if (room)
+        {
+            session_->setStateToInRoom(roomId);
+            if (room->isPlaying())
+            {
+                session_->setStateToInGame();
+            }
+
+            size_t replayedCount = 0;
+            auto outcome = room->resumePlayer(ticket->userId, session_->shared_from_this(), replayedCount, clientSeq);
+            if (outcome != GameRoom::ResumeOutcome::NotInRoom)
+            {
+                auto &metrics = ServerMetrics::instance();
+                metrics.sessionResumes.add();
+                metrics.sessionResumeReplayedEvents.add(replayedCount);
+                if (outcome == GameRoom::ResumeOutcome::Resynced)
+                {
+                    metrics.sessionResumeResyncs.add();
+                    sendRoomInfo(room);
+                }
+                resumedInRoom = true;
+            }
+        }
+
+        // 5. 좌석이 없으면 (방이 사라짐 / 로비 세션) 로비로 재개
+        if (!resumedInRoom)
+        {
+            session_->setStateToLobby();
+            sendResponse("SESSION_RESUMED:-1:0");
+            sendLobbyUserList();
+            sendRoomList();
+            ServerMetrics::instance().sessionResumes.add();
+        }
+
+        if (previous)
+        {
+            previous->stop();
+        }
+
+        spdlog::info(" 세션 재개: {} ({} -> {}, 방 {})", ticket->username,
+                     previous ? previous->getSessionId() : "-", session_->getSessionId(), resumedInRoom ? roomId : -1);
+    }
+
+    void MessageHandler::sendResumeToken()
+    {
+        if (!gameServer_)
+        {
+            return;
+        }
+
+        std::string token = gameServer_->issueResumeToken(session_->shared_from_this());
+        if (!token.empty())
+        {
+            sendResponse("RESUME_TOKEN:" + token + ":" + std::to_string(ConfigManager::resumeGraceSeconds));
+        }
+    }
+
+    bool MessageHandler::rejoinMigratedSeat()
+    {
+        auto room = roomManager_ ? roomManager_->claimMigratedSeat(session_->getUserId()) : nullptr;
+        if (!room)
+        {
+            return false;
+        }
+
+        int roomId = room->getRoomId();
+        session_->setStateToInRoom(roomId);
+        if (room->isPlaying())
+        {
+            session_->setStateToInGame();
+        }
+
+        // 이 프로세스에서 처음 붙는 좌석이므로 SESSION_RESUMED:방ID:-1 + ROOM_SNAPSHOT (전체 상태)
+        size_t replayedCount = 0;
+        if (room->resumePlayer(session_->getUserId(), session_->shared_from_this(), replayedCount) ==
+            GameRoom::ResumeOutcome::NotInRoom)
+        {
+            session_->setStateToLobby();
+            return false;
+        }
+        sendRoomInfo(room);
+
+        ServerMetrics::instance().migratedSeatsReclaimed.add();
+        spdlog::info(" 이전된 좌석 복귀: {} -> 방 {}", session_->getUsername(), roomId);
+        return true;
+    }
+
     // ========================================
     // 방 관련 핸들러들 (완전 구현)
     // ========================================
 
     void MessageHandler::handleCreateRoom(const std::vector<std::string> &params)
     {
+        // 드레인 종료 중에는 새 방을 만들지 않음 (클라이언트는 재접속 후 다시 시도)
+        if (gameServer_ && gameServer_->isDraining())
+        {
+            sendError("SERVER_DRAINING:서버 재시작 중입니다. 잠시 후 다시 시도해주세요");
+            return;
+        }
+
         // 1. 상태 검증
         if (!session_->canCreateRoom())
         {
@@ -578,10 +905,13 @@ namespace Blokus::Server
             return;
         }
 
+        // 관전 중이었다면 관전 종료 후 진행
+        stopSpectating();
+
         // 3. 파라미터 검증
         if (params.empty())
         {
-            sendError("사용법: room:create:방이름[:비공개(0/1)[:비밀번호]]");
+            sendError("사용법: room:create:방이름[:비공개(0/1)[:비밀번호[:관전허용(0/1)]]]");
             return;
         }
 
@@ -590,15 +920,16 @@ namespace Blokus::Server
             std::string roomName = params[0];
             bool isPrivate = (params.size() > 1 && params[1] == "1");
             std::string password = (params.size() > 2) ? params[2] : "";
+            bool allowSpectators = (params.size() > 3) ? params[3] != "0" : Common::GameSettings().allowSpectators;
 
             std::string userId = session_->getUserId();
             std::string username = session_->getUsername();
 
-            spdlog::debug(" 방 생성 요청: '{}' by '{}' (비공개: {})",
-                         roomName, username, isPrivate);
+            spdlog::debug(" 방 생성 요청: '{}' by '{}' (비공개: {}, 관전 허용: {})",
+                         roomName, username, isPrivate, allowSpectators);
 
             // 4. RoomManager를 통한 방 생성
-            int roomId = roomManager_->createRoom(userId, username, roomName, isPrivate, password);
+            int roomId = roomManager_->createRoom(userId, username, roomName, isPrivate, password, allowSpectators);
 
             if (roomId > 0)
             {
@@ -695,6 +1026,9 @@ namespace Blokus::Server
             return;
         }
 
+        // 관전 중이었다면 관전 종료 후 진행
+        stopSpectating();
+
         try
         {
             int roomId = std::stoi(params[0]);
@@ -705,11 +1039,14 @@ namespace Blokus::Server
 
             spdlog::debug(" 방 참여 요청: '{}' -> 방 {}", username, roomId);
 
-            // 4. 방 존재 확인
+            // 4. 방 존재 확인 (다른 노드 소유 방이면 해당 노드로 안내)
             auto room = roomManager_->getRoom(roomId);
             if (!room)
             {
-                sendError("존재하지 않는 방입니다");
+                if (!sendRoomRedirect(roomId))
+                {
+                    sendError("존재하지 않는 방입니다");
+                }
                 return;
             }
 
@@ -820,28 +1157,29 @@ namespace Blokus::Server
                 sendResponse("ROOM_LEFT:OK");
                 spdlog::debug(" 방 나가기 성공: '{}'", username);
 
-                //  방 나간 후 DB에서 최신 스탯 정보 강제 조회하여 전송
-                try
+                //  방 나간 후 최신 스탯 정보 전송
+                //  통계 캐시가 있으면 게임 결과가 세션에 이미 반영되어 있으므로 DB 조회 생략
+                if (databaseManager_ && !gameServer_->getUserStatsCache())
                 {
-                    // DB에서 최신 사용자 정보 강제 조회 (게임 결과 반영 보장)
-                    auto dbManager = gameServer_->getDatabaseManager();
-                    if (dbManager)
-                    {
-                        auto updatedAccount = dbManager->getUserByUsername(username);
-                        if (updatedAccount.has_value())
+                    runDatabaseTask(
+                        [username](DatabaseManager &db)
+                        { return db.getUserByUsername(username); },
+                        [this, username](std::optional<UserAccount> updatedAccount)
                         {
-                            session_->setUserAccount(updatedAccount.value());
-                            spdlog::debug(" 방 나가기 후 세션 정보 DB 강제 동기화: '{}'", username);
-                        }
-                    }
-
-                    std::string statsResponse = generateUserStatsResponse();
-                    sendResponse(statsResponse);
-                    spdlog::debug(" 방 나가기 후 사용자 통계 전송 완료: '{}'", username);
+                            // DB에서 조회한 최신 사용자 정보로 세션 동기화 (게임 결과 반영 보장)
+                            if (updatedAccount.has_value())
+                            {
+                                session_->setUserAccount(updatedAccount.value());
+                                spdlog::debug(" 방 나가기 후 세션 정보 DB 강제 동기화: '{}'", username);
+                            }
+
+                            sendMyStats();
+                            spdlog::debug(" 방 나가기 후 사용자 통계 전송 완료: '{}'", username);
+                        });
                 }
-                catch (const std::exception &e)
+                else
                 {
-                    spdlog::warn("방 나가기 후 사용자 통계 전송 실패: {}", e.what());
+                    sendMyStats();
                 }
             }
             else
@@ -867,25 +1205,23 @@ namespace Blokus::Server
 
         try
         {
-            auto roomList = roomManager_->getRoomList();
-
-            std::ostringstream response;
-            response << "ROOM_LIST:" << roomList.size();
+            // room:list:subscribe - 스냅샷 + 버전 전송 후 변경된 행만 ROOM_LIST_DELTA로 수신
+            if (!params.empty() && params[0] == "subscribe")
+            {
+                roomManager_->subscribeRoomList(session_->shared_from_this());
+                return;
+            }
 
-            for (const auto &room : roomList)
+            if (!params.empty() && params[0] == "unsubscribe")
             {
-                response << ":" << room.roomId
-                         << "," << room.roomName
-                         << "," << room.hostName
-                         << "," << room.currentPlayers
-                         << "," << room.maxPlayers
-                         << "," << (room.isPrivate ? "1" : "0")
-                         << "," << (room.isPlaying ? "1" : "0")
-                         << "," << room.gameMode;
+                roomManager_->unsubscribeRoomList(session_->getSessionId());
+                sendResponse("ROOM_LIST_UNSUBSCRIBED");
+                return;
             }
 
-            sendResponse(response.str());
-            spdlog::debug("📋 방 목록 전송: {} 개", roomList.size());
+            // 방 이벤트마다 갱신되는 사전 직렬화 스냅샷 전송 (방 순회 없음)
+            roomManager_->sendRoomListSnapshot(session_->shared_from_this());
+            spdlog::debug("📋 방 목록 전송 (버전: {})", roomManager_->getRoomListVersion());
         }
         catch (const std::exception &e)
         {
@@ -943,6 +1279,13 @@ namespace Blokus::Server
 
     void MessageHandler::handleStartGame(const std::vector<std::string> &params)
     {
+        // 드레인 종료 중에 시작한 게임은 이전 스냅샷에 포함되지 않으므로 거부
+        if (gameServer_ && gameServer_->isDraining())
+        {
+            sendError("SERVER_DRAINING:서버 재시작 중입니다. 잠시 후 다시 시도해주세요");
+            return;
+        }
+
         // 1. 상태 검증
         if (!session_->canStartGame())
         {
@@ -1158,6 +1501,131 @@ namespace Blokus::Server
         }
     }
 
+    // ========================================
+    // 관전 관련 핸들러들
+    // ========================================
+
+    void MessageHandler::handleSpectateRoom(const std::vector<std::string> &params)
+    {
+        // 1. 상태 검증 (로비에서만 관전 가능, 플레이어로 참여 중이면 불가)
+        if (!session_->isInLobby())
+        {
+            sendError("로비에서만 관전할 수 있습니다");
+            return;
+        }
+
+        if (!roomManager_)
+        {
+            sendError("방 관리자가 초기화되지 않았습니다");
+            return;
+        }
+
+        if (params.empty())
+        {
+            sendError("사용법: room:spectate:방ID");
+            return;
+        }
+
+        try
+        {
+            int roomId = std::stoi(params[0]);
+
+            // 2. 방 / 관전 채널 확인 (다른 노드 소유 방이면 해당 노드로 안내)
+            auto room = roomManager_->getRoom(roomId);
+            if (!room)
+            {
+                if (!sendRoomRedirect(roomId))
+                {
+                    sendError("존재하지 않는 방입니다");
+                }
+                return;
+            }
+
+            if (room->isPrivate())
+            {
+                sendError("비공개 방은 관전할 수 없습니다");
+                return;
+            }
+
+            if (!room->allowsSpectators())
+            {
+                sendError("관전이 허용되지 않은 방입니다");
+                return;
+            }
+
+            auto channel = room->getSpectatorChannel();
+            if (!channel)
+            {
+                sendError("이 방은 관전을 지원하지 않습니다");
+                return;
+            }
+
+            // 3. 다른 방을 관전 중이었다면 먼저 종료
+            if (session_->getSpectatingRoomId() != roomId)
+            {
+                stopSpectating();
+            }
+
+            // 4. 관전 채널 합류 (스냅샷 + 로그 전송은 채널이 처리)
+            switch (channel->addViewer(session_->shared_from_this()))
+            {
+            case SpectatorChannel::JoinResult::Joined:
+                session_->setSpectatingRoom(roomId);
+                spdlog::debug(" 관전 시작: '{}' -> 방 {} (관전자 {}명)",
+                             session_->getUsername(), roomId, channel->getViewerCount());
+                break;
+            case SpectatorChannel::JoinResult::AlreadyJoined:
+                sendError("이미 관전 중인 방입니다");
+                break;
+            case SpectatorChannel::JoinResult::Full:
+                sendError("관전 인원이 가득 찼습니다");
+                break;
+            case SpectatorChannel::JoinResult::Closed:
+                sendError("존재하지 않는 방입니다");
+                break;
+            }
+        }
+        catch (const std::invalid_argument &e)
+        {
+            sendError("잘못된 방 ID 형식입니다");
+        }
+        catch (const std::out_of_range &e)
+        {
+            sendError("방 ID가 범위를 벗어났습니다");
+        }
+        catch (const std::exception &e)
+        {
+            sendError("관전 처리 중 오류가 발생했습니다");
+            spdlog::error("관전 처리 중 예외: {}", e.what());
+        }
+    }
+
+    void MessageHandler::handleSpectateLeave(const std::vector<std::string> &params)
+    {
+        int roomId = session_->getSpectatingRoomId();
+        if (roomId < 0 || !stopSpectating())
+        {
+            sendError("관전 중인 방이 없습니다");
+            return;
+        }
+
+        sendResponse("SPECTATE_LEFT:" + std::to_string(roomId));
+    }
+
+    bool MessageHandler::stopSpectating()
+    {
+        int roomId = session_->getSpectatingRoomId();
+        if (roomId < 0)
+        {
+            return false;
+        }
+        session_->clearSpectatingRoom(roomId);
+
+        auto room = roomManager_ ? roomManager_->getRoom(roomId) : nullptr;
+        auto channel = room ? room->getSpectatorChannel() : nullptr;
+        return channel && channel->removeViewer(session_->getSessionId());
+    }
+
     // ========================================
     // 게임 관련 핸들러들
     // ========================================
@@ -1236,7 +1704,7 @@ namespace Blokus::Server
             bool success = room->handleBlockPlacement(userId, placement);
             if (success)
             {
-                spdlog::debug("🎮 블록 배치 성공: '{}' (방 {}, 위치: {},{}, 타입: {})",
+                SPDLOG_DEBUG("🎮 블록 배치 성공: '{}' (방 {}, 위치: {},{}, 타입: {})",
                              userId, roomId, y, x, static_cast<int>(placement.type));
 
                 // 성공 응답 (브로드캐스트는 handleBlockPlacement에서 처리됨)
@@ -1254,6 +1722,49 @@ namespace Blokus::Server
         }
     }
 
+    void MessageHandler::handleGameSync(const std::vector<std::string> &params)
+    {
+        // game:sync                -> 압축 보드 스냅샷 요청
+        // game:sync:순번:해시       -> 클라이언트 보드 검증 (어긋나면 스냅샷으로 복구)
+        if (!session_->isInGame() || !roomManager_)
+        {
+            sendError("게임 중에만 보드를 동기화할 수 있습니다");
+            return;
+        }
+
+        auto room = roomManager_->getRoom(session_->getCurrentRoomId());
+        if (!room)
+        {
+            sendError("게임이 진행 중이 아닙니다");
+            return;
+        }
+
+        if (params.empty())
+        {
+            if (!room->sendBoardSnapshot(session_->shared_from_this()))
+            {
+                sendError("게임이 진행 중이 아닙니다");
+            }
+            return;
+        }
+
+        uint64_t seq = 0;
+        uint64_t hash = 0;
+        const std::string &seqText = params[0];
+        auto seqResult = std::from_chars(seqText.data(), seqText.data() + seqText.size(), seq);
+        if (params.size() < 2 || seqResult.ec != std::errc() || seqResult.ptr != seqText.data() + seqText.size() ||
+            !BoardSync::parseHash(params[1], hash))
+        {
+            sendError("사용법: game:sync[:순번:해시]");
+            return;
+        }
+
+        if (room->verifyBoardSync(session_->shared_from_this(), seq, hash) == GameRoom::BoardSyncResult::NotPlaying)
+        {
+            sendError("게임이 진행 중이 아닙니다");
+        }
+    }
+
     // handleGameResultResponse 메서드 제거됨 - 즉시 초기화 방식으로 변경
 
     // ========================================
@@ -1305,6 +1816,12 @@ namespace Blokus::Server
             // 5. 방 목록 전송
             sendRoomList();
 
+            // 로비에 새로 들어온 경우 (방에서 나온 경우 포함) 최근 로비 채팅 전송
+            if (!wasAlreadyInLobby)
+            {
+                sendChatHistory();
+            }
+
             // 6. 방에서 나온 플래그 리셋 (로비 입장 처리 완료 후)
             session_->clearJustLeftRoomFlag();
 
@@ -1384,7 +1901,15 @@ namespace Blokus::Server
         }
 
         std::string username = session_->getUsername();
-        spdlog::debug("채팅 메시지: [{}] {}", username, message);
+        SPDLOG_DEBUG("채팅 메시지: [{}] {}", username, message);
+
+        // 사용자별 전송 한도 (도배가 전체 로비로 증폭되지 않도록)
+        ChatService *chatService = gameServer_ ? gameServer_->getChatService() : nullptr;
+        if (chatService && !chatService->tryConsume(session_->getUserId()))
+        {
+            sendError("CHAT_RATE_LIMITED:메시지를 너무 빠르게 보내고 있습니다. 잠시 후 다시 시도해주세요");
+            return;
+        }
 
         // 채팅 메시지 브로드캐스팅
         try
@@ -1424,27 +1949,8 @@ namespace Blokus::Server
                 return;
             }
 
-            // GameServer에서 실제 로비 사용자 목록을 가져옴
-            auto lobbyUsers = gameServer_->getLobbyUsers();
-
-            std::ostringstream response;
-            response << "LOBBY_USER_LIST:" << lobbyUsers.size();
-
-            int validUserCount = 0;
-            for (const auto &lobbySession : lobbyUsers)
-            {
-                if (lobbySession && lobbySession->isActive() && !lobbySession->getUsername().empty())
-                {
-                    std::string username = lobbySession->getUsername();
-                    std::string displayName = lobbySession->getDisplayName();
-                    int userLevel = lobbySession->getUserLevel();
-                    std::string userStatus = lobbySession->getUserStatusString();
-
-                    response << ":" << username << "," << displayName << "," << userLevel << "," << userStatus;
-                    validUserCount++;
-                }
-            }
-            sendResponse(response.str());
+            // GameServer에서 실제 로비 사용자 목록을 가져옴 (클러스터 모드면 다른 노드 사용자 포함)
+            sendResponse(gameServer_->buildLobbyUserListMessage());
         }
         catch (const std::exception &e)
         {
@@ -1452,6 +1958,25 @@ namespace Blokus::Server
         }
     }
 
+    bool MessageHandler::sendRoomRedirect(int roomId)
+    {
+        ClusterManager *cluster = gameServer_ ? gameServer_->getClusterManager() : nullptr;
+        if (!cluster)
+        {
+            return false;
+        }
+
+        auto owner = cluster->findRoomOwner(roomId);
+        if (!owner)
+        {
+            return false;
+        }
+
+        spdlog::debug(" 다른 노드 소유 방 안내: 방 {} -> {} ({}:{})", roomId, owner->nodeId, owner->host, owner->port);
+        sendResponse("ROOM_REDIRECT:" + std::to_string(roomId) + ":" + owner->host + ":" + std::to_string(owner->port));
+        return true;
+    }
+
     void MessageHandler::sendRoomList()
     {
         if (roomManager_)
@@ -1540,8 +2065,15 @@ namespace Blokus::Server
                 displayName = session_->getDisplayName();
             }
             std::string chatMessage = "CHAT:" + username + ":" + displayName + ":" + message;
-            
-            // GameServer를 통해 실제 로비에 있는 사용자에게만 브로드캐스트
+
+            // 배치 구간 동안 모았다가 실제 로비 사용자에게 프레임 1개씩 전송
+            if (auto *chatService = gameServer_->getChatService())
+            {
+                chatService->publishLobby(std::move(chatMessage));
+                return;
+            }
+
+            // 채팅 서비스가 없으면 즉시 전송
             auto lobbyUsers = gameServer_->getActualLobbyUsers();
             spdlog::debug("📢 로비 채팅 브로드캐스트: [{}] {} -> {}명의 로비 사용자에게", username, message, lobbyUsers.size());
             for (const auto &lobbySession : lobbyUsers)
@@ -1551,8 +2083,6 @@ namespace Blokus::Server
                     lobbySession->sendMessage(chatMessage);
                 }
             }
-
-            spdlog::debug("로비 사용자 {}명에게 채팅 브로드캐스트 완료", lobbyUsers.size());
         }
         catch (const std::exception &e)
         {
@@ -1560,6 +2090,14 @@ namespace Blokus::Server
         }
     }
 
+    void MessageHandler::sendChatHistory()
+    {
+        if (auto *chatService = gameServer_ ? gameServer_->getChatService() : nullptr)
+        {
+            chatService->sendHistory(session_->shared_from_this());
+        }
+    }
+
     void MessageHandler::broadcastRoomChatMessage(const std::string &username, const std::string &message)
     {
         try
@@ -1699,31 +2237,57 @@ namespace Blokus::Server
     // 사용자 정보 관련 핸들러
     // ========================================
 
-    std::string MessageHandler::generateUserStatsResponse()
+    void MessageHandler::sendMyStats()
     {
-        auto username = session_->getUsername();
-        auto userAccountOpt = session_->getUserAccount();
+        std::string username = session_->getUsername();
 
-        if (!userAccountOpt.has_value())
+        // 1. 세션이 가진 계정 (로그인/게임 결과 반영 시 갱신됨)
+        if (auto userAccount = session_->getUserAccount())
         {
-            auto dbManager = gameServer_->getDatabaseManager();
-            if (!dbManager)
-                throw std::runtime_error("No DB manager");
+            sendResponse(generateUserStatsResponse(userAccount.value()));
+            return;
+        }
 
-            auto dbUserAccount = dbManager->getUserByUsername(username);
-            if (!dbUserAccount.has_value())
-                throw std::runtime_error("User not found");
-            session_->setUserAccount(dbUserAccount.value());
-            userAccountOpt = dbUserAccount;
+        // 2. 통계 캐시
+        auto statsCache = gameServer_ ? gameServer_->getUserStatsCache() : nullptr;
+        if (statsCache)
+        {
+            if (auto cachedAccount = statsCache->findByName(username))
+            {
+                session_->setUserAccount(cachedAccount.value());
+                sendResponse(generateUserStatsResponse(cachedAccount.value()));
+                return;
+            }
         }
 
-        const auto &userAccount = userAccountOpt.value();
-        int requiredExp = 100;
-        if (auto dbManager = gameServer_->getDatabaseManager())
+        // 3. DB (DB 실행기에서 비동기 처리)
+        if (!databaseManager_)
         {
-            requiredExp = dbManager->getRequiredExpForLevel(userAccount.level + 1);
+            spdlog::warn("사용자 통계 전송 실패: '{}' (데이터베이스 없음)", username);
+            return;
         }
 
+        runDatabaseTask(
+            [username](DatabaseManager &db)
+            { return db.getUserByUsername(username); },
+            [this, username, statsCache](std::optional<UserAccount> dbUserAccount)
+            {
+                if (!dbUserAccount.has_value())
+                {
+                    spdlog::warn("사용자 통계 전송 실패: '{}' (계정 없음)", username);
+                    return;
+                }
+
+                UserAccount account = statsCache ? statsCache->put(dbUserAccount.value()) : dbUserAccount.value();
+                session_->setUserAccount(account);
+                sendResponse(generateUserStatsResponse(account));
+            });
+    }
+
+    std::string MessageHandler::generateUserStatsResponse(const UserAccount &userAccount)
+    {
+        int requiredExp = DatabaseManager::getRequiredExpForLevel(userAccount.level + 1);
+
         std::ostringstream response;
         response << "MY_STATS_UPDATE:{"; // 자동 업데이트용 메시지 타입
         response << "\"username\":\"" << userAccount.username << "\",";
@@ -1791,64 +2355,54 @@ namespace Blokus::Server
 
             // 대상 사용자의 세션에서 사용자 정보 가져오기
             auto userAccountOpt = targetSession->getUserAccount();
-            
-            if (!userAccountOpt.has_value())
+            if (userAccountOpt.has_value())
             {
-                // 세션에 캐시된 정보가 없으면 DB에서 조회
-                auto dbManager = gameServer_->getDatabaseManager();
-                if (!dbManager)
-                {
-                    sendError("서버 오류: 데이터베이스를 사용할 수 없습니다");
-                    return;
-                }
+                sendUserStatsResponse(userAccountOpt.value(), targetSession);
+                return;
+            }
 
-                // username 또는 display_name으로 DB 검색
-                auto dbUserAccount = dbManager->getUserByUsername(targetUsername);
-                if (!dbUserAccount.has_value())
-                {
-                    // username으로 못 찾으면 display_name으로 검색
-                    dbUserAccount = dbManager->getUserByDisplayName(targetUsername);
-                }
-                
-                if (!dbUserAccount.has_value())
+            // 세션에 정보가 없으면 사용자 통계 캐시 확인
+            auto statsCache = gameServer_->getUserStatsCache();
+            if (statsCache)
+            {
+                if (auto cachedAccount = statsCache->findByName(targetUsername))
                 {
-                    sendError("사용자 정보를 찾을 수 없습니다");
+                    targetSession->setUserAccount(cachedAccount.value());
+                    sendUserStatsResponse(cachedAccount.value(), targetSession);
                     return;
                 }
-                
-                targetSession->setUserAccount(dbUserAccount.value());
-                userAccountOpt = dbUserAccount;
             }
 
-            const auto& userAccount = userAccountOpt.value();
-            int requiredExp = 100;
-            if (auto dbManager = gameServer_->getDatabaseManager())
+            // 캐시에도 없으면 DB에서 조회 (DB 실행기에서 비동기 처리)
+            if (!databaseManager_)
             {
-                requiredExp = dbManager->getRequiredExpForLevel(userAccount.level + 1);
+                sendError("서버 오류: 데이터베이스를 사용할 수 없습니다");
+                return;
             }
 
-            // 응답 메시지 생성
-            std::ostringstream response;
-            response << "USER_STATS_RESPONSE:{";
-            response << "\"username\":\"" << userAccount.username << "\",";
-            response << "\"displayName\":\"" << userAccount.displayName << "\",";
-            response << "\"level\":" << userAccount.level << ",";
-            response << "\"totalGames\":" << userAccount.totalGames << ",";
-            response << "\"wins\":" << userAccount.wins << ",";
-            response << "\"losses\":" << userAccount.losses << ",";
-            response << "\"draws\":" << userAccount.draws << ",";
-            response << "\"currentExp\":" << userAccount.experiencePoints << ",";
-            response << "\"requiredExp\":" << requiredExp << ",";
-            response << "\"winRate\":" << std::fixed << std::setprecision(1) << userAccount.getWinRate() << ",";
-            response << "\"averageScore\":" << std::fixed << std::setprecision(1) << userAccount.getAverageScore() << ",";
-            response << "\"totalScore\":" << userAccount.totalScore << ",";
-            response << "\"bestScore\":" << userAccount.bestScore << ",";
-            response << "\"status\":\"" << targetSession->getUserStatusString() << "\"";
-            response << "}";
+            runDatabaseTask(
+                [targetUsername](DatabaseManager& db)
+                {
+                    // username으로 못 찾으면 display_name으로 검색
+                    auto dbUserAccount = db.getUserByUsername(targetUsername);
+                    if (!dbUserAccount.has_value())
+                    {
+                        dbUserAccount = db.getUserByDisplayName(targetUsername);
+                    }
+                    return dbUserAccount;
+                },
+                [this, targetSession, statsCache](std::optional<UserAccount> dbUserAccount)
+                {
+                    if (!dbUserAccount.has_value())
+                    {
+                        sendError("사용자 정보를 찾을 수 없습니다");
+                        return;
+                    }
 
-            sendResponse(response.str());
-            spdlog::debug(" 사용자 정보 응답 전송 완료: '{}' -> '{}'", 
-                         targetUsername, session_->getUsername());
+                    UserAccount account = statsCache ? statsCache->put(dbUserAccount.value()) : dbUserAccount.value();
+                    targetSession->setUserAccount(account);
+                    sendUserStatsResponse(account, targetSession);
+                });
         }
         catch (const std::exception& e)
         {
@@ -1857,6 +2411,34 @@ namespace Blokus::Server
         }
     }
 
+    void MessageHandler::sendUserStatsResponse(const UserAccount& userAccount, const std::shared_ptr<Session>& targetSession)
+    {
+        int requiredExp = DatabaseManager::getRequiredExpForLevel(userAccount.level + 1);
+
+        // 응답 메시지 생성
+        std::ostringstream response;
+        response << "USER_STATS_RESPONSE:{";
+        response << "\"username\":\"" << userAccount.username << "\",";
+        response << "\"displayName\":\"" << userAccount.displayName << "\",";
+        response << "\"level\":" << userAccount.level << ",";
+        response << "\"totalGames\":" << userAccount.totalGames << ",";
+        response << "\"wins\":" << userAccount.wins << ",";
+        response << "\"losses\":" << userAccount.losses << ",";
+        response << "\"draws\":" << userAccount.draws << ",";
+        response << "\"currentExp\":" << userAccount.experiencePoints << ",";
+        response << "\"requiredExp\":" << requiredExp << ",";
+        response << "\"winRate\":" << std::fixed << std::setprecision(1) << userAccount.getWinRate() << ",";
+        response << "\"averageScore\":" << std::fixed << std::setprecision(1) << userAccount.getAverageScore() << ",";
+        response << "\"totalScore\":" << userAccount.totalScore << ",";
+        response << "\"bestScore\":" << userAccount.bestScore << ",";
+        response << "\"status\":\"" << targetSession->getUserStatusString() << "\"";
+        response << "}";
+
+        sendResponse(response.str());
+        spdlog::debug(" 사용자 정보 응답 전송 완료: '{}' -> '{}'",
+                     userAccount.username, session_->getUsername());
+    }
+
     // AFK 검증 처리
     void MessageHandler::handleAfkVerify()
     {
@@ -2021,8 +2603,40 @@ namespace Blokus::Server
         bool compatible = version.isCompatibleWith(clientVersion);
         
         if (compatible) {
-            sendTextMessage("version:ok");
-            spdlog::debug(" 버전 호환: {} <-> {}", clientVersion, ConfigManager::serverVersion);
+            // 기능 협상: version:check:버전:코덱1,코덱2 (압축 코덱, room-seq) - 보내지 않은 이전 클라이언트는 텍스트 그대로
+            bool compression = false;
+            bool roomSeqTags = false;
+            if (params.size() >= 2) {
+                std::stringstream codecs(params[1]);
+                std::string codec;
+                while (std::getline(codecs, codec, ',')) {
+                    if (codec == FrameCompressor::CODEC && ConfigManager::compressionEnabled) {
+                        compression = true;
+                    }
+                    else if (codec == Session::ROOM_SEQ_CAPABILITY) {
+                        roomSeqTags = true;
+                    }
+                }
+            }
+
+            std::string accepted;
+            if (compression) {
+                accepted += FrameCompressor::CODEC;
+            }
+            if (roomSeqTags) {
+                accepted += (accepted.empty() ? "" : ",") + std::string(Session::ROOM_SEQ_CAPABILITY);
+            }
+
+            // 응답을 큐에 넣은 뒤 켜서 version:ok 자체는 항상 평문
+            sendTextMessage(accepted.empty() ? "version:ok" : "version:ok:" + accepted);
+            if (compression) {
+                session_->enableCompression();
+            }
+            if (roomSeqTags) {
+                session_->enableRoomSeqTags();
+            }
+            spdlog::debug(" 버전 호환: {} <-> {} (압축: {}, 방 이벤트 순번: {})",
+                clientVersion, ConfigManager::serverVersion, compression, roomSeqTags);
         } else {
             std::string response = "version:mismatch:" + versionManager_->getDownloadURL();
             sendTextMessage(response);
@@ -2070,25 +2684,28 @@ namespace Blokus::Server
                 return;
             }
 
-            // 데이터베이스 업데이트
-            if (databaseManager_ && databaseManager_->updateUserSettings(session_->getUserId(), settings)) {
-                // 세션에 설정 캐싱
-                session_->setUserSettings(settings);
-                
-                // 성공 응답
-                std::string response = "UserSettingsResponse:success:" + settings.theme + ":" + 
-                                     settings.language + ":" + 
-                                     (settings.bgmMute ? "true" : "false") + ":" + 
-                                     std::to_string(settings.bgmVolume) + ":" +
-                                     (settings.effectMute ? "true" : "false") + ":" + 
-                                     std::to_string(settings.effectVolume);
-                
-                sendTextMessage(response);
-                spdlog::debug("Updated settings for user {}", session_->getUsername());
-            } else {
+            if (!databaseManager_) {
                 sendError("설정 업데이트에 실패했습니다");
+                return;
             }
 
+            // 데이터베이스 업데이트 (DB 실행기에서 비동기 처리)
+            runDatabaseTask(
+                [userId = session_->getUserId(), settings](DatabaseManager& db) {
+                    return db.updateUserSettings(userId, settings);
+                },
+                [this, settings](bool success) {
+                    if (!success) {
+                        sendError("설정 업데이트에 실패했습니다");
+                        return;
+                    }
+
+                    // 세션에 설정 캐싱 후 성공 응답
+                    session_->setUserSettings(settings);
+                    sendUserSettingsResponse(settings);
+                    spdlog::debug("Updated settings for user {}", session_->getUsername());
+                });
+
         } catch (const std::exception& e) {
             spdlog::error("Error in handleUserSettings: {}", e.what());
             sendError("서버 오류가 발생했습니다");
@@ -2106,38 +2723,27 @@ namespace Blokus::Server
             // 세션에서 캐싱된 설정 확인
             auto cachedSettings = session_->getUserSettings();
             if (cachedSettings.has_value()) {
-                const auto& settings = cachedSettings.value();
-                std::string response = "UserSettingsResponse:success:" + settings.theme + ":" + 
-                                     settings.language + ":" + 
-                                     (settings.bgmMute ? "true" : "false") + ":" + 
-                                     std::to_string(settings.bgmVolume) + ":" +
-                                     (settings.effectMute ? "true" : "false") + ":" + 
-                                     std::to_string(settings.effectVolume);
-                
-                sendTextMessage(response);
+                sendUserSettingsResponse(cachedSettings.value());
                 return;
             }
 
-            // 데이터베이스에서 조회 (캐싱된 설정이 없는 경우)
+            // 데이터베이스에서 조회 (캐싱된 설정이 없는 경우, DB 실행기에서 비동기 처리)
             if (databaseManager_) {
-                auto settings = databaseManager_->getUserSettings(session_->getUserId());
-                if (settings.has_value()) {
-                    // 세션에 캐싱
-                    session_->setUserSettings(settings.value());
-                    
-                    const auto& s = settings.value();
-                    std::string response = "UserSettingsResponse:success:" + s.theme + ":" + 
-                                         s.language + ":" + 
-                                         (s.bgmMute ? "true" : "false") + ":" + 
-                                         std::to_string(s.bgmVolume) + ":" +
-                                         (s.effectMute ? "true" : "false") + ":" + 
-                                         std::to_string(s.effectVolume);
-                    
-                    sendTextMessage(response);
-                    spdlog::debug("Retrieved settings for user {}", session_->getUsername());
-                } else {
-                    sendError("사용자 설정을 찾을 수 없습니다");
-                }
+                runDatabaseTask(
+                    [userId = session_->getUserId()](DatabaseManager& db) {
+                        return db.getUserSettings(userId);
+                    },
+                    [this](std::optional<UserSettings> settings) {
+                        if (!settings.has_value()) {
+                            sendError("사용자 설정을 찾을 수 없습니다");
+                            return;
+                        }
+
+                        // 세션에 캐싱
+                        session_->setUserSettings(settings.value());
+                        sendUserSettingsResponse(settings.value());
+                        spdlog::debug("Retrieved settings for user {}", session_->getUsername());
+                    });
             } else {
                 sendError("데이터베이스 연결 오류입니다");
             }
@@ -2148,6 +2754,18 @@ namespace Blokus::Server
         }
     }
 
+    void MessageHandler::sendUserSettingsResponse(const UserSettings& settings)
+    {
+        std::string response = "UserSettingsResponse:success:" + settings.theme + ":" + 
+                             settings.language + ":" + 
+                             (settings.bgmMute ? "true" : "false") + ":" + 
+                             std::to_string(settings.bgmVolume) + ":" +
+                             (settings.effectMute ? "true" : "false") + ":" + 
+                             std::to_string(settings.effectVolume);
+        
+        sendTextMessage(response);
+    }
+
     // ========================================
     // 인증 관련 헬퍼 함수들
     // ========================================
@@ -2161,7 +2779,8 @@ namespace Blokus::Server
             MessageType::Register,       // 회원가입
             MessageType::Guest,          // 게스트 로그인
             MessageType::VersionCheck,   // 버전 확인
-            MessageType::Validate        // 세션 검증 (언제든 가능)
+            MessageType::Validate,       // 세션 검증 (언제든 가능)
+            MessageType::Resume          // 세션 재개 (재개 토큰으로 인증 복원)
         };
 
         return publicMessages.find(messageType) == publicMessages.end();
@@ -2173,7 +2792,7 @@ namespace Blokus::Server
             std::string sessionId = session_ ? session_->getSessionId() : "unknown";
             std::string messageTypeStr = messageTypeToString(messageType);
 
-            spdlog::warn(" 보안 위반: 세션 {} - 메시지 타입 {} - {}",
+            BLOKUS_LOG_RATE_LIMITED(spdlog::level::warn, 1000, " 보안 위반: 세션 {} - 메시지 타입 {} - {}",
                         sessionId, messageTypeStr, details);
 
             // 추가 보안 로깅이 필요한 경우 여기에 구현
@@ -0,0 +1,154 @@
+#include "MetricsEndpoint.h"
+#include "ServerMetrics.h"
+#include "Tracing.h"
+#include <spdlog/spdlog.h>
+
+namespace Blokus {
+    namespace Server {
+
+        namespace {
+            constexpr size_t MAX_REQUEST_SIZE = 8192;
+            constexpr auto REQUEST_TIMEOUT = std::chrono::seconds(5);
+
+            std::string buildResponse(const std::string& status, const std::string& contentType, const std::string& body) {
+                std::string response;
+                response.reserve(body.size() + 128);
+                response += "HTTP/1.1 " + status + "\r\n";
+                response += "Content-Type: " + contentType + "\r\n";
+                response += "Content-Length: " + std::to_string(body.size()) + "\r\n";
+                response += "Connection: close\r\n\r\n";
+                response += body;
+                return response;
+            }
+        }
+
+        // ========================================
+        // 생성자/소멸자
+        // ========================================
+
+        MetricsEndpoint::MetricsEndpoint(boost::asio::io_context& ioContext)
+            : m_ioContext(ioContext)
+            , m_acceptor(ioContext)
+        {
+        }
+
+        MetricsEndpoint::~MetricsEndpoint() {
+            stop();
+        }
+
+        // ========================================
+        // 시작/종료
+        // ========================================
+
+        bool MetricsEndpoint::start(const std::string& bindAddress, int port) {
+            try {
+                auto address = boost::asio::ip::make_address(bindAddress);
+                boost::asio::ip::tcp::endpoint endpoint(address, static_cast<unsigned short>(port));
+
+                m_acceptor.open(endpoint.protocol());
+                m_acceptor.set_option(boost::asio::ip::tcp::acceptor::reuse_address(true));
+                m_acceptor.bind(endpoint);
+                m_acceptor.listen();
+            }
+            catch (const std::exception& e) {
+                spdlog::error("메트릭 엔드포인트 시작 실패 ({}:{}): {}", bindAddress, port, e.what());
+                return false;
+            }
+
+            m_running = true;
+            startAccept();
+
+            spdlog::info("메트릭 엔드포인트 시작: http://{}:{}/metrics", bindAddress, port);
+            return true;
+        }
+
+        void MetricsEndpoint::stop() {
+            if (!m_running.exchange(false)) {
+                return;
+            }
+
+            boost::system::error_code ec;
+            m_acceptor.close(ec);
+        }
+
+        // ========================================
+        // 요청 처리
+        // ========================================
+
+        void MetricsEndpoint::startAccept() {
+            auto socket = std::make_shared<boost::asio::ip::tcp::socket>(m_ioContext);
+            m_acceptor.async_accept(*socket, [this, socket](const boost::system::error_code& error) {
+                if (!m_running.load()) {
+                    return;
+                }
+                if (!error) {
+                    handleConnection(socket);
+                }
+                startAccept();
+            });
+        }
+
+        void MetricsEndpoint::handleConnection(std::shared_ptr<boost::asio::ip::tcp::socket> socket) {
+            auto buffer = std::make_shared<boost::asio::streambuf>(MAX_REQUEST_SIZE);
+
+            // 요청을 끝까지 보내지 않는 연결이 남지 않도록 제한 시간 후 닫음
+            auto timer = std::make_shared<boost::asio::steady_timer>(m_ioContext, REQUEST_TIMEOUT);
+            timer->async_wait([socket](const boost::system::error_code& error) {
+                if (!error) {
+                    boost::system::error_code ignored;
+                    socket->close(ignored);
+                }
+            });
+
+            boost::asio::async_read_until(*socket, *buffer, "\r\n\r\n",
+                [this, socket, buffer, timer](const boost::system::error_code& error, size_t /*bytes*/) {
+                    timer->cancel();
+                    if (error) {
+                        return;
+                    }
+
+                    // 요청 라인만 확인 (예: "GET /metrics HTTP/1.1")
+                    std::istream stream(buffer.get());
+                    std::string method, target;
+                    stream >> method >> target;
+
+                    auto response = std::make_shared<std::string>();
+                    if (method != "GET") {
+                        *response = buildResponse("405 Method Not Allowed", "text/plain", "method not allowed\n");
+                    }
+                    else if (target == "/metrics" || target.rfind("/metrics?", 0) == 0) {
+                        ++m_scrapeCount;
+                        *response = buildResponse("200 OK", "text/plain; version=0.0.4; charset=utf-8",
+                            ServerMetrics::instance().renderPrometheus());
+                    }
+                    else if (target == "/trace") {
+                        *response = buildResponse("200 OK", "application/json", Tracer::dumpChromeTrace());
+                    }
+                    else if (target.rfind("/trace/sample?every=", 0) == 0) {
+                        // 재시작 없이 샘플링 비율 변경 (0 = 끔)
+                        try {
+                            int every = std::stoi(target.substr(std::string("/trace/sample?every=").size()));
+                            Tracer::setSampleEvery(every);
+                            spdlog::info("추적 샘플링 비율 변경: 1/{}", Tracer::getSampleEvery());
+                            *response = buildResponse("200 OK", "text/plain",
+                                "sample_every=" + std::to_string(Tracer::getSampleEvery()) + "\n");
+                        }
+                        catch (const std::exception&) {
+                            *response = buildResponse("400 Bad Request", "text/plain", "invalid every\n");
+                        }
+                    }
+                    else {
+                        *response = buildResponse("404 Not Found", "text/plain", "not found\n");
+                    }
+
+                    boost::asio::async_write(*socket, boost::asio::buffer(*response),
+                        [socket, response](const boost::system::error_code& /*writeError*/, size_t /*written*/) {
+                            boost::system::error_code ignored;
+                            socket->shutdown(boost::asio::ip::tcp::socket::shutdown_both, ignored);
+                            socket->close(ignored);
+                        });
+                });
+        }
+
+    } // namespace Server
+} // namespace Blokus
@@ -27,6 +27,9 @@ namespace Blokus::Server {
     PlayerInfo::PlayerInfo(const std::string& userId, const std::string& username, SessionPtr session)
         : PlayerInfo(session)
     {
+        seatUserId_ = userId;
+        seatUsername_ = username;
+
         // 세션이 있다면 검증, 없다면 경고만
         if (session_ && (session_->getUserId() != userId || session_->getUsername() != username)) {
             spdlog::warn("PlayerInfo: provided user info doesn't match session - User: {}/{}, Session: {}/{}",
@@ -37,6 +40,9 @@ namespace Blokus::Server {
     // 복사 생성자
     PlayerInfo::PlayerInfo(const PlayerInfo& other)
         : session_(other.session_)
+        , seatUserId_(other.seatUserId_)
+        , seatUsername_(other.seatUsername_)
+        , seatDisplayName_(other.seatDisplayName_)
         , color_(other.color_)
         , isHost_(other.isHost_)
         , isReady_(other.isReady_)
@@ -50,6 +56,9 @@ namespace Blokus::Server {
     PlayerInfo& PlayerInfo::operator=(const PlayerInfo& other) {
         if (this != &other) {
             session_ = other.session_;
+            seatUserId_ = other.seatUserId_;
+            seatUsername_ = other.seatUsername_;
+            seatDisplayName_ = other.seatDisplayName_;
             color_ = other.color_;
             isHost_ = other.isHost_;
             isReady_ = other.isReady_;
@@ -63,6 +72,9 @@ namespace Blokus::Server {
     // 이동 생성자
     PlayerInfo::PlayerInfo(PlayerInfo&& other) noexcept
         : session_(std::move(other.session_))
+        , seatUserId_(std::move(other.seatUserId_))
+        , seatUsername_(std::move(other.seatUsername_))
+        , seatDisplayName_(std::move(other.seatDisplayName_))
         , color_(other.color_)
         , isHost_(other.isHost_)
         , isReady_(other.isReady_)
@@ -76,6 +88,9 @@ namespace Blokus::Server {
     PlayerInfo& PlayerInfo::operator=(PlayerInfo&& other) noexcept {
         if (this != &other) {
             session_ = std::move(other.session_);
+            seatUserId_ = std::move(other.seatUserId_);
+            seatUsername_ = std::move(other.seatUsername_);
+            seatDisplayName_ = std::move(other.seatDisplayName_);
             color_ = other.color_;
             isHost_ = other.isHost_;
             isReady_ = other.isReady_;
@@ -249,6 +264,7 @@ namespace Blokus::Server {
         // 기본 정보 (세션에서 가져옴)
         j["userId"] = getUserId();
         j["username"] = getUsername();
+        j["displayName"] = getDisplayName();
         j["isConnected"] = isConnected();
 
         // 게임 상태
@@ -270,6 +286,13 @@ namespace Blokus::Server {
         PlayerInfo player(session);
 
         try {
+            // 세션 없이 복원하는 좌석은 JSON의 사용자 정보로 식별
+            if (!session) {
+                player.seatUserId_ = json.value("userId", "");
+                player.seatUsername_ = json.value("username", "");
+                player.seatDisplayName_ = json.value("displayName", "");
+            }
+
             // 게임 상태 복원
             if (json.contains("color")) {
                 player.color_ = static_cast<Common::PlayerColor>(json["color"].get<int>());
@@ -0,0 +1,103 @@
+#include "RegisteredBufferPool.h"
+#include <spdlog/spdlog.h>
+#include <algorithm>
+
+namespace Blokus {
+    namespace Server {
+
+        // ========================================
+        // 생성자/소멸자
+        // ========================================
+
+        RegisteredBufferPool::RegisteredBufferPool(boost::asio::io_context& ioContext, size_t slotCount, size_t slotSize)
+            : m_slotCount(std::max<size_t>(1, slotCount))
+            , m_slotSize(std::max<size_t>(1, slotSize))
+            , m_storage(m_slotCount * m_slotSize)
+        {
+            // 낮은 번호 슬롯부터 쓰도록 역순으로 쌓음
+            m_freeSlots.reserve(m_slotCount);
+            for (size_t i = m_slotCount; i > 0; --i) {
+                m_freeSlots.push_back(i - 1);
+            }
+
+#ifdef BLOKUS_IO_URING
+            try {
+                std::vector<boost::asio::mutable_buffer> buffers;
+                buffers.reserve(m_slotCount);
+                for (size_t i = 0; i < m_slotCount; ++i) {
+                    buffers.push_back(buffer(i));
+                }
+                m_registration.emplace(boost::asio::register_buffers(ioContext, buffers));
+            }
+            catch (const std::exception& e) {
+                // RLIMIT_MEMLOCK 부족 등: 일반 버퍼로 계속 동작
+                spdlog::warn("io_uring 버퍼 등록 실패, 일반 버퍼 사용: {}", e.what());
+                m_registration.reset();
+            }
+#else
+            (void)ioContext;
+#endif
+
+            spdlog::info("세션 읽기 버퍼 풀 초기화 ({} x {} bytes, 백엔드: {}, 등록: {})",
+                m_slotCount, m_slotSize, compiledBackend(), isRegistered() ? "예" : "아니오");
+        }
+
+        RegisteredBufferPool::~RegisteredBufferPool() {
+#ifdef BLOKUS_IO_URING
+            m_registration.reset();
+#endif
+        }
+
+        const char* RegisteredBufferPool::compiledBackend() {
+#if defined(BLOKUS_IO_URING) && defined(BOOST_ASIO_DISABLE_EPOLL)
+            return "io_uring";
+#else
+            return "epoll";
+#endif
+        }
+
+        // ========================================
+        // 슬롯 관리
+        // ========================================
+
+        std::optional<size_t> RegisteredBufferPool::acquire() {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (m_freeSlots.empty()) {
+                return std::nullopt;
+            }
+
+            size_t slot = m_freeSlots.back();
+            m_freeSlots.pop_back();
+            return slot;
+        }
+
+        void RegisteredBufferPool::release(size_t slot) {
+            if (slot >= m_slotCount) {
+                return;
+            }
+
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_freeSlots.push_back(slot);
+        }
+
+        bool RegisteredBufferPool::isRegistered() const {
+#ifdef BLOKUS_IO_URING
+            return m_registration.has_value();
+#else
+            return false;
+#endif
+        }
+
+#ifdef BLOKUS_IO_URING
+        boost::asio::mutable_registered_buffer RegisteredBufferPool::registeredBuffer(size_t slot) {
+            return (*m_registration)[slot];
+        }
+#endif
+
+        size_t RegisteredBufferPool::inUse() const {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            return m_slotCount - m_freeSlots.size();
+        }
+
+    } // namespace Server
+} // namespace Blokus
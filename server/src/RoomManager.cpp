@@ -1,8 +1,10 @@
 ﻿#include "RoomManager.h"
 #include "DatabaseManager.h"
+#include "ConfigManager.h"
 #include <spdlog/spdlog.h>
 #include <algorithm>
 #include <random>
+#include <sstream>
 
 namespace Blokus {
     namespace Server {
@@ -16,8 +18,12 @@ namespace Blokus {
             , m_maxRooms(100)     // 최대 100개 방
             , m_maxPlayersPerRoom(Common::MAX_PLAYERS)
             , m_eventCallback(nullptr)
+            , m_roomListVersion(0)
             , m_databaseManager(nullptr)
         {
+            rebuildRoomListSnapshotLocked();
+            initializeSpectatorPool();
+
             spdlog::debug(" RoomManager 초기화 (최대 방: {}, 최대 플레이어/방: {})",
                 m_maxRooms, m_maxPlayersPerRoom);
         }
@@ -27,14 +33,24 @@ namespace Blokus {
             , m_maxRooms(100)
             , m_maxPlayersPerRoom(Common::MAX_PLAYERS)
             , m_eventCallback(nullptr)
+            , m_roomListVersion(0)
             , m_databaseManager(dbManager)
         {
+            rebuildRoomListSnapshotLocked();
+            initializeSpectatorPool();
+
             spdlog::debug(" RoomManager 초기화 with DB (최대 방: {}, 최대 플레이어/방: {})",
                 m_maxRooms, m_maxPlayersPerRoom);
         }
 
         RoomManager::~RoomManager() {
             removeAllRooms();
+
+            // 남은 팬아웃 작업을 마치고 풀 종료 (채널 타이머가 풀보다 먼저 정리되도록 방 제거 후 수행)
+            if (m_spectatorPool) {
+                m_spectatorPool->join();
+                m_spectatorPool.reset();
+            }
             spdlog::debug(" RoomManager 소멸");
         }
         
@@ -47,12 +63,38 @@ namespace Blokus {
             return m_databaseManager;
         }
 
+        // ========================================
+        // 관전
+        // ========================================
+
+        void RoomManager::initializeSpectatorPool() {
+            if (!ConfigManager::spectatorEnabled) {
+                return;
+            }
+
+            m_spectatorOptions.maxViewers = static_cast<size_t>(std::max(0, ConfigManager::spectatorMaxPerRoom));
+            m_spectatorOptions.maxPendingFrames = static_cast<size_t>(std::max(1, ConfigManager::spectatorMaxPendingFrames));
+            m_spectatorOptions.shardSize = static_cast<size_t>(std::max(1, ConfigManager::spectatorShardSize));
+            m_spectatorOptions.maxLogEntries = static_cast<size_t>(std::max(1, ConfigManager::spectatorLogEntries));
+
+            size_t threads = static_cast<size_t>(std::max(1, ConfigManager::spectatorFanoutThreads));
+            m_spectatorPool = std::make_unique<boost::asio::thread_pool>(threads);
+            spdlog::debug(" 관전 팬아웃 풀 시작 (스레드: {}, 방당 최대 관전자: {})", threads, m_spectatorOptions.maxViewers);
+        }
+
+        SpectatorChannelPtr RoomManager::createSpectatorChannel(int roomId) {
+            if (!m_spectatorPool) {
+                return nullptr;
+            }
+            return std::make_shared<SpectatorChannel>(roomId, m_spectatorPool->get_executor(), m_spectatorOptions);
+        }
+
         // ========================================
         // 방 생성/삭제
         // ========================================
 
         int RoomManager::createRoom(const std::string& hostId, const std::string& hostUsername,
-            const std::string& roomName, bool isPrivate, const std::string& password) {
+            const std::string& roomName, bool isPrivate, const std::string& password, bool allowSpectators) {
 
             // 1. 입력 검증
             if (!validateRoomCreation(roomName)) {
@@ -77,13 +119,15 @@ namespace Blokus {
             // 4. 새 방 생성
             int roomId = m_nextRoomId++;
             auto room = std::make_shared<GameRoom>(roomId, roomName, hostId, this);
+            room->setAllowSpectators(allowSpectators);
 
             m_rooms[roomId] = room;
 
-            spdlog::info(" 방 생성 성공: ID={}, Name='{}', Host='{}', Private={}",
-                roomId, roomName, hostUsername, isPrivate);
+            spdlog::info(" 방 생성 성공: ID={}, Name='{}', Host='{}', Private={}, Spectators={}",
+                roomId, roomName, hostUsername, isPrivate, allowSpectators);
 
-            // 5. 이벤트 발생
+            // 5. 이벤트 발생 (방 목록 캐시 갱신 시 getRoom()을 사용하므로 락 해제 후 호출)
+            roomLock.unlock();
             triggerRoomEvent(roomId, "ROOM_CREATED", roomName);
 
             return roomId;
@@ -107,7 +151,9 @@ namespace Blokus {
             }
 
             m_rooms.erase(it);
+            roomLock.unlock();
 
+            room->closeSpectators();
             spdlog::info(" 방 제거: ID={}, Name='{}'", roomId, room->getRoomName());
             triggerRoomEvent(roomId, "ROOM_REMOVED", room->getRoomName());
 
@@ -119,9 +165,19 @@ namespace Blokus {
             std::unique_lock<std::shared_mutex> playerLock(m_playerMappingMutex);
 
             size_t roomCount = m_rooms.size();
+            for (auto& [roomId, room] : m_rooms) {
+                room->closeSpectators();
+            }
             m_rooms.clear();
             m_playerToRoom.clear();
 
+            {
+                std::lock_guard<std::mutex> listLock(m_roomListMutex);
+                m_roomListRows.clear();
+                ++m_roomListVersion;
+                rebuildRoomListSnapshotLocked();
+            }
+
             spdlog::info("🧹 모든 방 제거: {} 개", roomCount);
         }
 
@@ -388,6 +444,274 @@ namespace Blokus {
                 });
         }
 
+        // ========================================
+        // 무중단 배포 (방 이전)
+        // ========================================
+
+        std::vector<std::string> RoomManager::exportPlayingRooms() {
+            std::vector<std::string> snapshots;
+            for (const auto& room : getPlayingRooms()) {
+                std::string snapshot = room->exportMigrationSnapshot();
+                if (!snapshot.empty()) {
+                    snapshots.push_back(std::move(snapshot));
+                }
+            }
+            return snapshots;
+        }
+
+        bool RoomManager::restoreRoom(const std::string& snapshot, std::chrono::seconds seatGrace) {
+            auto room = GameRoom::fromMigrationSnapshot(snapshot, this);
+            if (!room) {
+                return false;
+            }
+
+            int roomId = room->getRoomId();
+            {
+                std::unique_lock<std::shared_mutex> roomLock(m_roomsMutex);
+                if (m_rooms.count(roomId)) {
+                    spdlog::warn(" 방 복원 실패: 방 ID {} 이미 사용 중", roomId);
+                    return false;
+                }
+                m_rooms[roomId] = room;
+
+                // 새로 만드는 방이 복원된 방 ID와 겹치지 않도록
+                int nextRoomId = m_nextRoomId.load();
+                while (nextRoomId <= roomId && !m_nextRoomId.compare_exchange_weak(nextRoomId, roomId + 1)) {
+                }
+            }
+
+            auto deadline = std::chrono::steady_clock::now() + seatGrace;
+            {
+                std::lock_guard<std::mutex> seatLock(m_migratedSeatsMutex);
+                for (const auto& player : room->getPlayerList()) {
+                    updatePlayerMapping(player.getUserId(), roomId);
+                    m_migratedSeats[player.getUserId()] = MigratedSeat{ roomId, deadline };
+                }
+            }
+
+            spdlog::info(" 방 복원 성공: ID={}, Name='{}', 플레이어 {}명", roomId, room->getRoomName(), room->getPlayerCount());
+            triggerRoomEvent(roomId, "ROOM_CREATED", room->getRoomName());
+            return true;
+        }
+
+        GameRoomPtr RoomManager::claimMigratedSeat(const std::string& userId) {
+            int roomId = -1;
+            {
+                std::lock_guard<std::mutex> lock(m_migratedSeatsMutex);
+                auto it = m_migratedSeats.find(userId);
+                if (it == m_migratedSeats.end()) {
+                    return nullptr;
+                }
+                roomId = it->second.roomId;
+                m_migratedSeats.erase(it);
+            }
+
+            // 유예 중에 게임이 끝나 좌석이 정리됐을 수 있음
+            auto room = getRoom(roomId);
+            if (!room || !room->hasPlayer(userId)) {
+                return nullptr;
+            }
+            return room;
+        }
+
+        size_t RoomManager::expireMigratedSeats(std::chrono::steady_clock::time_point now) {
+            std::vector<std::pair<std::string, int>> expired;
+            {
+                std::lock_guard<std::mutex> lock(m_migratedSeatsMutex);
+                for (auto it = m_migratedSeats.begin(); it != m_migratedSeats.end();) {
+                    if (it->second.deadline <= now) {
+                        expired.emplace_back(it->first, it->second.roomId);
+                        it = m_migratedSeats.erase(it);
+                    }
+                    else {
+                        ++it;
+                    }
+                }
+            }
+
+            size_t removed = 0;
+            for (const auto& [userId, roomId] : expired) {
+                auto room = getRoom(roomId);
+                const PlayerInfo* player = room ? room->getPlayer(userId) : nullptr;
+                if (player && !player->getSession() && leaveRoom(roomId, userId)) {
+                    spdlog::info(" 복원 좌석 정리: 플레이어 '{}' 방 {} (재접속 유예 만료)", userId, roomId);
+                    ++removed;
+                }
+            }
+            return removed;
+        }
+
+        // ========================================
+        // 방 목록 캐시
+        // ========================================
+
+        std::string RoomManager::getRoomListMessage() const {
+            std::lock_guard<std::mutex> lock(m_roomListMutex);
+            return m_roomListSnapshot;
+        }
+
+        uint64_t RoomManager::getRoomListVersion() const {
+            std::lock_guard<std::mutex> lock(m_roomListMutex);
+            return m_roomListVersion;
+        }
+
+        void RoomManager::sendRoomListSnapshot(SessionPtr session) {
+            if (!session) return;
+
+            std::lock_guard<std::mutex> lock(m_roomListMutex);
+            sendRoomListSnapshotLocked(session);
+        }
+
+        void RoomManager::subscribeRoomList(SessionPtr session) {
+            if (!session) return;
+
+            // 구독 등록과 스냅샷 전송을 같은 락 안에서 처리해야 그 사이의 델타가 유실되지 않음
+            std::lock_guard<std::mutex> lock(m_roomListMutex);
+            m_roomListSubscribers[session->getSessionId()] = session;
+            sendRoomListSnapshotLocked(session);
+
+            spdlog::debug("📋 방 목록 구독: {} (버전: {}, 구독자: {}명)",
+                session->getSessionId(), m_roomListVersion, m_roomListSubscribers.size());
+        }
+
+        void RoomManager::unsubscribeRoomList(const std::string& sessionId) {
+            std::lock_guard<std::mutex> lock(m_roomListMutex);
+            m_roomListSubscribers.erase(sessionId);
+        }
+
+        void RoomManager::updateRoomListEntry(const Common::RoomInfo& info, bool insertIfMissing) {
+            std::string row = serializeRoomListRow(info);
+
+            std::lock_guard<std::mutex> lock(m_roomListMutex);
+
+            auto it = m_roomListRows.find(info.roomId);
+            if (it == m_roomListRows.end()) {
+                // 이미 제거된 방이 뒤늦게 갱신되어 되살아나지 않도록 생성 이벤트에서만 삽입
+                if (!insertIfMissing) return;
+                m_roomListRows.emplace(info.roomId, row);
+            }
+            else if (it->second == row) {
+                return; // 목록에 보이는 정보 변화 없음 (준비 상태 변경 등)
+            }
+            else {
+                it->second = row;
+            }
+
+            ++m_roomListVersion;
+            rebuildRoomListSnapshotLocked();
+            publishRoomListDeltaLocked("ROOM_LIST_DELTA:" + std::to_string(m_roomListVersion) + ":U:" + row);
+
+            if (m_roomListListener) {
+                m_roomListListener(info.roomId, &row);
+            }
+        }
+
+        void RoomManager::refreshRoomListEntry(int roomId, bool isNewRoom) {
+            auto room = getRoom(roomId);
+            if (!room) {
+                removeRoomListEntry(roomId);
+                return;
+            }
+
+            // 방 뮤텍스 안에서 갱신해야 GameRoom 내부 갱신과 순서가 뒤바뀌지 않음
+            room->publishRoomListEntry(isNewRoom);
+        }
+
+        void RoomManager::removeRoomListEntry(int roomId) {
+            std::lock_guard<std::mutex> lock(m_roomListMutex);
+
+            if (m_roomListRows.erase(roomId) == 0) return;
+
+            ++m_roomListVersion;
+            rebuildRoomListSnapshotLocked();
+            publishRoomListDeltaLocked("ROOM_LIST_DELTA:" + std::to_string(m_roomListVersion) + ":D:" + std::to_string(roomId));
+
+            if (m_roomListListener) {
+                m_roomListListener(roomId, nullptr);
+            }
+        }
+
+        void RoomManager::setRoomListListener(RoomListListener listener) {
+            // 호출 중인 리스너와 겹치지 않도록 방 목록 락 안에서 교체
+            std::lock_guard<std::mutex> lock(m_roomListMutex);
+            m_roomListListener = std::move(listener);
+        }
+
+        void RoomManager::applyRemoteRoomListRow(int roomId, const std::string* row) {
+            // 방 ID 대역이 겹치게 설정된 경우에도 로컬 방 행을 덮어쓰지 않음
+            if (hasRoom(roomId)) {
+                spdlog::warn("다른 노드의 방 ID {}가 로컬 방과 겹침 (CLUSTER_NODE_INDEX 확인 필요)", roomId);
+                return;
+            }
+
+            std::lock_guard<std::mutex> lock(m_roomListMutex);
+
+            std::string delta;
+            if (row) {
+                auto it = m_roomListRows.find(roomId);
+                if (it != m_roomListRows.end() && it->second == *row) return;
+                m_roomListRows[roomId] = *row;
+                ++m_roomListVersion;
+                delta = "ROOM_LIST_DELTA:" + std::to_string(m_roomListVersion) + ":U:" + *row;
+            }
+            else {
+                if (m_roomListRows.erase(roomId) == 0) return;
+                ++m_roomListVersion;
+                delta = "ROOM_LIST_DELTA:" + std::to_string(m_roomListVersion) + ":D:" + std::to_string(roomId);
+            }
+
+            rebuildRoomListSnapshotLocked();
+            publishRoomListDeltaLocked(delta);
+        }
+
+        void RoomManager::rebuildRoomListSnapshotLocked() {
+            std::string snapshot = "ROOM_LIST:" + std::to_string(m_roomListRows.size());
+            for (const auto& [roomId, row] : m_roomListRows) {
+                snapshot += ':';
+                snapshot += row;
+            }
+            m_roomListSnapshot = std::move(snapshot);
+        }
+
+        void RoomManager::sendRoomListSnapshotLocked(const SessionPtr& session) const {
+            session->sendMessage(m_roomListSnapshot);
+
+            // 구독자에게는 이후 델타 적용 기준이 되는 버전을 함께 전송
+            if (m_roomListSubscribers.count(session->getSessionId())) {
+                session->sendMessage("ROOM_LIST_VERSION:" + std::to_string(m_roomListVersion));
+            }
+        }
+
+        void RoomManager::publishRoomListDeltaLocked(const std::string& delta) {
+            auto it = m_roomListSubscribers.begin();
+            while (it != m_roomListSubscribers.end()) {
+                auto session = it->second.lock();
+                if (!session || !session->isActive()) {
+                    it = m_roomListSubscribers.erase(it);
+                    continue;
+                }
+
+                // 방/게임 중인 구독자는 로비 복귀 시 스냅샷으로 다시 동기화됨
+                if (session->isInLobby()) {
+                    session->sendMessage(delta);
+                }
+                ++it;
+            }
+        }
+
+        std::string RoomManager::serializeRoomListRow(const Common::RoomInfo& info) {
+            std::ostringstream row;
+            row << info.roomId
+                << "," << info.roomName
+                << "," << info.hostName
+                << "," << info.currentPlayers
+                << "," << info.maxPlayers
+                << "," << (info.isPrivate ? "1" : "0")
+                << "," << (info.isPlaying ? "1" : "0")
+                << "," << info.gameMode;
+            return row.str();
+        }
+
         // ========================================
         // 플레이어 검색
         // ========================================
@@ -449,47 +773,59 @@ namespace Blokus {
         // ========================================
 
         void RoomManager::cleanupEmptyRooms() {
-            std::unique_lock<std::shared_mutex> lock(m_roomsMutex);
-
-            auto it = m_rooms.begin();
-            size_t removedCount = 0;
-
-            while (it != m_rooms.end()) {
-                if (it->second->isEmpty()) {
-                    spdlog::debug("🧹 빈 방 정리: ID={}", it->first);
-                    it = m_rooms.erase(it);
-                    ++removedCount;
-                }
-                else {
-                    ++it;
+            std::vector<int> removedRoomIds;
+
+            {
+                std::unique_lock<std::shared_mutex> lock(m_roomsMutex);
+
+                auto it = m_rooms.begin();
+                while (it != m_rooms.end()) {
+                    if (it->second->isEmpty()) {
+                        spdlog::debug("🧹 빈 방 정리: ID={}", it->first);
+                        removedRoomIds.push_back(it->first);
+                        it = m_rooms.erase(it);
+                    }
+                    else {
+                        ++it;
+                    }
                 }
             }
 
-            if (removedCount > 0) {
-                spdlog::info("🧹 빈 방 정리 완료: {} 개", removedCount);
+            for (int roomId : removedRoomIds) {
+                triggerRoomEvent(roomId, "ROOM_REMOVED");
+            }
+
+            if (!removedRoomIds.empty()) {
+                spdlog::info("🧹 빈 방 정리 완료: {} 개", removedRoomIds.size());
             }
         }
 
         void RoomManager::cleanupInactiveRooms(std::chrono::minutes threshold) {
-            std::unique_lock<std::shared_mutex> lock(m_roomsMutex);
-
-            auto it = m_rooms.begin();
-            size_t removedCount = 0;
-
-            while (it != m_rooms.end()) {
-                if (it->second->isInactive(threshold)) {
-                    spdlog::debug("🧹 비활성 방 정리: ID={} ({}분 비활성)",
-                        it->first, threshold.count());
-                    it = m_rooms.erase(it);
-                    ++removedCount;
-                }
-                else {
-                    ++it;
+            std::vector<int> removedRoomIds;
+
+            {
+                std::unique_lock<std::shared_mutex> lock(m_roomsMutex);
+
+                auto it = m_rooms.begin();
+                while (it != m_rooms.end()) {
+                    if (it->second->isInactive(threshold)) {
+                        spdlog::debug("🧹 비활성 방 정리: ID={} ({}분 비활성)",
+                            it->first, threshold.count());
+                        removedRoomIds.push_back(it->first);
+                        it = m_rooms.erase(it);
+                    }
+                    else {
+                        ++it;
+                    }
                 }
             }
 
-            if (removedCount > 0) {
-                spdlog::info("🧹 비활성 방 정리 완료: {} 개", removedCount);
+            for (int roomId : removedRoomIds) {
+                triggerRoomEvent(roomId, "ROOM_REMOVED");
+            }
+
+            if (!removedRoomIds.empty()) {
+                spdlog::info("🧹 비활성 방 정리 완료: {} 개", removedRoomIds.size());
             }
         }
 
@@ -498,6 +834,7 @@ namespace Blokus {
 
             for (const auto& [roomId, room] : m_rooms) {
                 room->cleanupDisconnectedPlayers();
+                room->publishRoomListEntry(); // 인원 변화를 방 목록 캐시에 반영
             }
         }
 
@@ -625,6 +962,14 @@ namespace Blokus {
         }
 
         void RoomManager::triggerRoomEvent(int roomId, const std::string& event, const std::string& data) {
+            // 모든 방 이벤트는 방 목록 행에 영향을 줄 수 있으므로 캐시 먼저 갱신
+            if (event == "ROOM_REMOVED") {
+                removeRoomListEntry(roomId);
+            }
+            else {
+                refreshRoomListEntry(roomId, event == "ROOM_CREATED");
+            }
+
             if (m_eventCallback) {
                 try {
                     m_eventCallback(roomId, event, data);
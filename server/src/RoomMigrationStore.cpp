@@ -0,0 +1,134 @@
+#include "RoomMigrationStore.h"
+#include <spdlog/spdlog.h>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace Blokus {
+    namespace Server {
+
+        namespace {
+            constexpr const char* FILE_MAGIC = "BLOKUS_ROOM_MIGRATION";
+
+            long long nowEpochMillis() {
+                return std::chrono::duration_cast<std::chrono::milliseconds>(
+                    std::chrono::system_clock::now().time_since_epoch()).count();
+            }
+        }
+
+        RoomMigrationStore::RoomMigrationStore(std::string path)
+            : m_path(std::move(path))
+        {
+        }
+
+        // ========================================
+        // 저장 (드레인 종료 시)
+        // ========================================
+
+        bool RoomMigrationStore::save(const std::vector<std::string>& snapshots) {
+            try {
+                std::filesystem::path path(m_path);
+                if (path.has_parent_path()) {
+                    std::filesystem::create_directories(path.parent_path());
+                }
+            }
+            catch (const std::exception& e) {
+                spdlog::error("방 이전 디렉토리 생성 실패 ({}): {}", m_path, e.what());
+            }
+
+            std::string tempPath = m_path + ".tmp";
+            FILE* file = std::fopen(tempPath.c_str(), "w");
+            if (!file) {
+                spdlog::error("방 이전 파일 열기 실패: {}", tempPath);
+                return false;
+            }
+#ifndef _WIN32
+            // 사용자 ID/좌석 정보가 들어가므로 소유자만 읽기/쓰기 (로그 볼륨에 함께 놓이는 경우 대비)
+            fchmod(fileno(file), S_IRUSR | S_IWUSR);
+#endif
+
+            std::string header = std::string(FILE_MAGIC) + " " + std::to_string(nowEpochMillis()) + "\n";
+            bool ok = std::fwrite(header.data(), 1, header.size(), file) == header.size();
+            for (const auto& snapshot : snapshots) {
+                std::string line = snapshot + "\n";
+                ok = ok && std::fwrite(line.data(), 1, line.size(), file) == line.size();
+            }
+
+            // 다음 프로세스가 바로 읽으므로 교체 전에 디스크까지 동기화
+            std::fflush(file);
+#ifdef _WIN32
+            _commit(_fileno(file));
+#else
+            fsync(fileno(file));
+#endif
+            std::fclose(file);
+
+            std::error_code ec;
+            if (!ok) {
+                std::filesystem::remove(tempPath, ec);
+                spdlog::error("방 이전 파일 기록 실패: {}", tempPath);
+                return false;
+            }
+
+            std::filesystem::rename(tempPath, m_path, ec);
+            if (ec) {
+                spdlog::error("방 이전 파일 교체 실패 ({}): {}", m_path, ec.message());
+                return false;
+            }
+
+            spdlog::info("💾 진행 중인 방 {}개를 이전 파일에 기록: {}", snapshots.size(), m_path);
+            return true;
+        }
+
+        // ========================================
+        // 복원 (시작 시)
+        // ========================================
+
+        std::vector<std::string> RoomMigrationStore::consume(std::chrono::seconds maxAge) {
+            std::vector<std::string> snapshots;
+
+            std::ifstream file(m_path);
+            if (!file.is_open()) {
+                return snapshots;
+            }
+
+            std::string line;
+            std::getline(file, line);
+
+            std::istringstream header(line);
+            std::string magic;
+            long long writtenAt = 0;
+            header >> magic >> writtenAt;
+
+            long long ageMs = nowEpochMillis() - writtenAt;
+            if (magic != FILE_MAGIC) {
+                spdlog::warn("방 이전 파일 형식 오류, 무시: {}", m_path);
+            }
+            else if (ageMs > std::chrono::duration_cast<std::chrono::milliseconds>(maxAge).count()) {
+                spdlog::warn("방 이전 파일이 너무 오래됨 ({}초 전), 무시: {}", ageMs / 1000, m_path);
+            }
+            else {
+                while (std::getline(file, line)) {
+                    if (!line.empty()) {
+                        snapshots.push_back(std::move(line));
+                    }
+                }
+            }
+            file.close();
+
+            // 같은 스냅샷을 두 번 복원하지 않도록 읽은 즉시 삭제
+            std::error_code ec;
+            std::filesystem::remove(m_path, ec);
+            return snapshots;
+        }
+
+    } // namespace Server
+} // namespace Blokus
@@ -0,0 +1,296 @@
+#include "ServerMetrics.h"
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <sstream>
+
+namespace Blokus {
+    namespace Server {
+
+        namespace {
+            std::atomic<size_t> g_nextShard{ 0 };
+
+            constexpr MessageType kAllMessageTypes[] = {
+                MessageType::Unknown,
+                MessageType::Ping,
+                MessageType::Auth, MessageType::Register, MessageType::Guest, MessageType::Logout, MessageType::Validate,
+                MessageType::Resume,
+                MessageType::Lobby, MessageType::LobbyEnter, MessageType::LobbyLeave, MessageType::LobbyList,
+                MessageType::Room, MessageType::RoomCreate, MessageType::RoomJoin, MessageType::RoomLeave,
+                MessageType::RoomList, MessageType::RoomReady, MessageType::RoomStart, MessageType::RoomEnd,
+                MessageType::RoomTransferHost, MessageType::RoomSpectate, MessageType::RoomSpectateLeave,
+                MessageType::Game, MessageType::GameMove, MessageType::GameEnd, MessageType::GameResultResponse,
+                MessageType::GameSync,
+                MessageType::Chat,
+                MessageType::UserStats, MessageType::UserSettings, MessageType::UserSettingsResponse,
+                MessageType::VersionCheck,
+                MessageType::Error
+            };
+
+            // Prometheus 버킷 경계 (지연 시간: 초 / 큐 깊이: 개수)
+            constexpr double kLatencyBucketsSeconds[] = {
+                0.0001, 0.00025, 0.0005, 0.001, 0.0025, 0.005, 0.01, 0.025, 0.05, 0.1, 0.25, 0.5, 1.0, 2.5, 5.0, 10.0
+            };
+            constexpr double kTurnBucketsSeconds[] = {
+                0.5, 1.0, 2.0, 5.0, 10.0, 15.0, 20.0, 25.0, 30.0, 45.0, 60.0
+            };
+            constexpr double kDepthBuckets[] = {
+                1, 2, 4, 8, 16, 32, 64, 128, 256, 512, 1024
+            };
+
+            std::string formatDouble(double value) {
+                std::ostringstream oss;
+                oss << std::setprecision(15) << value;
+                return oss.str();
+            }
+
+            void writeHeader(std::ostringstream& out, const char* name, const char* type, const char* help) {
+                out << "# HELP " << name << " " << help << "\n";
+                out << "# TYPE " << name << " " << type << "\n";
+            }
+
+            void writeCounter(std::ostringstream& out, const char* name, const char* help, uint64_t value) {
+                writeHeader(out, name, "counter", help);
+                out << name << " " << value << "\n";
+            }
+
+            void writeGauge(std::ostringstream& out, const char* name, const char* help, int64_t value) {
+                writeHeader(out, name, "gauge", help);
+                out << name << " " << value << "\n";
+            }
+
+            // scale: 버킷 경계를 히스토그램 원시 단위로 바꾸는 배율 (초 -> 마이크로초면 1e6)
+            template<size_t N>
+            void writeHistogramSeries(std::ostringstream& out, const std::string& name, const std::string& labels,
+                const Histogram& histogram, const double (&bounds)[N], double scale) {
+                std::string labelPrefix = labels.empty() ? "" : labels + ",";
+
+                for (double bound : bounds) {
+                    uint64_t rawBound = static_cast<uint64_t>(std::llround(bound * scale));
+                    out << name << "_bucket{" << labelPrefix << "le=\"" << formatDouble(bound) << "\"} "
+                        << histogram.countAtOrBelow(rawBound) << "\n";
+                }
+
+                uint64_t count = histogram.count();
+                out << name << "_bucket{" << labelPrefix << "le=\"+Inf\"} " << count << "\n";
+
+                std::string labelBlock = labels.empty() ? "" : "{" + labels + "}";
+                out << name << "_sum" << labelBlock << " " << formatDouble(static_cast<double>(histogram.sum()) / scale) << "\n";
+                out << name << "_count" << labelBlock << " " << count << "\n";
+            }
+        }
+
+        // ========================================
+        // ShardedCounter
+        // ========================================
+
+        size_t ShardedCounter::shardIndex() {
+            thread_local size_t index = g_nextShard.fetch_add(1, std::memory_order_relaxed) % kShardCount;
+            return index;
+        }
+
+        // ========================================
+        // Histogram
+        // ========================================
+
+        void Histogram::record(uint64_t value) {
+            m_buckets[bucketIndex(value)].fetch_add(1, std::memory_order_relaxed);
+            m_count.add(1);
+            m_sum.add(value);
+
+            uint64_t prevMax = m_max.load(std::memory_order_relaxed);
+            while (value > prevMax && !m_max.compare_exchange_weak(prevMax, value, std::memory_order_relaxed)) {
+            }
+        }
+
+        uint64_t Histogram::percentile(double p) const {
+            uint64_t total = 0;
+            std::array<uint64_t, kBucketCount> snapshot;
+            for (int i = 0; i < kBucketCount; ++i) {
+                snapshot[i] = m_buckets[i].load(std::memory_order_relaxed);
+                total += snapshot[i];
+            }
+            if (total == 0) {
+                return 0;
+            }
+
+            uint64_t target = std::max<uint64_t>(1, static_cast<uint64_t>(std::ceil(p * static_cast<double>(total))));
+            uint64_t seen = 0;
+            for (int i = 0; i < kBucketCount; ++i) {
+                seen += snapshot[i];
+                if (seen >= target) {
+                    return std::min(bucketUpperBound(i), max());
+                }
+            }
+            return max();
+        }
+
+        uint64_t Histogram::countAtOrBelow(uint64_t bound) const {
+            uint64_t total = 0;
+            for (int i = 0; i < kBucketCount; ++i) {
+                if (bucketUpperBound(i) > bound) {
+                    break;
+                }
+                total += m_buckets[i].load(std::memory_order_relaxed);
+            }
+            return total;
+        }
+
+        int Histogram::bucketIndex(uint64_t value) {
+            if (value < kSubBuckets) {
+                return static_cast<int>(value);
+            }
+            int magnitude = 63 - __builtin_clzll(value);        // floor(log2)
+            int shift = magnitude - kSubBucketBits;
+            int sub = static_cast<int>((value >> shift) & (kSubBuckets - 1));
+            int index = (magnitude - kSubBucketBits + 1) * kSubBuckets + sub;
+            return std::min(index, kBucketCount - 1);
+        }
+
+        uint64_t Histogram::bucketUpperBound(int index) {
+            if (index < kSubBuckets) {
+                return static_cast<uint64_t>(index);
+            }
+            int magnitude = index / kSubBuckets + kSubBucketBits - 1;
+            int sub = index % kSubBuckets;
+            int shift = magnitude - kSubBucketBits;
+            return (static_cast<uint64_t>(kSubBuckets + sub + 1) << shift) - 1;
+        }
+
+        // ========================================
+        // ServerMetrics
+        // ========================================
+
+        ServerMetrics::ServerMetrics() {
+            for (MessageType type : kAllMessageTypes) {
+                m_messageHandleTimes.emplace(static_cast<int>(type), std::make_unique<Histogram>());
+            }
+        }
+
+        ServerMetrics& ServerMetrics::instance() {
+            static ServerMetrics metrics;
+            return metrics;
+        }
+
+        Histogram& ServerMetrics::messageHandleTime(MessageType type) {
+            auto it = m_messageHandleTimes.find(static_cast<int>(type));
+            if (it == m_messageHandleTimes.end()) {
+                it = m_messageHandleTimes.find(static_cast<int>(MessageType::Unknown));
+            }
+            return *it->second;
+        }
+
+        void ServerMetrics::setCollector(Collector collector) {
+            std::lock_guard<std::mutex> lock(m_collectorMutex);
+            m_collector = std::move(collector);
+        }
+
+        std::string ServerMetrics::renderPrometheus() {
+            {
+                std::lock_guard<std::mutex> lock(m_collectorMutex);
+                if (m_collector) {
+                    m_collector(*this);
+                }
+            }
+
+            std::ostringstream out;
+
+            auto uptime = std::chrono::duration_cast<std::chrono::seconds>(std::chrono::system_clock::now() - startTime).count();
+            writeGauge(out, "blokus_uptime_seconds", "Seconds since server start", uptime);
+
+            // 연결
+            writeCounter(out, "blokus_connections_accepted_total", "Accepted TCP connections", connectionsAccepted.value());
+            writeGauge(out, "blokus_connections_current", "Open client sessions", connectionsCurrent.value());
+            writeGauge(out, "blokus_connections_peak", "Peak concurrent client sessions", connectionsPeak.value());
+            writeCounter(out, "blokus_session_pool_reused_total", "Session blocks reused from the session pool",
+                static_cast<uint64_t>(sessionPoolReused.value()));
+            writeCounter(out, "blokus_session_pool_allocated_total", "Session blocks newly allocated because the pool was empty",
+                static_cast<uint64_t>(sessionPoolAllocated.value()));
+            writeCounter(out, "blokus_read_buffer_slabs_reused_total", "Read buffer slabs reused from the slab pool",
+                static_cast<uint64_t>(readBufferSlabsReused.value()));
+            writeCounter(out, "blokus_read_buffer_slabs_allocated_total", "Read buffer slabs newly allocated",
+                static_cast<uint64_t>(readBufferSlabsAllocated.value()));
+            writeGauge(out, "blokus_authenticated_sessions", "Authenticated sessions", authenticatedSessions.value());
+
+            // 입장 제어
+            writeCounter(out, "blokus_connections_rejected_ip_rate_total", "Connections refused by the per-IP connect rate limit", connectionsRejectedIpRate.value());
+            writeCounter(out, "blokus_connections_rejected_unauthenticated_total", "Connections refused because too many sessions were not logged in", connectionsRejectedUnauthenticated.value());
+            writeGauge(out, "blokus_unauthenticated_sessions", "Sessions holding an unauthenticated admission slot", unauthenticatedSessions.value());
+            writeCounter(out, "blokus_auth_deadline_drops_total", "Connections closed for staying idle before login", authDeadlineDrops.value());
+            writeCounter(out, "blokus_messages_rate_limited_total", "Client messages dropped by the per-session rate limit", messagesRateLimited.value());
+
+            // 송수신
+            writeCounter(out, "blokus_messages_received_total", "Messages received from clients", messagesReceived.value());
+            writeCounter(out, "blokus_messages_sent_total", "Messages written to clients", messagesSent.value());
+            writeCounter(out, "blokus_bytes_received_total", "Bytes received from clients", bytesReceived.value());
+            writeCounter(out, "blokus_bytes_sent_total", "Bytes written to clients", bytesSent.value());
+            writeCounter(out, "blokus_frames_compressed_total", "Frames sent compressed to clients that negotiated compression", framesCompressed.value());
+            writeCounter(out, "blokus_compression_bytes_in_total", "Uncompressed size of frames that were sent compressed", compressionBytesIn.value());
+            writeCounter(out, "blokus_compression_bytes_out_total", "Encoded size of compressed frames written", compressionBytesOut.value());
+
+            writeHeader(out, "blokus_send_queue_depth", "histogram", "Per-session send queue length at enqueue time");
+            writeHistogramSeries(out, "blokus_send_queue_depth", "", sendQueueDepth, kDepthBuckets, 1.0);
+
+            // 메시지 처리 시간 (한 번이라도 처리된 타입만)
+            writeHeader(out, "blokus_message_handle_seconds", "histogram", "Message handler execution time by message type");
+            for (MessageType type : kAllMessageTypes) {
+                const Histogram& histogram = *m_messageHandleTimes.at(static_cast<int>(type));
+                if (histogram.count() == 0) {
+                    continue;
+                }
+                std::string labels = "type=\"" + messageTypeToString(type) + "\"";
+                writeHistogramSeries(out, "blokus_message_handle_seconds", labels, histogram, kLatencyBucketsSeconds, 1e6);
+            }
+
+            // DB
+            writeHeader(out, "blokus_db_query_seconds", "histogram", "Database executor job execution time");
+            writeHistogramSeries(out, "blokus_db_query_seconds", "", dbQueryTime, kLatencyBucketsSeconds, 1e6);
+            writeGauge(out, "blokus_db_pending_jobs", "Database executor jobs queued or running", dbPendingJobs.value());
+
+            // 게임
+            writeGauge(out, "blokus_rooms", "Active rooms", activeRooms.value());
+            writeGauge(out, "blokus_players_in_rooms", "Players currently in rooms", playersInRooms.value());
+            writeCounter(out, "blokus_games_started_total", "Games started", gamesStarted.value());
+            writeHeader(out, "blokus_turn_duration_seconds", "histogram", "Time from turn start to the next turn or game end");
+            writeHistogramSeries(out, "blokus_turn_duration_seconds", "", turnDuration, kTurnBucketsSeconds, 1e6);
+            writeCounter(out, "blokus_board_snapshots_sent_total", "Packed board snapshots sent to players", boardSnapshotsSent.value());
+            writeCounter(out, "blokus_board_desyncs_total", "Client board hash mismatches detected", boardDesyncs.value());
+
+            // 관전
+            writeGauge(out, "blokus_spectators", "Connected spectators across all rooms", spectatorsCurrent.value());
+            writeCounter(out, "blokus_spectator_frames_sent_total", "Frames fanned out to spectators", spectatorFramesSent.value());
+            writeCounter(out, "blokus_spectator_resyncs_total", "Lagging spectators resynced from a snapshot", spectatorResyncs.value());
+
+            // 세션 재개
+            writeGauge(out, "blokus_sessions_awaiting_resume", "Disconnected seats held for resumption", sessionsAwaitingResume.value());
+            writeCounter(out, "blokus_session_resumes_total", "Sessions resumed with a resume token", sessionResumes.value());
+            writeCounter(out, "blokus_session_resume_replayed_events_total", "Room events replayed to resumed sessions", sessionResumeReplayedEvents.value());
+            writeCounter(out, "blokus_session_resume_resyncs_total", "Resumes that fell back to a full room snapshot", sessionResumeResyncs.value());
+            writeCounter(out, "blokus_session_resume_expired_total", "Held seats released after the grace window", sessionResumeExpired.value());
+
+            // 클러스터
+            writeGauge(out, "blokus_cluster_nodes", "Other cluster nodes currently known", clusterNodes.value());
+            writeCounter(out, "blokus_cluster_messages_published_total", "Messages published to the cluster bus", clusterMessagesPublished.value());
+            writeCounter(out, "blokus_cluster_messages_received_total", "Messages received from the cluster bus", clusterMessagesReceived.value());
+            writeCounter(out, "blokus_cluster_login_conflicts_total", "Local sessions dropped after losing a cross-node duplicate login", clusterLoginConflicts.value());
+
+            // 채팅
+            writeCounter(out, "blokus_chat_messages_total", "Lobby chat messages accepted", chatMessages.value());
+            writeCounter(out, "blokus_chat_batches_total", "Lobby chat batches flushed", chatBatches.value());
+            writeCounter(out, "blokus_chat_frames_sent_total", "Lobby chat frames written (one per recipient per batch)", chatFramesSent.value());
+            writeCounter(out, "blokus_chat_rate_limited_total", "Chat messages rejected by the per-user rate limit", chatRateLimited.value());
+
+            // 무중단 배포
+            writeCounter(out, "blokus_rooms_migrated_out_total", "Playing rooms handed off to the next process on drain", roomsMigratedOut.value());
+            writeCounter(out, "blokus_rooms_migrated_in_total", "Playing rooms restored from the previous process", roomsMigratedIn.value());
+            writeCounter(out, "blokus_migrated_seats_reclaimed_total", "Restored seats reclaimed by players logging back in", migratedSeatsReclaimed.value());
+
+            // 로깅
+            writeCounter(out, "blokus_log_messages_dropped_total", "Log messages dropped by the full async queue",
+                static_cast<uint64_t>(logMessagesDropped.value()));
+
+            return out.str();
+        }
+
+    } // namespace Server
+} // namespace Blokus
@@ -45,6 +45,7 @@ namespace Blokus
                 {"guest", MessageType::Guest},
                 {"logout", MessageType::Logout},
                 {"validate", MessageType::Validate},
+                {"resume", MessageType::Resume},
 
                 // 로비 관련
                 {"lobby:enter", MessageType::LobbyEnter},
@@ -60,11 +61,14 @@ namespace Blokus
                 {"room:start", MessageType::RoomStart},
                 {"room:end", MessageType::RoomEnd},
                 {"room:transfer", MessageType::RoomTransferHost},
+                {"room:spectate", MessageType::RoomSpectate},
+                {"room:unspectate", MessageType::RoomSpectateLeave},
 
                 // 게임 관련
                 {"game:move", MessageType::GameMove},
                 {"game:end", MessageType::GameEnd},
                 {"game:result", MessageType::GameResultResponse},
+                {"game:sync", MessageType::GameSync},
 
                 // 채팅 관련
                 {"chat", MessageType::Chat},
@@ -97,6 +101,8 @@ namespace Blokus
                 return "logout";
             case MessageType::Validate:
                 return "validate";
+            case MessageType::Resume:
+                return "resume";
             case MessageType::LobbyEnter:
                 return "lobby:enter";
             case MessageType::LobbyLeave:
@@ -119,12 +125,18 @@ namespace Blokus
                 return "room:end";
             case MessageType::RoomTransferHost:
                 return "room:transfer";
+            case MessageType::RoomSpectate:
+                return "room:spectate";
+            case MessageType::RoomSpectateLeave:
+                return "room:unspectate";
             case MessageType::GameMove:
                 return "game:move";
             case MessageType::GameEnd:
                 return "game:end";
             case MessageType::GameResultResponse:
                 return "game:result";
+            case MessageType::GameSync:
+                return "game:sync";
             case MessageType::Chat:
                 return "chat";
             case MessageType::UserStats:
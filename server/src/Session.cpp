@@ -1,17 +1,53 @@
 ﻿#include "Session.h"
 #include "MessageHandler.h"
 #include "GameServer.h"
+#include "AdmissionController.h"
+#include "RegisteredBufferPool.h"
+#include "BlockPool.h"
+#include "IoContextPool.h"
+#include "ServerMetrics.h"
+#include "Logging.h"
 #include <openssl/rand.h>
+#include <algorithm>
 #include <chrono>
-#include <iomanip>
-#include <sstream>
 
 namespace Blokus::Server {
 
+    namespace {
+        // 세션 블록 크기: 세션 + shared_ptr 제어 블록 여유분
+        constexpr size_t SESSION_BLOCK_SIZE = sizeof(Session) + 128;
+
+        // 세션 풀 / 읽기 버퍼 슬랩 풀은 의도적으로 해제하지 않음 (프로세스 종료 시 OS가 회수)
+        // - 함수 내 정적 객체로 두면 첫 세션 생성 시점에 만들어져 전역 g_server(main.cpp)보다 먼저 소멸함
+        //   g_server가 reset되지 않은 채 종료되면 GameServer가 정리하는 세션이 이미 소멸한 풀에 블록을 반환하게 됨
+        // - 누수 범위: 풀 객체 2개와 풀마다 보관 중인 블록 최대 SESSION_POOL_SIZE개 (종료 시 한 번)
+        BlockPool& sessionPool() {
+            static BlockPool* pool = new BlockPool(SESSION_BLOCK_SIZE, static_cast<size_t>(std::max(1, ConfigManager::sessionPoolSize)));
+            return *pool;
+        }
+
+        BlockPool& readBufferSlabs() {
+            static BlockPool* pool = new BlockPool(Session::MAX_MESSAGE_LENGTH, static_cast<size_t>(std::max(1, ConfigManager::sessionPoolSize)));
+            return *pool;
+        }
+    }
+
     // ========================================
     // 생성자 및 소멸자
     // ========================================
 
+    std::shared_ptr<Session> Session::create(boost::asio::ip::tcp::socket socket, GameServer* server) {
+        return std::allocate_shared<Session>(BlockPoolAllocator<Session>(sessionPool()), std::move(socket), server);
+    }
+
+    const BlockPool& Session::getSessionPool() {
+        return sessionPool();
+    }
+
+    const BlockPool& Session::getReadBufferSlabs() {
+        return readBufferSlabs();
+    }
+
     Session::Session(boost::asio::ip::tcp::socket socket, GameServer* server)
         : socket_(std::move(socket))
         , sessionId_(generateSessionId())
@@ -22,18 +58,30 @@ namespace Blokus::Server {
         , active_(true)
         , lastActivity_(std::chrono::steady_clock::now())
         , justLeftRoom_(false)
+        , authDeadlineTimer_(socket_.get_executor())
+        , messageBucket_(std::max(1, ConfigManager::sessionMessageBurst), std::chrono::steady_clock::now())
         , gameServer_(server)
         , remoteIP_("unknown")  // start()에서 설정
         , isRegisteredInServer_(false)
         , messageHandler_(nullptr)
         , writing_(false)
     {
-        spdlog::info("🔌 세션 생성: {} (상태: Connected)", sessionId_);
+        SPDLOG_DEBUG("🔌 세션 생성: {} (상태: Connected)", sessionId_);
     }
 
     Session::~Session() {
         spdlog::debug("🔌 세션 소멸: {}", sessionId_);
 
+        // 읽기 버퍼 슬롯 반환 (진행 중인 읽기가 없음이 보장되는 시점)
+        if (readBufferPool_ && readBufferSlot_) {
+            readBufferPool_->release(*readBufferSlot_);
+            readBufferSlot_.reset();
+        }
+        if (readBuffer_) {
+            readBufferSlabs().deallocate(readBuffer_, MAX_MESSAGE_LENGTH);
+            readBuffer_ = nullptr;
+        }
+
         // GameServer에서 활성 세션 해제
         if (gameServer_ && isRegisteredInServer_ && !userId_.empty()) {
             gameServer_->unregisterActiveSession(remoteIP_, userId_);
@@ -69,8 +117,25 @@ namespace Blokus::Server {
 
             state_ = ConnectionState::Connected;
             updateLastActivity();
+
+            // 공용 읽기 버퍼 슬롯 할당 (풀이 없거나 소진되면 재사용 슬랩 사용)
+            if (gameServer_) {
+                readBufferPool_ = gameServer_->getReadBufferPool(coreIndex_);
+                if (readBufferPool_) {
+                    readBufferSlot_ = readBufferPool_->acquire();
+                }
+            }
+            if (!readBufferSlot_ && !readBuffer_) {
+                readBuffer_ = static_cast<char*>(readBufferSlabs().allocate(MAX_MESSAGE_LENGTH));
+            }
+
             startRead();
 
+            // 접속 후 정해진 시간 안에 로그인하지 않는 연결은 정리 (로그인 전 메시지로는 연장되지 않음)
+            if (ConfigManager::authIdleDeadlineSeconds > 0) {
+                scheduleAuthDeadline(std::chrono::seconds(ConfigManager::authIdleDeadlineSeconds));
+            }
+
         }
         catch (const std::exception& e) {
             spdlog::error(" 세션 시작 중 오류 ({}): {}", sessionId_, e.what());
@@ -85,6 +150,7 @@ namespace Blokus::Server {
         }
 
         spdlog::debug("🔌 세션 중지: {}", sessionId_);
+        releaseAdmissionSlot();
 
         try {
             if (socket_.is_open()) {
@@ -106,9 +172,9 @@ namespace Blokus::Server {
     // ========================================
 
     bool Session::setAuthenticated(const std::string& userId, const std::string& username, std::string* errorMessage) {
-        // GameServer에 활성 세션 등록 시도 (중복 검증)
+        // GameServer에 활성 세션 등록 (중복 검증과 등록이 한 번에 이루어짐)
         if (gameServer_ && !isRegisteredInServer_) {
-            auto duplicateType = gameServer_->checkDuplicateType(remoteIP_, userId);
+            auto duplicateType = gameServer_->registerActiveSession(remoteIP_, userId);
 
             if (duplicateType != GameServer::DuplicateType::NONE) {
                 // 중복 타입별 에러 메시지 생성
@@ -123,8 +189,8 @@ namespace Blokus::Server {
                         spdlog::warn(" 중복 로그인 차단: 같은 사용자, 다른 IP - IP={}, UserID={}", remoteIP_, userId);
                         break;
                     case GameServer::DuplicateType::DIFF_USER_SAME_IP:
-                        error = "DUPLICATE_IP_DIFFERENT_USER:이 위치에서 이미 다른 계정이 로그인되어 있습니다";
-                        spdlog::warn(" 중복 로그인 차단: 다른 사용자, 같은 IP - IP={}, UserID={}", remoteIP_, userId);
+                        error = "DUPLICATE_IP_DIFFERENT_USER:이 위치에서 로그인한 계정 수가 한도에 도달했습니다";
+                        spdlog::warn(" 중복 로그인 차단: 같은 IP의 로그인 사용자 수 상한 - IP={}, UserID={}", remoteIP_, userId);
                         break;
                     default:
                         error = "DUPLICATE_LOGIN:중복 로그인이 감지되었습니다";
@@ -138,15 +204,6 @@ namespace Blokus::Server {
                 return false;  // 인증 실패
             }
 
-            // 등록 시도
-            if (!gameServer_->registerActiveSession(remoteIP_, userId)) {
-                spdlog::error(" 활성 세션 등록 실패: IP={}, UserID={}", remoteIP_, userId);
-                if (errorMessage) {
-                    *errorMessage = "SESSION_REGISTER_FAILED:세션 등록에 실패했습니다";
-                }
-                return false;
-            }
-
             isRegisteredInServer_ = true;
             spdlog::debug(" 활성 세션 등록 성공: IP={}, UserID={}", remoteIP_, userId);
         }
@@ -156,6 +213,8 @@ namespace Blokus::Server {
         state_ = ConnectionState::InLobby;  // 인증 완료 즉시 로비로
         currentRoomId_ = -1;
         updateLastActivity();
+        everAuthenticated_.store(true);
+        releaseAdmissionSlot();
 
         spdlog::info(" 세션 인증 완료: {} (사용자: '{}')", sessionId_, username);
         return true;  // 인증 성공
@@ -183,6 +242,13 @@ namespace Blokus::Server {
         spdlog::info("🔓 세션 인증 해제: {} (이전 사용자: '{}')", sessionId_, previousUsername);
     }
 
+    void Session::releaseActiveRegistration() {
+        if (gameServer_ && isRegisteredInServer_ && !userId_.empty()) {
+            gameServer_->unregisterActiveSession(remoteIP_, userId_);
+            isRegisteredInServer_ = false;
+        }
+    }
+
     void Session::setUserAccount(const UserAccount& account) {
         userAccount_ = account;
         spdlog::debug("💾 사용자 계정 정보 설정: {} (레벨: {}, 경험치: {})", 
@@ -262,24 +328,79 @@ namespace Blokus::Server {
 
     void Session::sendMessage(const std::string& message) {
         if (!active_.load() || !socket_.is_open()) {
-            spdlog::debug(" 비활성 세션에 메시지 전송 시도: {}", sessionId_);
+            SPDLOG_DEBUG(" 비활성 세션에 메시지 전송 시도: {}", sessionId_);
             return;
         }
 
-        try {
-            std::lock_guard<std::mutex> lock(sendMutex_);
+        sendFrame(makeFrame(message));
+    }
 
-            outgoingMessages_.push(message + "\n");
+    void Session::sendFrame(SharedFrame frame, uint64_t roomSeq) {
+        if (!active_.load() || !socket_.is_open()) {
+            SPDLOG_DEBUG(" 비활성 세션에 메시지 전송 시도: {}", sessionId_);
+            return;
+        }
 
-            if (!writing_) {
-                writing_ = true;
-                // spdlog::debug("📤 쓰기 시작");
-                doWrite();
+        // 압축은 보내는 스레드에서 (브로드캐스트 프레임은 스레드별로 한 번만 압축됨)
+        if (compressionEnabled_.load() && frame->size() > static_cast<size_t>(ConfigManager::compressionMinBytes)) {
+            size_t originalSize = frame->size();
+            if (auto compressed = FrameCompressor::forThisThread().compress(frame)) {
+                auto& metrics = ServerMetrics::instance();
+                metrics.framesCompressed.add();
+                metrics.compressionBytesIn.add(originalSize);
+                metrics.compressionBytesOut.add(compressed->size());
+                frame = std::move(compressed);
             }
-            else {
-                // spdlog::debug("📤 쓰기 대기 중");
+        }
+
+        // 순번은 압축 프레임 바깥에 붙임 (클라이언트는 순번을 떼어낸 뒤 Z: 여부 확인)
+        if (roomSeq > 0 && roomSeqTagsEnabled_.load()) {
+            auto tagged = std::make_shared<std::string>();
+            std::string tag = "S:" + std::to_string(roomSeq) + ":";
+            tagged->reserve(tag.size() + frame->size());
+            tagged->append(tag);
+            tagged->append(*frame);
+            frame = std::move(tagged);
+        }
+
+        try {
+            // 어느 스레드에서 보내든 큐에는 호출 순서대로 바로 넣음
+            // (방 뮤텍스 안에서 보낸 이벤트 순서가 소켓까지 유지됨 - 코어 간 전달 큐를 거치면 같은 코어에서 보낸 뒤 이벤트가 앞지름)
+            bool kickOnOwnerCore = false;
+            {
+                std::lock_guard<std::mutex> lock(sendMutex_);
+
+                if (roomSeq != 0) {
+                    if (roomSeq < lastQueuedRoomSeq_) {
+                        roomSeqReordered_ = true;
+                    }
+                    else {
+                        lastQueuedRoomSeq_ = roomSeq;
+                    }
+                }
+                outgoingMessages_.push(OutgoingFrame{ std::move(frame), roomSeq });
+                ServerMetrics::instance().sendQueueDepth.record(outgoingMessages_.size());
+
+                if (!writing_) {
+                    writing_ = true;
+                    // 소켓 쓰기는 세션이 고정된 코어에서만 시작 (다른 코어에서는 쓰기 시작 작업만 전달)
+                    if (coreIndex_ >= 0 && IoContextPool::currentIndex() != coreIndex_ &&
+                        gameServer_ && gameServer_->getIoContextPool()) {
+                        kickOnOwnerCore = true;
+                    }
+                    else {
+                        doWrite();
+                    }
+                }
             }
 
+            if (kickOnOwnerCore) {
+                auto self = shared_from_this();
+                gameServer_->getIoContextPool()->post(static_cast<size_t>(coreIndex_), [self]() {
+                    std::lock_guard<std::mutex> lock(self->sendMutex_);
+                    self->doWrite();
+                });
+            }
         }
         catch (const std::exception& e) {
             spdlog::error(" 메시지 전송 준비 중 오류 ({}): {}", sessionId_, e.what());
@@ -287,6 +408,13 @@ namespace Blokus::Server {
         }
     }
 
+    void Session::setDeliveredRoomSeq(uint64_t seq) {
+        std::lock_guard<std::mutex> lock(sendMutex_);
+        deliveredRoomSeq_.store(seq);
+        lastQueuedRoomSeq_ = seq;
+        roomSeqReordered_ = false;
+    }
+
     void Session::sendBinary(const std::vector<uint8_t>& data) {
         // 현재는 바이너리 데이터를 텍스트로 변환하여 전송
         std::string message = "BINARY_DATA:" + std::to_string(data.size());
@@ -352,11 +480,22 @@ namespace Blokus::Server {
         }
 
         auto self = shared_from_this();
-        socket_.async_read_some(
-            boost::asio::buffer(readBuffer_),
-            [this, self](const boost::system::error_code& error, size_t bytesTransferred) {
-                handleRead(error, bytesTransferred);
-            });
+        auto handler = [this, self](const boost::system::error_code& error, size_t bytesTransferred) {
+            handleRead(error, bytesTransferred);
+        };
+
+        if (readBufferSlot_) {
+#ifdef BLOKUS_IO_URING
+            if (readBufferPool_->isRegistered()) {
+                socket_.async_read_some(readBufferPool_->registeredBuffer(*readBufferSlot_), std::move(handler));
+                return;
+            }
+#endif
+            socket_.async_read_some(readBufferPool_->buffer(*readBufferSlot_), std::move(handler));
+            return;
+        }
+
+        socket_.async_read_some(boost::asio::buffer(readBuffer_, MAX_MESSAGE_LENGTH), std::move(handler));
     }
 
     void Session::handleRead(const boost::system::error_code& error, size_t bytesTransferred) {
@@ -365,8 +504,10 @@ namespace Blokus::Server {
         }
 
         if (!error) {
-            messageBuffer_.append(readBuffer_, bytesTransferred);
+            const char* data = readBufferSlot_ ? readBufferPool_->data(*readBufferSlot_) : readBuffer_;
+            messageBuffer_.append(data, bytesTransferred);
             updateLastActivity();
+            ServerMetrics::instance().bytesReceived.add(bytesTransferred);
 
             // 줄바꿈으로 구분된 메시지 처리
             size_t pos = 0;
@@ -375,10 +516,24 @@ namespace Blokus::Server {
                 messageBuffer_.erase(0, pos + 1);
 
                 if (!message.empty()) {
+                    ServerMetrics::instance().messagesReceived.add();
+                    if (!admitIncomingMessage()) {
+                        if (!active_.load()) {
+                            return;
+                        }
+                        continue;
+                    }
                     processMessage(message);
                 }
             }
 
+            // 줄바꿈 없이 최대 길이를 넘는 입력은 비정상 클라이언트로 보고 종료
+            if (messageBuffer_.size() > MAX_MESSAGE_LENGTH) {
+                spdlog::warn(" 최대 메시지 길이 초과로 연결 종료: {} ({}바이트)", sessionId_, messageBuffer_.size());
+                stop();
+                return;
+            }
+
             startRead();
         }
         else {
@@ -393,23 +548,32 @@ namespace Blokus::Server {
         }
 
         auto self = shared_from_this();
-        const std::string& message = outgoingMessages_.front();
+        const std::string& message = *outgoingMessages_.front().frame;
 
         boost::asio::async_write(socket_,
             boost::asio::buffer(message),
-            [this, self](const boost::system::error_code& error, size_t /*bytesTransferred*/) {
-                handleWrite(error, 0);
+            [this, self](const boost::system::error_code& error, size_t bytesTransferred) {
+                handleWrite(error, bytesTransferred);
             });
     }
 
-    void Session::handleWrite(const boost::system::error_code& error, size_t /*bytesTransferred*/) {
+    void Session::handleWrite(const boost::system::error_code& error, size_t bytesTransferred) {
         if (!active_.load()) {
             return;
         }
 
+        if (!error) {
+            auto& metrics = ServerMetrics::instance();
+            metrics.messagesSent.add();
+            metrics.bytesSent.add(bytesTransferred);
+        }
+
         {
             std::lock_guard<std::mutex> lock(sendMutex_);
             if (!outgoingMessages_.empty()) {
+                if (!error && outgoingMessages_.front().roomSeq != 0) {
+                    deliveredRoomSeq_.store(outgoingMessages_.front().roomSeq);
+                }
                 outgoingMessages_.pop();
             }
         }
@@ -433,7 +597,7 @@ namespace Blokus::Server {
     // ========================================
 
     void Session::processMessage(const std::string& message) {
-        spdlog::debug("📨 메시지 처리 시작: {}", message);
+        SPDLOG_DEBUG("📨 메시지 처리 시작: {}", message);
         if (messageHandler_) {
             try {
                 messageHandler_->handleMessage(message);
@@ -442,17 +606,67 @@ namespace Blokus::Server {
                 spdlog::error(" 메시지 핸들러 오류 ({}): {}", sessionId_, e.what());
                 sendMessage("ERROR:Message processing failed");
             }
-            spdlog::debug("📨 메시지 처리 완료: {}", message);
+            SPDLOG_DEBUG("📨 메시지 처리 완료: {}", message);
         }
         else {
             notifyMessage(message);
         }
     }
 
+    bool Session::admitIncomingMessage() {
+        if (ConfigManager::sessionMessageRatePerSecond <= 0) {
+            return true;
+        }
+
+        double burst = std::max(1, ConfigManager::sessionMessageBurst);
+        if (messageBucket_.tryConsume(ConfigManager::sessionMessageRatePerSecond, burst, std::chrono::steady_clock::now())) {
+            droppedMessages_ = 0;
+            return true;
+        }
+
+        ServerMetrics::instance().messagesRateLimited.add();
+
+        // 한도를 넘기 시작할 때 한 번만 알림, 계속 넘기면 연결 종료
+        if (droppedMessages_++ == 0) {
+            sendMessage("ERROR:RATE_LIMITED:요청이 너무 많습니다. 잠시 후 다시 시도해주세요");
+        }
+        if (ConfigManager::sessionMessageDropLimit > 0 &&
+            droppedMessages_ >= static_cast<uint32_t>(ConfigManager::sessionMessageDropLimit)) {
+            spdlog::warn(" 수신 한도 지속 초과로 연결 종료: {} (IP: {}, 버린 메시지 {}개)", sessionId_, remoteIP_, droppedMessages_);
+            stop();
+        }
+        return false;
+    }
+
+    void Session::scheduleAuthDeadline(std::chrono::steady_clock::duration delay) {
+        // 세션 수명을 늘리지 않도록 weak_ptr (세션 소멸 시 타이머도 함께 취소됨)
+        std::weak_ptr<Session> weak = shared_from_this();
+        authDeadlineTimer_.expires_after(delay);
+        authDeadlineTimer_.async_wait([weak](const boost::system::error_code& error) {
+            auto self = weak.lock();
+            // 접속 시각 기준 절대 기한 (핑/버전 확인만 보내며 로그인 전 슬롯을 계속 붙잡는 연결 차단)
+            if (error || !self || !self->active_.load() || self->everAuthenticated_.load()) {
+                return;
+            }
+
+            spdlog::debug("🔌 로그인 유예 시간 초과로 연결 종료: {} (IP: {})", self->sessionId_, self->remoteIP_);
+            ServerMetrics::instance().authDeadlineDrops.add();
+            self->stop();
+        });
+    }
+
+    void Session::releaseAdmissionSlot() {
+        if (holdsAdmissionSlot_.exchange(false) && gameServer_) {
+            if (auto* admission = gameServer_->getAdmissionController()) {
+                admission->releaseUnauthenticated();
+            }
+        }
+    }
+
     void Session::handleError(const boost::system::error_code& error) {
         if (error && error != boost::asio::error::eof &&
             error != boost::asio::error::connection_reset) {
-            spdlog::error(" 세션 오류 ({}): {}", sessionId_, error.message());
+            BLOKUS_LOG_RATE_LIMITED(spdlog::level::err, 1000, " 세션 오류 ({}): {}", sessionId_, error.message());
         }
 
         stop();
@@ -520,13 +734,16 @@ namespace Blokus::Server {
             return "session_" + std::to_string(timestamp);
         }
 
-        std::stringstream ss;
-        ss << std::hex << std::setfill('0');
-        for (int i = 0; i < sizeof(randomBytes); ++i) {
-            ss << std::setw(2) << static_cast<unsigned>(randomBytes[i]);
+        // 접속마다 호출되므로 stringstream 없이 바로 16진수로 변환
+        static const char kHex[] = "0123456789abcdef";
+        std::string sessionId;
+        sessionId.reserve(5 + sizeof(randomBytes) * 2);
+        sessionId.append("sess_");
+        for (unsigned char byte : randomBytes) {
+            sessionId.push_back(kHex[byte >> 4]);
+            sessionId.push_back(kHex[byte & 0x0F]);
         }
-
-        return "sess_" + ss.str();
+        return sessionId;
     }
 
 } // namespace Blokus::Server
\ No newline at end of file
@@ -0,0 +1,167 @@
+#include "SessionResumeRegistry.h"
+#include "Session.h"
+#include "ServerMetrics.h"
+#include <openssl/rand.h>
+#include <iomanip>
+#include <random>
+#include <sstream>
+
+namespace Blokus {
+    namespace Server {
+
+        SessionResumeRegistry::SessionResumeRegistry(std::chrono::seconds graceWindow)
+            : m_graceWindow(graceWindow)
+        {
+        }
+
+        // ========================================
+        // 발급 / 보류 / 재개
+        // ========================================
+
+        std::string SessionResumeRegistry::issue(const SessionPtr& session, std::optional<Ticket>* replacedParked) {
+            Ticket ticket;
+            ticket.token = generateToken();
+            ticket.userId = session->getUserId();
+            ticket.username = session->getUsername();
+            ticket.account = session->getUserAccount();
+            ticket.settings = session->getUserSettings();
+            ticket.previousSession = session;
+
+            std::lock_guard<std::mutex> lock(m_mutex);
+
+            // 같은 사용자의 이전 토큰 폐기 (보류 중이던 좌석은 호출자가 정리)
+            auto previous = m_userTokens.find(ticket.userId);
+            if (previous != m_userTokens.end()) {
+                auto it = m_tickets.find(previous->second);
+                if (it != m_tickets.end()) {
+                    if (it->second.parked && replacedParked) {
+                        *replacedParked = it->second;
+                    }
+                    eraseLocked(previous->second);
+                }
+            }
+
+            std::string token = ticket.token;
+            m_userTokens[ticket.userId] = token;
+            m_tickets.emplace(token, std::move(ticket));
+            return token;
+        }
+
+        bool SessionResumeRegistry::park(const std::string& userId, const std::string& sessionId, int roomId) {
+            std::lock_guard<std::mutex> lock(m_mutex);
+
+            auto tokenIt = m_userTokens.find(userId);
+            if (tokenIt == m_userTokens.end()) {
+                return false;
+            }
+            auto it = m_tickets.find(tokenIt->second);
+            if (it == m_tickets.end() || it->second.parked) {
+                return false;
+            }
+
+            // 새 연결이 이미 다시 로그인해 토큰을 재발급받았다면 이전 세션은 보류 대상이 아님
+            auto previous = it->second.previousSession.lock();
+            if (!previous || previous->getSessionId() != sessionId) {
+                return false;
+            }
+
+            it->second.parked = true;
+            it->second.roomId = roomId;
+            it->second.deadline = Clock::now() + m_graceWindow;
+            ++m_parkedCount;
+            ServerMetrics::instance().sessionsAwaitingResume.add(1);
+            return true;
+        }
+
+        std::optional<SessionResumeRegistry::Ticket> SessionResumeRegistry::claim(const std::string& token) {
+            std::lock_guard<std::mutex> lock(m_mutex);
+
+            auto it = m_tickets.find(token);
+            if (it == m_tickets.end()) {
+                return std::nullopt;
+            }
+            if (it->second.parked && Clock::now() >= it->second.deadline) {
+                // 만료 정리 주기 전에 들어온 요청 -> collectExpired()가 방 정리를 맡도록 남겨둠
+                return std::nullopt;
+            }
+
+            Ticket ticket = it->second;
+            eraseLocked(token);
+            return ticket;
+        }
+
+        void SessionResumeRegistry::revoke(const std::string& userId) {
+            std::lock_guard<std::mutex> lock(m_mutex);
+
+            auto it = m_userTokens.find(userId);
+            if (it != m_userTokens.end()) {
+                eraseLocked(it->second);
+            }
+        }
+
+        std::vector<SessionResumeRegistry::Ticket> SessionResumeRegistry::collectExpired(Clock::time_point now) {
+            std::vector<Ticket> expired;
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (m_parkedCount == 0) {
+                return expired;
+            }
+
+            std::vector<std::string> tokens;
+            for (const auto& [token, ticket] : m_tickets) {
+                if (ticket.parked && now >= ticket.deadline) {
+                    tokens.push_back(token);
+                }
+            }
+            for (const auto& token : tokens) {
+                expired.push_back(m_tickets[token]);
+                eraseLocked(token);
+            }
+            return expired;
+        }
+
+        size_t SessionResumeRegistry::getParkedCount() const {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            return m_parkedCount;
+        }
+
+        // ========================================
+        // 내부 유틸리티
+        // ========================================
+
+        void SessionResumeRegistry::eraseLocked(const std::string& token) {
+            auto it = m_tickets.find(token);
+            if (it == m_tickets.end()) {
+                return;
+            }
+
+            if (it->second.parked) {
+                --m_parkedCount;
+                ServerMetrics::instance().sessionsAwaitingResume.add(-1);
+            }
+
+            auto userIt = m_userTokens.find(it->second.userId);
+            if (userIt != m_userTokens.end() && userIt->second == token) {
+                m_userTokens.erase(userIt);
+            }
+            m_tickets.erase(it);
+        }
+
+        std::string SessionResumeRegistry::generateToken() {
+            unsigned char randomBytes[24];
+            if (RAND_bytes(randomBytes, sizeof(randomBytes)) != 1) {
+                std::random_device rd;
+                for (auto& byte : randomBytes) {
+                    byte = static_cast<unsigned char>(rd());
+                }
+            }
+
+            std::ostringstream ss;
+            ss << std::hex << std::setfill('0');
+            for (unsigned char byte : randomBytes) {
+                ss << std::setw(2) << static_cast<unsigned>(byte);
+            }
+            return "rsm_" + ss.str();
+        }
+
+    } // namespace Server
+} // namespace Blokus
@@ -0,0 +1,296 @@
+#include "SpectatorChannel.h"
+#include "Session.h"
+#include "ServerMetrics.h"
+#include <spdlog/spdlog.h>
+#include <algorithm>
+
+namespace Blokus {
+    namespace Server {
+
+        namespace {
+            constexpr auto RETRY_DELAY = std::chrono::milliseconds(100);
+        }
+
+        // ========================================
+        // 생성자/소멸자
+        // ========================================
+
+        SpectatorChannel::SpectatorChannel(int roomId, boost::asio::any_io_executor executor, const Options& options)
+            : m_roomId(roomId)
+            , m_options(options)
+            , m_executor(executor)
+            , m_retryTimer(executor)
+        {
+            m_log.reserve(m_options.maxLogEntries);
+        }
+
+        SpectatorChannel::~SpectatorChannel() {
+            ServerMetrics::instance().spectatorsCurrent.add(-static_cast<int64_t>(m_viewerCount.load()));
+        }
+
+        // ========================================
+        // 방 쪽 (방 뮤텍스 보유 상태에서 호출)
+        // ========================================
+
+        void SpectatorChannel::publishSnapshot(SharedFrame snapshot) {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_snapshot = std::move(snapshot);
+            m_snapshotSeq = m_seq;
+            m_log.clear();
+        }
+
+        bool SpectatorChannel::publish(const SharedFrame& frame) {
+            bool needsSnapshot;
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                if (m_closed) {
+                    return false;
+                }
+                m_log.push_back(frame);
+                ++m_seq;
+                needsSnapshot = m_log.size() >= m_options.maxLogEntries;
+            }
+
+            if (m_viewerCount.load(std::memory_order_relaxed) > 0) {
+                scheduleFanout();
+            }
+            return needsSnapshot;
+        }
+
+        void SpectatorChannel::close() {
+            ViewerList viewers;
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                if (m_closed) {
+                    return;
+                }
+                m_closed = true;
+                viewers.swap(m_viewers);
+                m_log.clear();
+                m_snapshot.reset();
+
+                // 타이머는 스레드 안전하지 않으므로 예약(scheduleRetry)과 같은 뮤텍스 안에서 취소
+                boost::system::error_code ignored;
+                m_retryTimer.cancel(ignored);
+            }
+
+            auto endedFrame = makeFrame("SPECTATE_ENDED:" + std::to_string(m_roomId));
+            for (const auto& viewer : viewers) {
+                std::lock_guard<std::mutex> viewerLock(viewer->mutex);
+                if (auto session = viewer->session.lock()) {
+                    session->clearSpectatingRoom(m_roomId);
+                    session->sendFrame(endedFrame);
+                }
+            }
+
+            m_viewerCount.store(0);
+            ServerMetrics::instance().spectatorsCurrent.add(-static_cast<int64_t>(viewers.size()));
+            if (!viewers.empty()) {
+                spdlog::debug("방 {} 관전 채널 종료 (관전자 {}명)", m_roomId, viewers.size());
+            }
+        }
+
+        // ========================================
+        // 관전자 쪽 (방 뮤텍스를 사용하지 않음)
+        // ========================================
+
+        SpectatorChannel::JoinResult SpectatorChannel::addViewer(const SessionPtr& session) {
+            auto viewer = std::make_shared<Viewer>();
+            viewer->session = session;
+            viewer->sessionId = session->getSessionId();
+
+            // 합류 직후 팬아웃이 먼저 보내지 않도록 초기 동기화가 끝날 때까지 관전자 잠금 유지
+            std::lock_guard<std::mutex> viewerLock(viewer->mutex);
+            Backlog backlog;
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                if (m_closed) {
+                    return JoinResult::Closed;
+                }
+                for (const auto& existing : m_viewers) {
+                    if (existing->sessionId == viewer->sessionId) {
+                        return JoinResult::AlreadyJoined;
+                    }
+                }
+                if (m_viewers.size() >= m_options.maxViewers) {
+                    return JoinResult::Full;
+                }
+                m_viewers.push_back(viewer);
+                backlog.snapshot = m_snapshot;
+                backlog.snapshotSeq = m_snapshotSeq;
+                backlog.log = m_log;
+            }
+
+            m_viewerCount.fetch_add(1, std::memory_order_relaxed);
+            ServerMetrics::instance().spectatorsCurrent.add(1);
+
+            session->sendMessage("SPECTATE_JOINED:" + std::to_string(m_roomId));
+            deliverLocked(*viewer, backlog);
+            return JoinResult::Joined;
+        }
+
+        bool SpectatorChannel::removeViewer(const std::string& sessionId) {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            auto it = std::find_if(m_viewers.begin(), m_viewers.end(),
+                [&sessionId](const std::shared_ptr<Viewer>& viewer) { return viewer->sessionId == sessionId; });
+            if (it == m_viewers.end()) {
+                return false;
+            }
+
+            m_viewers.erase(it);
+            m_viewerCount.fetch_sub(1, std::memory_order_relaxed);
+            ServerMetrics::instance().spectatorsCurrent.add(-1);
+            return true;
+        }
+
+        // ========================================
+        // 팬아웃
+        // ========================================
+
+        void SpectatorChannel::scheduleFanout() {
+            // 이미 예약된 팬아웃이 있으면 그 실행에서 새 로그까지 함께 보냄 (연속 이벤트 합치기)
+            if (m_fanoutScheduled.exchange(true, std::memory_order_acq_rel)) {
+                return;
+            }
+            boost::asio::post(m_executor, [self = shared_from_this()]() {
+                self->runFanout();
+            });
+        }
+
+        void SpectatorChannel::runFanout() {
+            m_fanoutScheduled.store(false, std::memory_order_release);
+
+            auto backlog = std::make_shared<Backlog>();
+            auto viewers = std::make_shared<ViewerList>();
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                if (m_closed || m_viewers.empty()) {
+                    return;
+                }
+                backlog->snapshot = m_snapshot;
+                backlog->snapshotSeq = m_snapshotSeq;
+                backlog->log = m_log;
+                *viewers = m_viewers;
+            }
+
+            std::shared_ptr<const Backlog> sharedBacklog = backlog;
+            std::shared_ptr<const ViewerList> sharedViewers = viewers;
+            size_t shardSize = std::max<size_t>(1, m_options.shardSize);
+
+            // 첫 샤드는 현재 작업에서, 나머지는 별도 작업으로 나눠 다른 팬아웃 스레드가 병렬 처리
+            for (size_t begin = shardSize; begin < viewers->size(); begin += shardSize) {
+                size_t end = std::min(begin + shardSize, viewers->size());
+                boost::asio::post(m_executor, [self = shared_from_this(), sharedBacklog, sharedViewers, begin, end]() {
+                    self->fanoutShard(sharedBacklog, sharedViewers, begin, end);
+                });
+            }
+            fanoutShard(sharedBacklog, sharedViewers, 0, std::min(shardSize, viewers->size()));
+        }
+
+        void SpectatorChannel::fanoutShard(const std::shared_ptr<const Backlog>& backlog,
+            const std::shared_ptr<const ViewerList>& viewers, size_t begin, size_t end) {
+            bool anyLagging = false;
+            bool anyGone = false;
+
+            for (size_t i = begin; i < end; ++i) {
+                Viewer& viewer = *(*viewers)[i];
+                std::lock_guard<std::mutex> viewerLock(viewer.mutex);
+                switch (deliverLocked(viewer, *backlog)) {
+                case DeliveryResult::Lagging:
+                    anyLagging = true;
+                    break;
+                case DeliveryResult::Gone:
+                    anyGone = true;
+                    break;
+                default:
+                    break;
+                }
+            }
+
+            if (anyGone) {
+                pruneViewers();
+            }
+            if (anyLagging) {
+                scheduleRetry();
+            }
+        }
+
+        SpectatorChannel::DeliveryResult SpectatorChannel::deliverLocked(Viewer& viewer, const Backlog& backlog) {
+            auto session = viewer.session.lock();
+            if (!session || !session->isActive()) {
+                return DeliveryResult::Gone;
+            }
+            if (!backlog.snapshot) {
+                return DeliveryResult::Delivered;
+            }
+
+            uint64_t latestSeq = backlog.snapshotSeq + backlog.log.size();
+            if (viewer.synced && viewer.deliveredSeq >= latestSeq) {
+                return DeliveryResult::Delivered;
+            }
+
+            // 송신 큐가 밀려 있으면 쌓지 않고 다음 팬아웃(또는 재시도)에 한꺼번에 보냄
+            if (viewer.synced && session->getPendingMessageCount() > m_options.maxPendingFrames) {
+                return DeliveryResult::Lagging;
+            }
+
+            auto& metrics = ServerMetrics::instance();
+            size_t start = 0;
+            if (!viewer.synced || viewer.deliveredSeq < backlog.snapshotSeq) {
+                // 처음 합류했거나 놓친 구간이 로그에서 밀려남 -> 스냅샷부터 다시 보냄
+                if (viewer.synced) {
+                    metrics.spectatorResyncs.add();
+                }
+                session->sendFrame(backlog.snapshot);
+                metrics.spectatorFramesSent.add();
+                viewer.synced = true;
+            }
+            else {
+                start = static_cast<size_t>(viewer.deliveredSeq - backlog.snapshotSeq);
+            }
+
+            for (size_t i = start; i < backlog.log.size(); ++i) {
+                session->sendFrame(backlog.log[i]);
+            }
+            metrics.spectatorFramesSent.add(backlog.log.size() - start);
+
+            viewer.deliveredSeq = latestSeq;
+            return DeliveryResult::Delivered;
+        }
+
+        void SpectatorChannel::scheduleRetry() {
+            if (m_retryScheduled.exchange(true, std::memory_order_acq_rel)) {
+                return;
+            }
+
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (m_closed) {
+                return;
+            }
+            m_retryTimer.expires_after(RETRY_DELAY);
+            m_retryTimer.async_wait([self = shared_from_this()](const boost::system::error_code& error) {
+                self->m_retryScheduled.store(false, std::memory_order_release);
+                if (!error) {
+                    self->scheduleFanout();
+                }
+            });
+        }
+
+        void SpectatorChannel::pruneViewers() {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            size_t before = m_viewers.size();
+            m_viewers.erase(std::remove_if(m_viewers.begin(), m_viewers.end(),
+                [](const std::shared_ptr<Viewer>& viewer) {
+                    auto session = viewer->session.lock();
+                    return !session || !session->isActive();
+                }), m_viewers.end());
+
+            size_t removed = before - m_viewers.size();
+            if (removed > 0) {
+                m_viewerCount.fetch_sub(removed, std::memory_order_relaxed);
+                ServerMetrics::instance().spectatorsCurrent.add(-static_cast<int64_t>(removed));
+            }
+        }
+
+    } // namespace Server
+} // namespace Blokus
@@ -0,0 +1,287 @@
+#include "Tracing.h"
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <vector>
+
+namespace Blokus {
+    namespace Server {
+
+        namespace {
+            // ========================================
+            // 스레드별 링 버퍼
+            // ========================================
+            struct TraceEvent {
+                std::atomic<const char*> name{ nullptr };
+                std::atomic<uint64_t> startNs{ 0 };
+                std::atomic<uint64_t> durationNs{ 0 };
+                std::atomic<uint64_t> traceId{ 0 };
+                std::atomic<int64_t> arg{ -1 };
+            };
+
+            struct ThreadBuffer {
+                explicit ThreadBuffer(size_t capacity, uint32_t id)
+                    : events(capacity)
+                    , mask(capacity - 1)
+                    , threadId(id)
+                {
+                }
+
+                std::vector<TraceEvent> events;
+                size_t mask;
+                uint32_t threadId;
+                std::atomic<uint64_t> head{ 0 };    // 다음에 쓸 위치 (누적)
+            };
+
+            struct EventCopy {
+                const char* name;
+                uint64_t startNs;
+                uint64_t durationNs;
+                uint64_t traceId;
+                int64_t arg;
+            };
+
+            std::atomic<size_t> g_eventsPerThread{ 16384 };
+            std::atomic<uint64_t> g_nextTraceId{ 1 };
+            std::atomic<uint32_t> g_nextThreadId{ 1 };
+
+            // 스레드가 종료돼도 덤프할 수 있도록 레지스트리가 버퍼를 소유
+            std::mutex g_registryMutex;
+            std::vector<std::shared_ptr<ThreadBuffer>> g_buffers;
+
+            thread_local TraceContext t_context;
+            thread_local uint64_t t_rootCounter = 0;
+            thread_local ThreadBuffer* t_buffer = nullptr;
+
+            const auto g_epoch = std::chrono::steady_clock::now();
+
+            size_t roundUpToPowerOfTwo(size_t value) {
+                size_t result = 1;
+                while (result < value) {
+                    result <<= 1;
+                }
+                return result;
+            }
+
+            ThreadBuffer& threadBuffer() {
+                if (!t_buffer) {
+                    auto buffer = std::make_shared<ThreadBuffer>(
+                        roundUpToPowerOfTwo(std::max<size_t>(64, g_eventsPerThread.load())),
+                        g_nextThreadId.fetch_add(1));
+                    std::lock_guard<std::mutex> lock(g_registryMutex);
+                    g_buffers.push_back(buffer);
+                    t_buffer = buffer.get();
+                }
+                return *t_buffer;
+            }
+
+            void appendJsonString(std::ostringstream& out, const char* text) {
+                out << '"';
+                for (const char* p = text; *p; ++p) {
+                    char c = *p;
+                    if (c == '"' || c == '\\') {
+                        out << '\\' << c;
+                    }
+                    else if (static_cast<unsigned char>(c) < 0x20) {
+                        out << ' ';
+                    }
+                    else {
+                        out << c;
+                    }
+                }
+                out << '"';
+            }
+        }
+
+        std::atomic<int> Tracer::s_sampleEvery{ 0 };
+
+        // ========================================
+        // 설정
+        // ========================================
+
+        void Tracer::configure(int sampleEvery, size_t eventsPerThread) {
+            g_eventsPerThread.store(eventsPerThread);
+            setSampleEvery(sampleEvery);
+        }
+
+        void Tracer::setSampleEvery(int sampleEvery) {
+            s_sampleEvery.store(sampleEvery < 0 ? 0 : sampleEvery, std::memory_order_relaxed);
+        }
+
+        TraceContext Tracer::currentContext() {
+            return t_context;
+        }
+
+        void Tracer::setCurrentContext(const TraceContext& context) {
+            t_context = context;
+        }
+
+        uint64_t Tracer::nowNanos() {
+            return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now() - g_epoch).count());
+        }
+
+        bool Tracer::sampleRoot() {
+            int every = s_sampleEvery.load(std::memory_order_relaxed);
+            if (every <= 0) {
+                return false;
+            }
+            return (++t_rootCounter % static_cast<uint64_t>(every)) == 0;
+        }
+
+        uint64_t Tracer::nextTraceId() {
+            return g_nextTraceId.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        void Tracer::record(const char* name, uint64_t startNs, uint64_t durationNs, uint64_t traceId, int64_t arg) {
+            ThreadBuffer& buffer = threadBuffer();
+            uint64_t index = buffer.head.load(std::memory_order_relaxed);
+            TraceEvent& event = buffer.events[index & buffer.mask];
+
+            event.name.store(name, std::memory_order_relaxed);
+            event.startNs.store(startNs, std::memory_order_relaxed);
+            event.durationNs.store(durationNs, std::memory_order_relaxed);
+            event.traceId.store(traceId, std::memory_order_relaxed);
+            event.arg.store(arg, std::memory_order_relaxed);
+
+            buffer.head.store(index + 1, std::memory_order_release);
+        }
+
+        // ========================================
+        // 덤프
+        // ========================================
+
+        std::string Tracer::dumpChromeTrace() {
+            std::vector<std::shared_ptr<ThreadBuffer>> buffers;
+            {
+                std::lock_guard<std::mutex> lock(g_registryMutex);
+                buffers = g_buffers;
+            }
+
+            std::ostringstream out;
+            out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+            bool first = true;
+
+            for (const auto& buffer : buffers) {
+                size_t capacity = buffer->events.size();
+                uint64_t head = buffer->head.load(std::memory_order_acquire);
+                uint64_t begin = head > capacity ? head - capacity : 0;
+
+                std::vector<EventCopy> copies;
+                copies.reserve(static_cast<size_t>(head - begin));
+                for (uint64_t i = begin; i < head; ++i) {
+                    const TraceEvent& event = buffer->events[i & buffer->mask];
+                    copies.push_back({ event.name.load(std::memory_order_relaxed),
+                        event.startNs.load(std::memory_order_relaxed),
+                        event.durationNs.load(std::memory_order_relaxed),
+                        event.traceId.load(std::memory_order_relaxed),
+                        event.arg.load(std::memory_order_relaxed) });
+                }
+
+                // 복사하는 동안 소유 스레드가 덮어쓴(쓰는 중인 칸 포함) 앞부분은 버림
+                uint64_t headAfter = buffer->head.load(std::memory_order_acquire) + 1;
+                uint64_t validBegin = headAfter > capacity ? headAfter - capacity : 0;
+                size_t skip = validBegin > begin ? static_cast<size_t>(std::min<uint64_t>(validBegin - begin, copies.size())) : 0;
+
+                if (!first) {
+                    out << ",";
+                }
+                first = false;
+                out << "{\"ph\":\"M\",\"name\":\"thread_name\",\"pid\":1,\"tid\":" << buffer->threadId
+                    << ",\"args\":{\"name\":\"thread-" << buffer->threadId << "\"}}";
+
+                for (size_t i = skip; i < copies.size(); ++i) {
+                    const EventCopy& event = copies[i];
+                    if (!event.name) {
+                        continue;
+                    }
+                    out << ",{\"ph\":\"X\",\"name\":";
+                    appendJsonString(out, event.name);
+                    out << ",\"pid\":1,\"tid\":" << buffer->threadId
+                        << ",\"ts\":" << event.startNs / 1000 << "." << (event.startNs % 1000) / 100
+                        << ",\"dur\":" << event.durationNs / 1000 << "." << (event.durationNs % 1000) / 100
+                        << ",\"args\":{\"trace\":" << event.traceId;
+                    if (event.arg >= 0) {
+                        out << ",\"arg\":" << event.arg;
+                    }
+                    out << "}}";
+                }
+            }
+
+            out << "]}";
+            return out.str();
+        }
+
+        // ========================================
+        // TraceSpan
+        // ========================================
+
+        TraceSpan::TraceSpan(const char* name, int64_t arg)
+            : m_name(name)
+            , m_arg(arg)
+        {
+            if (!t_context.sampled) {
+                return;
+            }
+            m_recording = true;
+            m_traceId = t_context.traceId;
+            m_startNs = Tracer::nowNanos();
+        }
+
+        TraceSpan::TraceSpan(const char* name, int64_t arg, RootTag)
+            : m_name(name)
+            , m_arg(arg)
+        {
+            // 이미 샘플링된 추적 안이면 일반 자식 스팬처럼 동작
+            if (t_context.sampled) {
+                m_recording = true;
+                m_traceId = t_context.traceId;
+                m_startNs = Tracer::nowNanos();
+                return;
+            }
+            if (!Tracer::sampleRoot()) {
+                return;
+            }
+
+            m_recording = true;
+            m_ownsContext = true;
+            m_previousContext = t_context;
+            m_traceId = Tracer::nextTraceId();
+            t_context = TraceContext{ m_traceId, true };
+            m_startNs = Tracer::nowNanos();
+        }
+
+        TraceSpan TraceSpan::root(const char* name, int64_t arg) {
+            return TraceSpan(name, arg, RootTag{});
+        }
+
+        TraceSpan::~TraceSpan() {
+            if (!m_recording) {
+                return;
+            }
+            uint64_t endNs = Tracer::nowNanos();
+            Tracer::record(m_name, m_startNs, endNs - m_startNs, m_traceId, m_arg);
+
+            if (m_ownsContext) {
+                t_context = m_previousContext;
+            }
+        }
+
+        // ========================================
+        // TraceContextScope
+        // ========================================
+
+        TraceContextScope::TraceContextScope(const TraceContext& context)
+            : m_previous(t_context)
+        {
+            t_context = context;
+        }
+
+        TraceContextScope::~TraceContextScope() {
+            t_context = m_previous;
+        }
+
+    } // namespace Server
+} // namespace Blokus
@@ -0,0 +1,205 @@
+#include "UserStatsCache.h"
+#include <spdlog/spdlog.h>
+#include <algorithm>
+#include <cctype>
+
+namespace Blokus {
+    namespace Server {
+
+        // ========================================
+        // 생성자
+        // ========================================
+
+        UserStatsCache::UserStatsCache(std::shared_ptr<DatabaseManager> dbManager, size_t maxEntries)
+            : m_dbManager(dbManager)
+            , m_maxEntries(std::max<size_t>(1, maxEntries))
+        {
+            spdlog::info("사용자 통계 캐시 초기화 (최대 {}명)", m_maxEntries);
+        }
+
+        // ========================================
+        // 등록/조회
+        // ========================================
+
+        UserAccount UserStatsCache::put(const UserAccount& account) {
+            std::lock_guard<std::mutex> lock(m_mutex);
+
+            auto it = m_entries.find(account.userId);
+            if (it == m_entries.end()) {
+                m_lru.push_front(account.userId);
+
+                Entry entry;
+                entry.account = account;
+                entry.lruIt = m_lru.begin();
+                it = m_entries.emplace(account.userId, std::move(entry)).first;
+            }
+            else {
+                Entry& entry = it->second;
+                for (const auto& name : { entry.account.username, entry.account.displayName }) {
+                    auto indexIt = m_nameIndex.find(normalizeName(name));
+                    if (indexIt != m_nameIndex.end() && indexIt->second == account.userId) {
+                        m_nameIndex.erase(indexIt);
+                    }
+                }
+
+                if (entry.pendingRows > 0) {
+                    // DB 값은 아직 반영 안 된 결과가 빠져 있으므로 통계는 캐시 값 유지, 계정 정보만 갱신
+                    entry.account.username = account.username;
+                    entry.account.displayName = account.displayName;
+                    entry.account.passwordHash = account.passwordHash;
+                    entry.account.isActive = account.isActive;
+                }
+                else {
+                    entry.account = account;
+                }
+                touchLocked(entry);
+            }
+
+            const UserAccount& cached = it->second.account;
+            m_nameIndex[normalizeName(cached.username)] = cached.userId;
+            m_nameIndex[normalizeName(cached.displayName)] = cached.userId;
+
+            UserAccount result = cached;
+            evictLocked();
+            return result;
+        }
+
+        std::optional<UserAccount> UserStatsCache::get(uint32_t userId) {
+            std::lock_guard<std::mutex> lock(m_mutex);
+
+            auto it = m_entries.find(userId);
+            if (it == m_entries.end()) {
+                return std::nullopt;
+            }
+
+            touchLocked(it->second);
+            return it->second.account;
+        }
+
+        std::optional<UserAccount> UserStatsCache::findByName(const std::string& name) {
+            std::lock_guard<std::mutex> lock(m_mutex);
+
+            auto indexIt = m_nameIndex.find(normalizeName(name));
+            if (indexIt == m_nameIndex.end()) {
+                return std::nullopt;
+            }
+
+            auto it = m_entries.find(indexIt->second);
+            if (it == m_entries.end()) {
+                m_nameIndex.erase(indexIt);
+                return std::nullopt;
+            }
+
+            touchLocked(it->second);
+            return it->second.account;
+        }
+
+        // ========================================
+        // 게임 결과 반영
+        // ========================================
+
+        std::optional<UserAccount> UserStatsCache::applyGameResult(const GameResultRow& row) {
+            std::lock_guard<std::mutex> lock(m_mutex);
+
+            auto it = m_entries.find(row.userId);
+            if (it == m_entries.end()) {
+                return std::nullopt;
+            }
+
+            // DatabaseManager::saveGameResultsBatch와 같은 규칙 (무승부 없음, 소모형 레벨업)
+            UserAccount& account = it->second.account;
+            account.totalGames++;
+            if (row.won) {
+                account.wins++;
+            }
+            else {
+                account.losses++;
+            }
+            account.totalScore += row.score;
+            account.bestScore = std::max(account.bestScore, row.score);
+
+            if (row.expGained > 0) {
+                account.experiencePoints += row.expGained;
+                while (account.experiencePoints >= DatabaseManager::getRequiredExpForLevel(account.level + 1)) {
+                    account.experiencePoints -= DatabaseManager::getRequiredExpForLevel(account.level + 1);
+                    account.level++;
+                }
+            }
+
+            it->second.pendingRows++;
+            touchLocked(it->second);
+            return account;
+        }
+
+        void UserStatsCache::markFlushed(const std::vector<GameResultRow>& rows) {
+            std::lock_guard<std::mutex> lock(m_mutex);
+
+            for (const auto& row : rows) {
+                auto it = m_entries.find(row.userId);
+                if (it != m_entries.end() && it->second.pendingRows > 0) {
+                    it->second.pendingRows--;
+                }
+            }
+
+            evictLocked();
+        }
+
+        // ========================================
+        // 상태 확인
+        // ========================================
+
+        size_t UserStatsCache::size() const {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            return m_entries.size();
+        }
+
+        size_t UserStatsCache::getDirtyCount() const {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            return static_cast<size_t>(std::count_if(m_entries.begin(), m_entries.end(),
+                [](const auto& pair) { return pair.second.pendingRows > 0; }));
+        }
+
+        // ========================================
+        // 내부 헬퍼
+        // ========================================
+
+        void UserStatsCache::touchLocked(Entry& entry) {
+            m_lru.splice(m_lru.begin(), m_lru, entry.lruIt);
+        }
+
+        void UserStatsCache::evictLocked() {
+            // 오래된 것부터 축출하되 DB 미반영 항목은 건너뜀
+            auto it = m_lru.end();
+            while (m_entries.size() > m_maxEntries && it != m_lru.begin()) {
+                --it;
+                auto entryIt = m_entries.find(*it);
+                if (entryIt == m_entries.end()) {
+                    it = m_lru.erase(it);
+                    continue;
+                }
+                if (entryIt->second.pendingRows > 0) {
+                    continue;
+                }
+
+                const UserAccount& account = entryIt->second.account;
+                for (const auto& name : { account.username, account.displayName }) {
+                    auto indexIt = m_nameIndex.find(normalizeName(name));
+                    if (indexIt != m_nameIndex.end() && indexIt->second == account.userId) {
+                        m_nameIndex.erase(indexIt);
+                    }
+                }
+
+                m_entries.erase(entryIt);
+                it = m_lru.erase(it);
+            }
+        }
+
+        std::string UserStatsCache::normalizeName(const std::string& name) {
+            std::string normalized = name;
+            std::transform(normalized.begin(), normalized.end(), normalized.begin(),
+                [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+            return normalized;
+        }
+
+    } // namespace Server
+} // namespace Blokus